@@ -0,0 +1,150 @@
+/*! \file    TestGMG.cxx
+ *  \brief   Test geometric multigrid for the Poisson's equation on structured grids
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Sample usages:
+//   ./TestGMG -dim 2 -n 1023
+//   ./TestGMG -dim 3 -n 127 -galerkin true -pcg true
+//   ./TestGMG -dim 2 -n 1023 -fmg true -maxIter 1 -minIter 1
+//   ./TestGMG -dim 3 -n 127 -cycle 2 -sweeps 2
+
+// Standard header files
+#include <cmath>
+
+// FASPXX header files
+#include "CG.hxx"
+#include "GMG.hxx"
+#include "Param.hxx"
+#include "StencilOp.hxx"
+#include "Timing.hxx"
+
+/// Solve the discrete Poisson's equation with stencil S by GMG or GMG-PCG.
+template <StencilShape S>
+static FaspRetCode SolvePoisson(const StencilOp<S>& A, GMG& gmg, bool usePCG,
+                                const SOLParams& solParam)
+{
+    const USI   n = A.GetRowSize();
+    GetWallTime timer;
+    VEC         b(n), u(n), x(n, 0.0);
+
+    // Exact solution u = sin(pi x) sin(pi y) [sin(pi z)] and b = h^2 f
+    USI nx, ny, nz;
+    A.GetGrid(nx, ny, nz);
+    const DBL pi = 3.14159265358979323846, h = 1.0 / (nx + 1);
+    const USI dim = (nz > 1) ? 3 : 2;
+    for (USI k = 0; k < nz; ++k) {
+        for (USI j = 0; j < ny; ++j) {
+            for (USI i = 0; i < nx; ++i) {
+                const USI idx = (k * ny + j) * nx + i;
+                u[idx]        = std::sin(pi * (i + 1) * h) * std::sin(pi * (j + 1) * h);
+                if (dim == 3) u[idx] *= std::sin(pi * (k + 1) * h);
+                b[idx] = dim * pi * pi * h * h * u[idx];
+            }
+        }
+    }
+
+    timer.Start();
+    FaspRetCode retCode = gmg.Setup(A);
+    if (retCode < 0) return retCode;
+    timer.StopInfo("Setting up GMG");
+    std::cout << "Number of levels: " << gmg.GetNumLevels() << std::endl;
+
+    if (usePCG) {
+        gmg.SetMaxIter(1);
+        gmg.SetMinIter(1);
+
+        CG cg;
+        cg.SetOutput(solParam.verbose);
+        cg.SetMaxIter(solParam.maxIter);
+        cg.SetRelTol(solParam.relTol);
+        cg.SetAbsTol(solParam.absTol);
+        cg.SetupPCD(gmg);
+        cg.Setup(A);
+
+        timer.Start();
+        retCode = cg.Solve(b, x);
+        cg.PrintTime(timer.Stop());
+        std::cout << "NumIter : " << cg.GetIterations() << std::endl;
+    } else {
+        gmg.SetOutput(solParam.verbose);
+        gmg.SetMaxIter(solParam.maxIter);
+        gmg.SetMinIter(solParam.minIter);
+        gmg.SetRelTol(solParam.relTol);
+        gmg.SetAbsTol(solParam.absTol);
+
+        timer.Start();
+        retCode = gmg.Solve(b, x);
+        gmg.PrintTime(timer.Stop());
+        std::cout << "NumIter : " << gmg.GetIterations() << std::endl;
+    }
+
+    // Max-norm error against the exact solution
+    x.XPAY(-1.0, u);
+    std::cout << "Error   : " << std::scientific << x.NormInf() << std::endl;
+
+    return retCode;
+}
+
+int main(int argc, const char* args[])
+{
+    // User default parameters
+    USI  dim = 2, n = 255, sweeps = 1;
+    USI  cycle = CYCLE_V;
+    bool galerkin = false, usePCG = false, useFullMG = false;
+
+    // Read general parameters
+    Parameters params(argc, args);
+    params.AddParam("-dim", "Space dimension (2 or 3)", &dim);
+    params.AddParam("-n", "Number of grid points in each direction", &n);
+    params.AddParam("-sweeps", "Number of smoothing sweeps", &sweeps);
+    params.AddParam("-galerkin", "Galerkin coarse operators", &galerkin);
+    params.AddParam("-pcg", "Use GMG as a preconditioner for CG", &usePCG);
+    params.AddParam("-cycle", "Cycle type (0: V, 1: F, 2: K, 3: AMLI)", &cycle);
+    params.AddParam("-fmg", "Start with a full multigrid pass", &useFullMG);
+
+    // Set solver parameters
+    SOLParams solParam;
+    solParam.maxIter = 100;
+    solParam.relTol  = 1e-8;
+    solParam.verbose = PRINT_MIN;
+    params.SetSOLParams(solParam);
+
+    // Parse and print used parameters
+    params.Parse();
+    params.Print();
+
+    GMG gmg;
+    gmg.SetCoarseType(galerkin ? GMG_GALERKIN : GMG_REDISCRETIZE);
+    gmg.SetNumSweeps(sweeps);
+    gmg.SetSymmetric(usePCG);
+    gmg.SetCycleType(static_cast<CycleType>(cycle));
+    gmg.SetFullMG(useFullMG);
+
+    // 5-point stencil in 2D and 7-point stencil in 3D, scaled by h^2
+    if (dim == 2) {
+        std::cout << "Grid: " << n << " x " << n << std::endl;
+        StencilOp<STENCIL_5P2D> A(n, n, 1, {-1.0, -1.0, 4.0, -1.0, -1.0});
+        return SolvePoisson(A, gmg, usePCG, solParam);
+    } else {
+        std::cout << "Grid: " << n << " x " << n << " x " << n << std::endl;
+        StencilOp<STENCIL_7P3D> A(n, n, n, {-1.0, -1.0, -1.0, 6.0, -1.0, -1.0, -1.0});
+        return SolvePoisson(A, gmg, usePCG, solParam);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Add F-cycle and full multigrid       */
+/*  Chensong Zhang      Oct/19/2026      Choose the cycle type by number      */
+/*----------------------------------------------------------------------------*/
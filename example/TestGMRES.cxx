@@ -27,6 +27,7 @@ int main(int argc, const char *args[])
     std::string parFile = "../../data/input.param";
     std::string matFile = "../../data/fdm_10X10.csr";
     std::string rhsFile, xinFile;
+    USI         orth = ORTH_CGS2_LOW;
 
     // Read general parameters
     Parameters params(argc, args);
@@ -34,6 +35,8 @@ int main(int argc, const char *args[])
     params.AddParam("-mat", "Coefficient matrix A", &matFile);
     params.AddParam("-rhs", "Right-hand-side b", &rhsFile);
     params.AddParam("-xin", "Initial guess for iteration", &xinFile);
+    params.AddParam("-orth", "Orthogonalization (0: MGS, 1: CGS2, 2: low-sync CGS2)",
+                    &orth);
 
     // Set solver parameters
     SOLParams solParam;
@@ -75,6 +78,7 @@ int main(int argc, const char *args[])
     solver.SetRelTol(solParam.relTol);
     solver.SetAbsTol(solParam.absTol);
     solver.SetMaxMinRestart(solParam.restart, 5);
+    solver.SetOrthType(static_cast<OrthType>(orth));
     solver.SetupPCD(pcd);
     solver.Setup(mat);
 
@@ -112,6 +116,7 @@ int main(int argc, const char *args[])
     fsolver.SetRelTol(solParam.relTol);
     fsolver.SetAbsTol(solParam.absTol);
     fsolver.SetMaxMinRestart(solParam.restart, 5);
+    fsolver.SetOrthType(static_cast<OrthType>(orth));
     fsolver.SetupPCD(pcd);
     fsolver.Setup(mat);
 
@@ -136,4 +141,5 @@ int main(int argc, const char *args[])
 /*----------------------------------------------------------------------------*/
 /*  Kailei Zhang        Oct/12/2019      Create file                          */
 /*  Chensong Zhang      Sep/16/2021      Restructure file                     */
+/*  Chensong Zhang      Oct/19/2026      Choose the orthogonalization         */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
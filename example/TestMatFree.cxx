@@ -12,9 +12,9 @@
 // FASPXX header files
 #include "CG.hxx"
 #include "Iter.hxx"
-#include "LOP.hxx"
 #include "Param.hxx"
 #include "Poisson2D.hxx"
+#include "StencilOp.hxx"
 #include "Timing.hxx"
 
 int dim = 16; // number of partitions in X and Y directions: 16x16 grid
@@ -22,22 +22,6 @@ int dim = 16; // number of partitions in X and Y directions: 16x16 grid
 /// Find the 1-dim global index of (x,y)
 #define locate(row, column) (((row)-1) * (dim - 1) + (column)-1)
 
-/// Matrix-free linear operator object.
-class MatFree : public LOP
-{
-
-public:
-    /// Default constructor.
-    MatFree(const USI row, const USI col)
-    {
-        nrow = row;
-        mcol = col;
-    }
-
-    /// Matrix-free matrix-vector multiplication.
-    void Apply(const VEC &x, VEC &y) const override;
-};
-
 /// Assemble the right-hand side.
 static void AssembleRHS(int dim, DBL *ptr)
 {
@@ -84,97 +68,6 @@ static void AssembleRHS(int dim, DBL *ptr)
                               h2 * Load(dim1 * h, dim1 * h);
 }
 
-/// Matrix-free action on a VEC object.
-void MatFree::Apply(const VEC &x, VEC &y) const
-{
-    const DBL *x_val;
-    x.GetArray(&x_val);
-
-    y.SetValues(x.GetSize(), 0.0);
-    DBL *y_val;
-    y.GetArray(&y_val);
-
-    const int dim1 = dim - 1;
-    int       lower, left, center, right, upper;
-
-    // interior points
-    for (int k = 2; k < dim - 1; ++k) {
-        for (int j = 2; j < dim - 1; ++j) {
-            center        = (k - 1) * dim1 + j - 1;
-            lower         = center - dim1;
-            left          = center - 1;
-            right         = center + 1;
-            upper         = center + dim1;
-            y_val[center] = -x_val[lower] - x_val[left] + 4.0 * x_val[center] -
-                            x_val[right] - x_val[upper];
-        }
-    }
-
-    // lower boundary
-    for (int j = 2; j < dim - 1; ++j) {
-        center = j - 1;
-        left   = center - 1;
-        right  = center + 1;
-        upper  = center + dim1;
-        y_val[center] =
-            -x_val[left] + 4.0 * x_val[center] - x_val[right] - x_val[upper];
-    }
-
-    // upper boundary
-    for (int j = 2; j < dim - 1; ++j) {
-        center = (dim - 2) * dim1 + j - 1;
-        lower  = center - dim1;
-        left   = center - 1;
-        right  = center + 1;
-        y_val[center] =
-            -x_val[lower] - x_val[left] + 4.0 * x_val[center] - x_val[right];
-    }
-
-    // left boundary
-    for (int k = 2; k < dim - 1; ++k) {
-        center = (k - 1) * dim1;
-        lower  = center - dim1;
-        right  = center + 1;
-        upper  = center + dim1;
-        y_val[center] =
-            -x_val[lower] + 4.0 * x_val[center] - x_val[right] - x_val[upper];
-    }
-
-    // right boundary
-    for (int k = 2; k < dim - 1; ++k) {
-        center = (k - 1) * dim1 + dim - 2;
-        lower  = center - dim1;
-        left   = center - 1;
-        upper  = center + dim1;
-        y_val[center] =
-            -x_val[lower] - x_val[left] + 4.0 * x_val[center] - x_val[upper];
-    }
-
-    // left lower corner
-    center        = locate(1, 1);
-    right         = locate(1, 2);
-    upper         = locate(2, 1);
-    y_val[center] = 4.0 * x_val[center] - x_val[right] - x_val[upper];
-
-    // left upper corner
-    left          = locate(1, dim - 2);
-    center        = locate(1, dim - 1);
-    right         = locate(2, dim - 1);
-    y_val[center] = -x_val[left] + 4.0 * x_val[center] - x_val[right];
-
-    // right lower corner
-    lower         = locate(dim - 2, 1);
-    center        = locate(dim - 1, 1);
-    right         = locate(dim - 1, 2);
-    y_val[center] = -x_val[lower] + 4.0 * x_val[center] - x_val[right];
-
-    // right upper corner
-    lower         = locate(dim - 2, dim - 1);
-    left          = locate(dim - 1, dim - 2);
-    center        = locate(dim - 1, dim - 1);
-    y_val[center] = -x_val[lower] - x_val[left] + 4.0 * x_val[center];
-}
-
 int main(int argc, char *args[])
 {
     const int   numTotalMesh = 7; // number of meshes in total
@@ -207,8 +100,8 @@ int main(int argc, char *args[])
         b.SetValues((dim - 1) * (dim - 1), ptr);
         x.SetValues((dim - 1) * (dim - 1), 0.25);
 
-        // Create free-matrix object
-        MatFree matfree((dim - 1) * (dim - 1), (dim - 1) * (dim - 1));
+        // Create matrix-free 5-point stencil object
+        StencilOp<STENCIL_5P2D> matfree(dim - 1, dim - 1, 1, {-1.0, -1.0, 4.0, -1.0, -1.0});
 
         // Setup preconditioner parameters
         Identity pcd; // no preconditioning used
@@ -266,4 +159,5 @@ int main(int argc, char *args[])
 /*----------------------------------------------------------------------------*/
 /*  Kailei Zhang        Nov/19/2019      Create file                          */
 /*  Chensong Zhang      Sep/16/2021      Restructure file                     */
+/*  Chensong Zhang      Oct/19/2026      Use StencilOp for matrix-free Apply  */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -120,13 +120,28 @@ int main()
     // Reuse solver 
     solver.Setup(mat2);
     solver.Solve(vec2, x2);
-    solver.Clean();
 
     /**
      * exact solution (from octave): 0.221719 0.027149 0.058824
      */
     cout << "x2 : " << x2[0] << ", " << x2[1] << ", " << x2[2] << endl;
 
+    // Same sparsity pattern, new values: only redo the numeric factorization
+    mat2.Scale(2.0);
+    solver.Refactor(mat2);
+
+    // Solve for a block of right-hand sides with the same factorization
+    vector<VEC> rhs(2, vec2), sol(2, VEC(3));
+    rhs[1].Scale(2.0);
+    solver.Solve(rhs, sol);
+    solver.Clean();
+
+    /**
+     * exact solutions: half and the same as x2
+     */
+    cout << "x3 : " << sol[0][0] << ", " << sol[0][1] << ", " << sol[0][2] << endl;
+    cout << "x4 : " << sol[1][0] << ", " << sol[1][1] << ", " << sol[1][2] << endl;
+
     return 0;
 }
 
@@ -136,4 +151,5 @@ int main()
 /*  Author              Date             Actions                              */
 /*----------------------------------------------------------------------------*/
 /*  Chensong Zhang      Sep/17/2021      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Test refactoring and multiple RHS    */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -0,0 +1,272 @@
+/*! \file    BiCGStabL.cxx
+ *  \brief   Preconditioned BiCGStab(l) class definition
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <cmath>
+
+// FASPXX header files
+#include "BiCGStabL.hxx"
+#include "DenseLU.hxx"
+#include "Iter.hxx"
+
+/// Set the degree l of the minimal residual polynomial.
+void BiCGStabL::SetDegree(const USI l) { this->degree = l > 0 ? l : 1; }
+
+/// Allocate memory, setup coefficient matrix of the linear system.
+FaspRetCode BiCGStabL::Setup(const LOP& A)
+{
+    // Set solver type
+    SetSolType(SOLType::SOLVER_BICGSTABL);
+
+    // Allocate memory for temporary vectors
+    try {
+        len = A.GetColSize();
+        rh.assign(degree + 1, VEC(len, 0.0));
+        uh.assign(degree + 1, VEC(len, 0.0));
+        r0star.SetValues(len, 0.0);
+        yk.SetValues(len, 0.0);
+        zk.SetValues(len, 0.0);
+        safe.SetValues(len, 0.0);
+
+        gram.assign((degree + 1) * (degree + 1), 0.0);
+        gamma.assign(degree + 1, 0.0);
+        z11.assign(degree * degree, 0.0);
+        perm.assign(degree, 0);
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    // Setup the coefficient matrix
+    this->A = &A;
+
+    // Print used parameters
+    if (params.verbose > PRINT_MIN) PrintParam(std::cout);
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Clean up temp memory allocated for BiCGStab(l).
+void BiCGStabL::Clean()
+{
+    for (auto& v : rh) v.SetValues(len, 0.0);
+    for (auto& v : uh) v.SetValues(len, 0.0);
+    r0star.SetValues(len, 0.0);
+    yk.SetValues(len, 0.0);
+    zk.SetValues(len, 0.0);
+    safe.SetValues(len, 0.0);
+}
+
+/// out = A M^{-1} in, the operator of the right-preconditioned system.
+void BiCGStabL::ApplyPA(const VEC& in, VEC& out)
+{
+    zk.SetValues(len, 0.0);
+    pcd->Solve(in, zk);
+    A->Apply(zk, out);
+}
+
+/// Right-preconditioned BiCGStab(l). Don't check problem sizes.
+FaspRetCode BiCGStabL::Solve(const VEC& b, VEC& x)
+{
+    FaspRetCode errorCode = FaspRetCode::SUCCESS;
+
+    // Local variables
+    const USI l  = degree;
+    const USI ld = l + 1; // leading dimension of gram
+
+    USI    moreStep = 0;
+    double resAbs = 1.0, resRel = 1.0, denAbs = 1.0, ratio = 0.0, resAbsOld = 1.0;
+    double rho0 = 1.0, rho1, alpha = 0.0, omega = 1.0, beta, gam;
+    bool   converged = false;
+
+    PrintHead();
+
+    // Initialize iterative method
+    numIter = 0;
+    safe    = x;
+    A->Apply(x, rh[0]);  // A * x -> r
+    rh[0].XPAY(-1.0, b); // b - r -> r
+    resAbs = rh[0].Norm2();
+    denAbs = (CLOSE_ZERO > resAbs) ? CLOSE_ZERO : resAbs;
+
+    // Prepare for the main loop; x + M^{-1} y is the current iterate
+    r0star = rh[0];
+    uh[0].SetValues(len, 0.0);
+    yk.SetValues(len, 0.0);
+
+    // Main BiCGStab(l) loop
+    while (numIter < params.maxIter) {
+
+        // Start from minIter instead of 0
+        if (numIter == params.minIter) {
+            resRel    = resAbs / denAbs;
+            resAbsOld = resAbs;
+            if (resRel < params.relTol || resAbs < params.absTol) break;
+        }
+
+        //---------------------------------------------
+        // BiCG part: l steps
+        //---------------------------------------------
+        rho0 = -omega * rho0;
+        USI j;
+        for (j = 0; j < l && numIter < params.maxIter; ++j) {
+
+            if (numIter >= params.minIter) PrintInfo(numIter, resRel, resAbs, ratio);
+
+            ++numIter; // iteration count
+
+            rho1 = rh[j].Dot(r0star);
+            if (fabs(rho0) <= CLOSE_ZERO * CLOSE_ZERO) {
+                FASPXX_WARNING("Divided by zero!"); // Possible breakdown
+                errorCode = FaspRetCode::ERROR_DIVIDE_ZERO;
+                break;
+            }
+            beta = alpha * rho1 / rho0;
+            rho0 = rho1;
+
+            // u_i = r_i - beta * u_i
+            for (USI i = 0; i <= j; ++i) uh[i].XPAY(-beta, rh[i]);
+            ApplyPA(uh[j], uh[j + 1]);
+
+            gam = uh[j + 1].Dot(r0star);
+            if (fabs(gam) <= CLOSE_ZERO * CLOSE_ZERO) {
+                FASPXX_WARNING("Divided by zero!"); // Possible breakdown
+                errorCode = FaspRetCode::ERROR_DIVIDE_ZERO;
+                break;
+            }
+            alpha = rho0 / gam;
+
+            // r_i = r_i - alpha * u_{i+1}
+            for (USI i = 0; i <= j; ++i) rh[i].AXPY(-alpha, uh[i + 1]);
+            ApplyPA(rh[j], rh[j + 1]);
+            yk.AXPY(alpha, uh[0]);
+
+            resAbs    = rh[0].Norm2();
+            resRel    = resAbs / denAbs;
+            ratio     = resAbs / resAbsOld;
+            resAbsOld = resAbs;
+            converged = (resRel < params.relTol || resAbs < params.absTol) &&
+                        numIter >= params.minIter;
+            if (converged) break;
+        }
+
+        //---------------------------------------------
+        // MR part: minimize |r_0 - sum_j gamma_j r_j|
+        //---------------------------------------------
+        if (errorCode == FaspRetCode::SUCCESS && !converged && j == l) {
+            for (USI q = 0; q <= l; ++q)
+                for (USI p = 0; p <= q; ++p)
+                    gram[p + q * ld] = gram[q + p * ld] = rh[p].Dot(rh[q]);
+
+            // Solve z11 gamma = gram(1:l, 0); z11 is symmetric, so row-major too
+            for (USI q = 0; q < l; ++q)
+                for (USI p = 0; p < l; ++p) z11[p + q * l] = gram[p + 1 + (q + 1) * ld];
+            if (DenseLU::Factorize(l, l, z11.data(), perm.data(), CLOSE_ZERO) !=
+                FaspRetCode::SUCCESS) {
+                FASPXX_WARNING("Divided by zero!"); // Possible breakdown
+                errorCode = FaspRetCode::ERROR_DIVIDE_ZERO;
+            } else {
+                DenseLU::Substitute(l, z11.data(), perm.data(), &gram[1], gamma.data());
+                omega = gamma[l - 1];
+                for (USI q = 1; q <= l; ++q) {
+                    yk.AXPY(gamma[q - 1], rh[q - 1]);
+                    rh[0].AXPY(-gamma[q - 1], rh[q]);
+                    uh[0].AXPY(-gamma[q - 1], uh[q]);
+                }
+
+                resAbs = rh[0].Norm2();
+                resRel = resAbs / denAbs;
+                ratio  = resAbs / resAbsOld;
+
+                // Save the best solution so far
+                if (numIter >= params.savIter && resAbs < resAbsOld) {
+                    zk.SetValues(len, 0.0);
+                    pcd->Solve(yk, zk);
+                    safe = x;
+                    safe.AXPY(1.0, zk);
+                }
+                resAbsOld = resAbs;
+                converged = (resRel < params.relTol || resAbs < params.absTol) &&
+                            numIter >= params.minIter;
+            }
+        }
+        if (errorCode < 0 || numIter >= params.maxIter) break;
+
+        // Prevent false convergence
+        if (converged) {
+            // Form x and compute true residual r = b - Ax
+            zk.SetValues(len, 0.0);
+            pcd->Solve(yk, zk);
+            x.AXPY(1.0, zk);
+            yk.SetValues(len, 0.0);
+            A->Apply(x, rh[0]);
+            rh[0].XPAY(-1.0, b);
+
+            double resRelOld = resRel;
+            resAbs           = rh[0].Norm2();
+            resRel           = resAbs / denAbs;
+            if (resRel < params.relTol || resAbs < params.absTol) break;
+
+            if (params.verbose >= PRINT_MORE) {
+                FASPXX_WARNING("False convergence!");
+                WarnCompRes(resRelOld);
+                WarnRealRes(resRel);
+            }
+
+            if (moreStep >= params.restart) {
+                // Note: restart has different meaning here
+                if (params.verbose > PRINT_MIN)
+                    FASPXX_WARNING("The tolerance might be too small!");
+                errorCode = FaspRetCode::ERROR_SOLVER_TOLSMALL;
+                break;
+            }
+
+            // Restart from the true residual
+            uh[0].SetValues(len, 0.0);
+            rho0      = 1.0;
+            alpha     = 0.0;
+            omega     = 1.0;
+            converged = false;
+            ++moreStep;
+        }
+
+    } // End of main BiCGStab(l) loop
+
+    // Form the final iterate x + M^{-1} y
+    zk.SetValues(len, 0.0);
+    pcd->Solve(yk, zk);
+    x.AXPY(1.0, zk);
+
+    if (errorCode == FaspRetCode::SUCCESS && !converged &&
+        numIter >= params.maxIter && params.maxIter > params.minIter)
+        errorCode = FaspRetCode::ERROR_SOLVER_MAXIT;
+
+    // If minIter == numIter == maxIter (preconditioner only), skip this
+    if (!(numIter == params.minIter && numIter == params.maxIter)) {
+        this->norm2   = resAbs;
+        this->normInf = rh[0].NormInf();
+        PrintFinal(numIter, resRel, resAbs, ratio);
+    }
+
+    // Restore the saved best iteration if needed
+    if (numIter > params.savIter) x = safe;
+
+    return errorCode;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Allocate z11 in Setup                */
+/*  Chensong Zhang      Oct/19/2026      Solve z11 with the DenseLU kernels   */
+/*----------------------------------------------------------------------------*/
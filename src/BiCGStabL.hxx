@@ -0,0 +1,97 @@
+/*! \file    BiCGStabL.hxx
+ *  \brief   Preconditioned BiCGStab(l) class declaration
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+/*! Important Note:
+ *-----------------------------------------------------------------------------------
+ *  BiCGStab(l) (Sleijpen and Fokkema 1993) takes l BiCG steps and then minimizes
+ *  the residual over a polynomial of degree l, instead of degree 1 as in BiCGStab.
+ *  The degree-1 polynomial of BiCGStab has real roots only and stagnates when A
+ *  has eigenvalues with large imaginary parts, as in convection-dominated problems;
+ *  already l = 2 repairs this. The minimal residual polynomial is computed from the
+ *  Gram matrix of the l+1 residuals, so all inner products of a cycle are formed
+ *  together. The storage is 2l + 6 vectors.
+ *
+ *  Preconditioning is from the right, so the residual is that of the original
+ *  system. One iteration is one BiCG step with two matrix-vector products, as in
+ *  BiCGStab.
+ */
+
+#ifndef __BICGSTABL_HEADER__ /*-- allow multiple inclusions --*/
+#define __BICGSTABL_HEADER__ /**< indicate BiCGStabL.hxx has been included before */
+
+// Standard header files
+#include <vector>
+
+// FASPXX header files
+#include "ErrorLog.hxx"
+#include "LOP.hxx"
+#include "SOL.hxx"
+
+/*! \class BiCGStabL
+ *  \brief Right-preconditioned BiCGStab(l) method.
+ */
+class BiCGStabL : public SOL
+{
+private:
+    USI              len;    ///< dimension of the solution vector
+    USI              degree; ///< degree l of the minimal residual polynomial
+    std::vector<VEC> rh;     ///< residuals r, AM^{-1} r, ..., (AM^{-1})^l r
+    std::vector<VEC> uh;     ///< search directions u, AM^{-1} u, ..., (AM^{-1})^l u
+    VEC              r0star; ///< Work vector for shadow residual
+    VEC              yk;     ///< Work vector for update before preconditioning
+    VEC              zk;     ///< Work vector for preconditioned vector
+    VEC              safe;   ///< Work vector for safe-guard
+
+    std::vector<DBL> gram;  ///< Gram matrix of the residuals, column by column
+    std::vector<DBL> gamma; ///< coefficients of the minimal residual polynomial
+    std::vector<DBL> z11;   ///< trailing l x l block of gram, overwritten by LU
+    std::vector<USI> perm;  ///< row permutation of the LU of z11
+
+    /// out = A M^{-1} in, the operator of the right-preconditioned system.
+    void ApplyPA(const VEC& in, VEC& out);
+
+public:
+    /// Default constructor.
+    BiCGStabL()
+        : len(0)
+        , degree(2)
+        , r0star(0)
+        , yk(0)
+        , zk(0)
+        , safe(0){};
+
+    /// Default destructor.
+    ~BiCGStabL() = default;
+
+    /// Set the degree l of the minimal residual polynomial.
+    void SetDegree(USI l);
+
+    /// Setup the BiCGStab(l) method.
+    FaspRetCode Setup(const LOP& A) override;
+
+    /// Solve Ax=b using the BiCGStab(l) method.
+    FaspRetCode Solve(const VEC& b, VEC& x) override;
+
+    /// Clean up BiCGStab(l) data allocated during Setup.
+    void Clean() override;
+};
+
+#endif /* end if for __BICGSTABL_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Allocate z11 in Setup                */
+/*  Chensong Zhang      Oct/19/2026      Solve z11 with the DenseLU kernels   */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,394 @@
+/*! \file    BinData.cxx
+ *  \brief   Binary container for MAT and VEC with zero-copy loading
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+
+#ifndef _MSC_VER
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// FASPXX header files
+#include "BinData.hxx"
+
+/// File signature of the binary container.
+static const char BIN_MAGIC[8] = {'F', 'A', 'S', 'P', 'X', 'X', 'B', '\0'};
+
+/// Byte order tag written in the header.
+static const uint32_t BIN_ENDIAN = 0x01020304;
+
+/// Number of bytes hashed independently before combining.
+static const uint64_t BIN_HASH_BLOCK = 1 << 20;
+
+/// Round up to the next multiple of BIN_ALIGN.
+static uint64_t BinAlign(uint64_t pos)
+{
+    return (pos + BIN_ALIGN - 1) / BIN_ALIGN * BIN_ALIGN;
+}
+
+/// Hash one block of memory with 64-bit words (FNV-1a style mixing).
+static uint64_t HashBlock(const char* p, uint64_t len, uint64_t h)
+{
+    const uint64_t prime = 0x100000001b3ULL;
+    uint64_t       w;
+    for (; len >= 8; p += 8, len -= 8) {
+        std::memcpy(&w, p, 8);
+        h = (h ^ w) * prime;
+        h ^= h >> 29;
+    }
+    for (; len > 0; ++p, --len) h = (h ^ (unsigned char)*p) * prime;
+    return h;
+}
+
+/// Checksum of a block of memory; blocks are hashed in parallel and then combined.
+uint64_t BinChecksum(const void* data, uint64_t len)
+{
+    const char* p         = static_cast<const char*>(data);
+    const INT   numBlocks = (len + BIN_HASH_BLOCK - 1) / BIN_HASH_BLOCK;
+
+    std::vector<uint64_t> hash(numBlocks);
+    INT                   k;
+#pragma omp parallel for private(k)
+    for (k = 0; k < numBlocks; ++k) {
+        const uint64_t begin = k * BIN_HASH_BLOCK;
+        const uint64_t size  = std::min(BIN_HASH_BLOCK, len - begin);
+        hash[k]              = HashBlock(p + begin, size, 0xcbf29ce484222325ULL);
+    }
+
+    return HashBlock(reinterpret_cast<const char*>(hash.data()),
+                     numBlocks * sizeof(uint64_t), 0xcbf29ce484222325ULL ^ len);
+}
+
+/// Write the header and the given sections to a binary file.
+static FaspRetCode WriteBin(const char* filename, BinHeader& header,
+                            const void* const* sections, uint32_t numSec)
+{
+    std::memcpy(header.magic, BIN_MAGIC, sizeof(BIN_MAGIC));
+    header.version = BIN_VERSION;
+    header.endian  = BIN_ENDIAN;
+    header.intSize = sizeof(USI);
+    header.dblSize = sizeof(DBL);
+
+    // Lay out the sections and compute their checksums
+    uint64_t pos = BinAlign(sizeof(BinHeader));
+    for (uint32_t sec = 0; sec < numSec; ++sec) {
+        header.offset[sec]   = pos;
+        header.checksum[sec] = BinChecksum(sections[sec], header.length[sec]);
+        pos                  = BinAlign(pos + header.length[sec]);
+    }
+    header.headerChecksum = BinChecksum(&header, offsetof(BinHeader, headerChecksum));
+
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) return FaspRetCode::ERROR_OPEN_FILE;
+
+    const char zeros[BIN_ALIGN] = {0};
+    out.write(reinterpret_cast<const char*>(&header), sizeof(BinHeader));
+    pos = sizeof(BinHeader);
+    for (uint32_t sec = 0; sec < numSec; ++sec) {
+        out.write(zeros, header.offset[sec] - pos); // alignment padding
+        out.write(static_cast<const char*>(sections[sec]), header.length[sec]);
+        pos = header.offset[sec] + header.length[sec];
+    }
+    out.write(zeros, BinAlign(pos) - pos);
+
+    if (!out.good()) return FaspRetCode::ERROR_OPEN_FILE;
+    return FaspRetCode::SUCCESS;
+}
+
+/// Write a MAT to a binary file: rowPtr, colInd, values, and diagPtr.
+FaspRetCode WriteBinMAT(const char* filename, const MAT& mat)
+{
+    BinHeader header = {};
+    header.kind      = BIN_MAT;
+    header.nrow      = mat.nrow;
+    header.mcol      = mat.mcol;
+    header.nnz       = mat.nnz;
+    header.length[0] = mat.rowPtr.size() * sizeof(USI);
+    header.length[1] = mat.colInd.size() * sizeof(USI);
+    header.length[2] = mat.values.size() * sizeof(DBL);
+    header.length[3] = mat.diagPtr.size() * sizeof(USI);
+
+    const void* sections[4] = {mat.rowPtr.data(), mat.colInd.data(),
+                               mat.values.data(), mat.diagPtr.data()};
+    return WriteBin(filename, header, sections, 4);
+}
+
+/// Write a VEC to a binary file.
+FaspRetCode WriteBinVEC(const char* filename, const VEC& vec)
+{
+    const DBL* val;
+    vec.GetArray(&val);
+
+    BinHeader header = {};
+    header.kind      = BIN_VEC;
+    header.nrow      = vec.GetSize();
+    header.mcol      = 1;
+    header.nnz       = vec.GetSize();
+    header.length[0] = vec.GetSize() * sizeof(DBL);
+
+    const void* sections[1] = {val};
+    return WriteBin(filename, header, sections, 1);
+}
+
+/// Read a binary MAT file and copy it into a MAT.
+FaspRetCode ReadBinMAT(const char* filename, MAT& dst, bool verify)
+{
+    MATMap      map;
+    FaspRetCode retCode = map.Open(filename, verify);
+    if (retCode < 0) return retCode;
+
+    try {
+        map.CopyTo(dst);
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Read a binary VEC file and copy it into a VEC.
+FaspRetCode ReadBinVEC(const char* filename, VEC& dst, bool verify)
+{
+    BinMap      map;
+    FaspRetCode retCode = map.Open(filename, BIN_VEC, verify);
+    if (retCode < 0) return retCode;
+
+    const BinHeader* header = map.GetHeader();
+    if (header->length[0] != header->nrow * sizeof(DBL))
+        return FaspRetCode::ERROR_INPUT_FILE;
+
+    try {
+        dst.SetValues(std::vector<DBL>(
+            static_cast<const DBL*>(map.GetSection(0)),
+            static_cast<const DBL*>(map.GetSection(0)) + header->nrow));
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Unmap the file.
+BinMap::~BinMap() { Close(); }
+
+/// Map a binary file read-only and shared, then check the header.
+FaspRetCode BinMap::Open(const char* filename, uint32_t kind, bool verify)
+{
+    Close();
+
+    std::cout << "Reading from disk file " << filename << std::endl;
+#ifdef _MSC_VER
+    std::ifstream in(filename, std::ios::binary);
+    if (!in.is_open()) return FaspRetCode::ERROR_OPEN_FILE;
+    in.seekg(0, std::ios::end);
+    size = in.tellg();
+    in.seekg(0, std::ios::beg);
+    try {
+        copy.resize((size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+    in.read(reinterpret_cast<char*>(copy.data()), size);
+    data = reinterpret_cast<const char*>(copy.data());
+#else
+    const int fd = open(filename, O_RDONLY);
+    if (fd < 0) return FaspRetCode::ERROR_OPEN_FILE;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (uint64_t)st.st_size < sizeof(BinHeader)) {
+        close(fd);
+        return FaspRetCode::ERROR_INPUT_FILE;
+    }
+    size      = st.st_size;
+    void* ptr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd); // the mapping stays valid after closing the descriptor
+    if (ptr == MAP_FAILED) {
+        size = 0;
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+    data = static_cast<const char*>(ptr);
+#endif
+
+    // Check the header before touching any data section
+    header = reinterpret_cast<const BinHeader*>(data);
+    bool ok = size >= sizeof(BinHeader) &&
+              std::memcmp(header->magic, BIN_MAGIC, sizeof(BIN_MAGIC)) == 0 &&
+              header->version == BIN_VERSION && header->kind == kind &&
+              header->endian == BIN_ENDIAN && header->intSize == sizeof(USI) &&
+              header->dblSize == sizeof(DBL) &&
+              header->headerChecksum ==
+                  BinChecksum(header, offsetof(BinHeader, headerChecksum));
+    for (uint32_t sec = 0; ok && sec < BIN_MAX_SEC; ++sec) {
+        ok = header->offset[sec] % BIN_ALIGN == 0 && header->offset[sec] <= size &&
+             header->length[sec] <= size - header->offset[sec];
+        if (ok && verify && header->length[sec] > 0)
+            ok = header->checksum[sec] ==
+                 BinChecksum(data + header->offset[sec], header->length[sec]);
+    }
+    if (!ok) {
+        Close();
+        return FaspRetCode::ERROR_INPUT_FILE;
+    }
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Unmap the file.
+void BinMap::Close()
+{
+#ifndef _MSC_VER
+    if (data != nullptr) munmap(const_cast<char*>(data), size);
+#endif
+    std::vector<uint64_t>().swap(copy);
+    data   = nullptr;
+    size   = 0;
+    header = nullptr;
+}
+
+/// Get the header of the mapped file.
+const BinHeader* BinMap::GetHeader() const { return header; }
+
+/// Get the beginning of a data section.
+const void* BinMap::GetSection(uint32_t sec) const
+{
+    return data + header->offset[sec];
+}
+
+/// Map a binary MAT file and set pointers to the CSRx arrays in place.
+FaspRetCode MATMap::Open(const char* filename, bool verify)
+{
+    Close();
+
+    FaspRetCode retCode = file.Open(filename, BIN_MAT, verify);
+    if (retCode < 0) return retCode;
+
+    // Check that the sections match the CSRx sizes
+    const BinHeader* header = file.GetHeader();
+    if (header->nrow == 0) return FaspRetCode::SUCCESS; // empty matrix
+    if (header->length[0] != (header->nrow + 1) * sizeof(USI) ||
+        header->length[1] != header->nnz * sizeof(USI) ||
+        header->length[2] != header->nnz * sizeof(DBL) ||
+        header->length[3] != header->nrow * sizeof(USI)) {
+        file.Close();
+        return FaspRetCode::ERROR_INPUT_FILE;
+    }
+
+    rowPtr  = static_cast<const USI*>(file.GetSection(0));
+    colInd  = static_cast<const USI*>(file.GetSection(1));
+    values  = static_cast<const DBL*>(file.GetSection(2));
+    diagPtr = static_cast<const USI*>(file.GetSection(3));
+    if (rowPtr[0] != 0 || rowPtr[header->nrow] != header->nnz) {
+        Close();
+        return FaspRetCode::ERROR_MAT_DATA;
+    }
+
+    nrow = header->nrow;
+    mcol = header->mcol;
+    nnz  = header->nnz;
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Unmap the file.
+void MATMap::Close()
+{
+    file.Close();
+    nrow    = 0;
+    mcol    = 0;
+    nnz     = 0;
+    values  = nullptr;
+    colInd  = nullptr;
+    rowPtr  = nullptr;
+    diagPtr = nullptr;
+}
+
+/// Return this->nnz.
+USI MATMap::GetNNZ() const { return nnz; }
+
+/// Get the values of the matrix, in place.
+const DBL* MATMap::GetValuesArray() const { return values; }
+
+/// Get the column indices of the matrix, in place.
+const USI* MATMap::GetColIndArray() const { return colInd; }
+
+/// Get the row pointer of the matrix, in place.
+const USI* MATMap::GetRowPtrArray() const { return rowPtr; }
+
+/// Get the diagonal pointer of the matrix, in place.
+const USI* MATMap::GetDiagPtrArray() const { return diagPtr; }
+
+/// Get the diagonal entries and save them in a VEC object.
+void MATMap::GetDiag(VEC& v) const
+{
+    v.SetValues(nrow, 0.0);
+    for (USI i = 0; i < nrow; ++i) v[i] = values[diagPtr[i]];
+}
+
+/// Copy the matrix to a regular MAT object.
+void MATMap::CopyTo(MAT& mat) const
+{
+    if (nrow == 0) {
+        mat = MAT();
+        return;
+    }
+    mat.SetValues(nrow, mcol, nnz, std::vector<DBL>(values, values + nnz),
+                  std::vector<USI>(colInd, colInd + nnz),
+                  std::vector<USI>(rowPtr, rowPtr + nrow + 1),
+                  std::vector<USI>(diagPtr, diagPtr + nrow));
+}
+
+/// Sparse matrix-vector multiplication with the mapped arrays.
+void MATMap::Apply(const VEC& v, VEC& w) const
+{
+    const DBL* x;
+    DBL*       y;
+    v.GetArray(&x);
+    w.GetArray(&y);
+
+    INT i;
+#pragma omp parallel for private(i)
+    for (i = 0; i < (INT)nrow; ++i) {
+        DBL sum = 0.0;
+        for (USI k = rowPtr[i]; k < rowPtr[i + 1]; ++k) sum += values[k] * x[colInd[k]];
+        y[i] = sum;
+    }
+}
+
+/// Residual r = b - Ax with the mapped arrays.
+void MATMap::Residual(const VEC& b, const VEC& x, VEC& r) const
+{
+    const DBL *bv, *xv;
+    DBL*       rv;
+    b.GetArray(&bv);
+    x.GetArray(&xv);
+    r.GetArray(&rv);
+
+    INT i;
+#pragma omp parallel for private(i)
+    for (i = 0; i < (INT)nrow; ++i) {
+        DBL sum = bv[i];
+        for (USI k = rowPtr[i]; k < rowPtr[i + 1]; ++k) sum -= values[k] * xv[colInd[k]];
+        rv[i] = sum;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,187 @@
+/*! \file    BinData.hxx
+ *  \brief   Binary container for MAT and VEC with zero-copy loading
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+/*! Important Note:
+ *-----------------------------------------------------------------------------------
+ *  A binary file starts with a fixed-size BinHeader, followed by the data sections
+ *  in the order of the section table. For a MAT, the sections are the CSRx arrays
+ *  rowPtr, colInd, values, and diagPtr; for a VEC, there is only one section holding
+ *  the values. Each section starts at an offset aligned to BIN_ALIGN bytes, so that
+ *  the mapped arrays can be used in place, and carries its own checksum.
+ *
+ *  The arrays are stored in the native byte order and native sizes of USI and DBL;
+ *  the header records both and a file written on another platform is rejected.
+ */
+
+#ifndef __BINDATA_HEADER__ /*-- allow multiple inclusions --*/
+#define __BINDATA_HEADER__ /**< indicate BinData.hxx has been included before */
+
+// Standard header files
+#include <cstdint>
+#include <vector>
+
+// FASPXX header files
+#include "ErrorLog.hxx"
+#include "MAT.hxx"
+#include "VEC.hxx"
+
+const uint32_t BIN_VERSION = 1;  ///< version of the binary container
+const uint64_t BIN_ALIGN   = 64; ///< alignment of data sections in bytes
+const uint32_t BIN_MAT     = 1;  ///< binary file holding a MAT
+const uint32_t BIN_VEC     = 2;  ///< binary file holding a VEC
+const uint32_t BIN_MAX_SEC = 4;  ///< maximal number of data sections
+
+/// Header of a binary data file.
+struct BinHeader {
+    char     magic[8];              ///< file signature "FASPXXB"
+    uint32_t version;               ///< version of the container
+    uint32_t kind;                  ///< BIN_MAT or BIN_VEC
+    uint32_t endian;                ///< byte order tag 0x01020304
+    uint16_t intSize;               ///< sizeof(USI) when written
+    uint16_t dblSize;               ///< sizeof(DBL) when written
+    uint64_t nrow;                  ///< number of rows, or length of a VEC
+    uint64_t mcol;                  ///< number of columns
+    uint64_t nnz;                   ///< number of nonzeros
+    uint64_t offset[BIN_MAX_SEC];   ///< byte offset of each section
+    uint64_t length[BIN_MAX_SEC];   ///< byte length of each section
+    uint64_t checksum[BIN_MAX_SEC]; ///< checksum of each section
+    uint64_t headerChecksum;        ///< checksum of all fields above
+};
+
+/// Checksum of a block of memory.
+uint64_t BinChecksum(const void* data, uint64_t len);
+
+/// Write a MAT to a binary file.
+FaspRetCode WriteBinMAT(const char* filename, const MAT& mat);
+
+/// Write a VEC to a binary file.
+FaspRetCode WriteBinVEC(const char* filename, const VEC& vec);
+
+/// Read a binary MAT file and copy it into a MAT.
+FaspRetCode ReadBinMAT(const char* filename, MAT& dst, bool verify = true);
+
+/// Read a binary VEC file and copy it into a VEC.
+FaspRetCode ReadBinVEC(const char* filename, VEC& dst, bool verify = true);
+
+/*! \class BinMap
+ *  \brief Read-only memory map of a binary data file.
+ *
+ *  The file is mapped shared, so all processes mapping the same file use one copy
+ *  of it in the page cache. Nothing is parsed or copied when the file is opened.
+ */
+class BinMap
+{
+private:
+    const char*           data;   ///< beginning of the mapped file
+    uint64_t              size;   ///< size of the mapped file in bytes
+    const BinHeader*      header; ///< header of the mapped file
+    std::vector<uint64_t> copy;   ///< file content if mmap is not available
+
+public:
+    /// Default constructor.
+    BinMap()
+        : data(nullptr)
+        , size(0)
+        , header(nullptr){};
+
+    /// Mapped files cannot be copied.
+    BinMap(const BinMap&) = delete;
+
+    /// Mapped files cannot be copied.
+    BinMap& operator=(const BinMap&) = delete;
+
+    /// Unmap the file.
+    ~BinMap();
+
+    /// Map a binary file and check its header; verify section checksums if asked.
+    FaspRetCode Open(const char* filename, uint32_t kind, bool verify = true);
+
+    /// Unmap the file.
+    void Close();
+
+    /// Get the header of the mapped file.
+    const BinHeader* GetHeader() const;
+
+    /// Get the beginning of a data section.
+    const void* GetSection(uint32_t sec) const;
+};
+
+/*! \class MATMap
+ *  \brief Sparse matrix in the CSRx format living in a mapped binary file.
+ *
+ *  It behaves like a read-only MAT: the arrays are used in place from the page
+ *  cache. Use CopyTo to get a regular MAT if the matrix has to be modified.
+ */
+class MATMap : public LOP
+{
+private:
+    BinMap     file;    ///< the mapped binary file
+    USI        nnz;     ///< number of nonzeros of the matrix
+    const DBL* values;  ///< nonzero entries, compressed row by row
+    const USI* colInd;  ///< column indices of the nonzero in values
+    const USI* rowPtr;  ///< pointers to the beginning of each row in values
+    const USI* diagPtr; ///< pointers to diagonal entries in values
+
+public:
+    /// Default constructor.
+    MATMap()
+        : nnz(0)
+        , values(nullptr)
+        , colInd(nullptr)
+        , rowPtr(nullptr)
+        , diagPtr(nullptr){};
+
+    /// Default destructor.
+    ~MATMap() = default;
+
+    /// Map a binary MAT file.
+    FaspRetCode Open(const char* filename, bool verify = true);
+
+    /// Unmap the file.
+    void Close();
+
+    /// Get number of nonzeros of the matrix.
+    USI GetNNZ() const;
+
+    /// Get the values of the matrix, in place.
+    const DBL* GetValuesArray() const;
+
+    /// Get the column indices of the matrix, in place.
+    const USI* GetColIndArray() const;
+
+    /// Get the row pointer of the matrix, in place.
+    const USI* GetRowPtrArray() const;
+
+    /// Get the diagonal pointer of the matrix, in place.
+    const USI* GetDiagPtrArray() const;
+
+    /// Get the diagonal entries and save them in a VEC object.
+    void GetDiag(VEC& v) const;
+
+    /// Copy the matrix to a regular MAT object.
+    void CopyTo(MAT& mat) const;
+
+    /// Sparse matrix-vector multiplication.
+    void Apply(const VEC& v, VEC& w) const override;
+
+    /// Residual b - Ax.
+    void Residual(const VEC& b, const VEC& x, VEC& r) const override;
+};
+
+#endif /* end if for __BINDATA_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,203 @@
+/*! \file    Compress.cxx
+ *  \brief   Simple LZ-style block compression for data files
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <cstdint>
+#include <cstring>
+
+// FASPXX header files
+#include "Compress.hxx"
+
+/// Signature of a compressed file.
+static const char LZ_MAGIC[LZ_MAGIC_SIZE] = {'F', 'A', 'S', 'P', 'X', 'X', 'Z', '\0'};
+
+static const unsigned LZ_HASH_BITS = 14;    ///< size of the match finder table
+static const uint32_t LZ_MIN_MATCH = 4;     ///< minimal length of a match
+static const uint32_t LZ_MAX_DIST  = 65535; ///< maximal offset of a match
+static const uint32_t LZ_TAIL      = 8;     ///< bytes at the end kept as literals
+
+/// Read 4 bytes without alignment requirement.
+static uint32_t Read32(const char* p)
+{
+    uint32_t v;
+    std::memcpy(&v, p, 4);
+    return v;
+}
+
+/// Append a length in the 255-chain encoding used for long literals and matches.
+static void PutLength(uint32_t len, std::vector<char>& dst)
+{
+    for (; len >= 255; len -= 255) dst.push_back((char)255);
+    dst.push_back((char)len);
+}
+
+/// Append one sequence: literals followed by an optional match.
+static void PutSequence(const char* lit, uint32_t litLen, uint32_t offset,
+                        uint32_t matchLen, std::vector<char>& dst)
+{
+    const uint32_t m     = (matchLen > 0) ? matchLen - LZ_MIN_MATCH : 0;
+    const char     token = (char)(((litLen < 15 ? litLen : 15) << 4) | (m < 15 ? m : 15));
+    dst.push_back(token);
+    if (litLen >= 15) PutLength(litLen - 15, dst);
+    dst.insert(dst.end(), lit, lit + litLen);
+    if (matchLen == 0) return; // last sequence of the block
+
+    dst.push_back((char)(offset & 0xff));
+    dst.push_back((char)(offset >> 8));
+    if (m >= 15) PutLength(m - 15, dst);
+}
+
+/// Append the signature of a compressed file to dst.
+void LZWriteMagic(std::vector<char>& dst)
+{
+    dst.insert(dst.end(), LZ_MAGIC, LZ_MAGIC + LZ_MAGIC_SIZE);
+}
+
+/// Check whether a buffer starts with the signature of a compressed file.
+bool LZIsCompressed(const char* src, size_t len)
+{
+    return len >= LZ_MAGIC_SIZE && std::memcmp(src, LZ_MAGIC, LZ_MAGIC_SIZE) == 0;
+}
+
+/// Compress one block with a greedy hash-table match finder.
+void LZCompressBlock(const char* src, size_t len, std::vector<char>& dst)
+{
+    const size_t head = dst.size();
+    dst.resize(head + 8); // block header, filled in below
+
+    std::vector<int64_t> table(1 << LZ_HASH_BITS, -1);
+    size_t               anchor = 0, i = 0;
+    while (i + LZ_TAIL < len) {
+        const uint32_t seq  = Read32(src + i);
+        const uint32_t hash = (seq * 2654435761U) >> (32 - LZ_HASH_BITS);
+        const int64_t  cand = table[hash];
+        table[hash]         = i;
+
+        if (cand < 0 || i - cand > LZ_MAX_DIST || Read32(src + cand) != seq) {
+            ++i;
+            continue;
+        }
+
+        // Extend the match as far as possible
+        size_t matchLen = LZ_MIN_MATCH;
+        while (i + matchLen + LZ_TAIL < len && src[cand + matchLen] == src[i + matchLen])
+            ++matchLen;
+
+        PutSequence(src + anchor, i - anchor, i - cand, matchLen, dst);
+        i += matchLen;
+        anchor = i;
+    }
+    PutSequence(src + anchor, len - anchor, 0, 0, dst);
+
+    // Store the block as it is if it does not get smaller
+    uint32_t sizes[2] = {(uint32_t)len, (uint32_t)(dst.size() - head - 8)};
+    if (sizes[1] >= len) {
+        dst.resize(head + 8);
+        dst.insert(dst.end(), src, src + len);
+        sizes[1] = len;
+    }
+    std::memcpy(dst.data() + head, sizes, 8);
+}
+
+/// Decompress one block of LZ tokens; return false if the data is corrupted.
+static bool DecompressBlock(const char* src, size_t len, char* dst, size_t rawLen)
+{
+    const unsigned char* ip   = reinterpret_cast<const unsigned char*>(src);
+    const unsigned char* iend = ip + len;
+    size_t               op   = 0;
+
+    auto getLength = [&](uint32_t& n) {
+        unsigned char c;
+        do {
+            if (ip >= iend) return false;
+            c = *ip++;
+            n += c;
+        } while (c == 255);
+        return true;
+    };
+
+    while (ip < iend) {
+        const unsigned char token  = *ip++;
+        uint32_t            litLen = token >> 4;
+        if (litLen == 15 && !getLength(litLen)) return false;
+        if ((size_t)(iend - ip) < litLen || rawLen - op < litLen) return false;
+        std::memcpy(dst + op, ip, litLen);
+        ip += litLen;
+        op += litLen;
+        if (ip == iend) break; // last sequence has no match
+
+        if (iend - ip < 2) return false;
+        const uint32_t offset   = ip[0] | (ip[1] << 8);
+        uint32_t       matchLen = token & 15;
+        ip += 2;
+        if (matchLen == 15 && !getLength(matchLen)) return false;
+        matchLen += LZ_MIN_MATCH;
+        if (offset == 0 || offset > op || rawLen - op < matchLen) return false;
+        for (uint32_t k = 0; k < matchLen; ++k, ++op) dst[op] = dst[op - offset];
+    }
+
+    return op == rawLen;
+}
+
+/// Decompress a whole compressed file; blocks are decompressed in parallel.
+FaspRetCode LZDecompress(const char* src, size_t len, std::vector<char>& dst)
+{
+    if (!LZIsCompressed(src, len)) return FaspRetCode::ERROR_INPUT_FILE;
+
+    // Locate all blocks first
+    std::vector<size_t>   inPos, outPos(1, 0);
+    std::vector<uint32_t> inLen;
+    for (size_t pos = LZ_MAGIC_SIZE; pos < len;) {
+        uint32_t sizes[2];
+        if (len - pos < 8) return FaspRetCode::ERROR_INPUT_FILE;
+        std::memcpy(sizes, src + pos, 8);
+        pos += 8;
+        if (len - pos < sizes[1]) return FaspRetCode::ERROR_INPUT_FILE;
+        inPos.push_back(pos);
+        inLen.push_back(sizes[1]);
+        outPos.push_back(outPos.back() + sizes[0]);
+        pos += sizes[1];
+    }
+
+    try {
+        dst.resize(outPos.back());
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    const INT numBlocks = inPos.size();
+    bool      ok        = true;
+    INT       b;
+#pragma omp parallel for private(b) schedule(dynamic)
+    for (b = 0; b < numBlocks; ++b) {
+        const size_t rawLen = outPos[b + 1] - outPos[b];
+        bool         good   = true;
+        if (inLen[b] == rawLen)
+            std::memcpy(dst.data() + outPos[b], src + inPos[b], rawLen);
+        else
+            good = DecompressBlock(src + inPos[b], inLen[b], dst.data() + outPos[b],
+                                   rawLen);
+        if (!good) {
+#pragma omp critical
+            ok = false;
+        }
+    }
+
+    return ok ? FaspRetCode::SUCCESS : FaspRetCode::ERROR_INPUT_FILE;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,59 @@
+/*! \file    Compress.hxx
+ *  \brief   Simple LZ-style block compression for data files
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+/*! Important Note:
+ *-----------------------------------------------------------------------------------
+ *  A compressed file starts with the 8-byte signature "FASPXXZ" and is followed by
+ *  independent blocks, so that blocks can be compressed and decompressed in
+ *  parallel. Each block has a header of two 32-bit integers, the raw size and the
+ *  stored size, followed by the stored bytes. If both sizes are equal, the block is
+ *  stored as it is; otherwise it is a sequence of LZ77 tokens in the LZ4 style:
+ *
+ *      token (literal length : 4 bits, match length - 4 : 4 bits),
+ *      [extra literal length bytes], literals, 16-bit offset, [extra match bytes].
+ *
+ *  The last sequence of a block only has literals.
+ */
+
+#ifndef __COMPRESS_HEADER__ /*-- allow multiple inclusions --*/
+#define __COMPRESS_HEADER__ /**< indicate Compress.hxx has been included before */
+
+// Standard header files
+#include <cstddef>
+#include <vector>
+
+// FASPXX header files
+#include "RetCode.hxx"
+
+/// Size of the signature of a compressed file.
+const size_t LZ_MAGIC_SIZE = 8;
+
+/// Append the signature of a compressed file to dst.
+void LZWriteMagic(std::vector<char>& dst);
+
+/// Check whether a buffer starts with the signature of a compressed file.
+bool LZIsCompressed(const char* src, size_t len);
+
+/// Compress one block and append it, with its header, to dst.
+void LZCompressBlock(const char* src, size_t len, std::vector<char>& dst);
+
+/// Decompress a whole compressed file (signature included) into dst.
+FaspRetCode LZDecompress(const char* src, size_t len, std::vector<char>& dst);
+
+#endif /* end if for __COMPRESS_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,340 @@
+/*! \file    DCG.cxx
+ *  \brief   Deflated preconditioned CG class definition
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+// FASPXX header files
+#include "DCG.hxx"
+#include "DenseUtil.hxx"
+
+/// Set the number of deflation vectors and of search directions kept.
+void DCG::SetNumDeflate(const USI k, const USI l)
+{
+    this->numDeflate = k;
+    this->numStore   = l;
+}
+
+/// Get the dimension of the current deflation space.
+USI DCG::GetNumDeflated() const { return numDeflated; }
+
+/// Allocate memory, setup coefficient matrix of the linear system.
+FaspRetCode DCG::Setup(const LOP& A)
+{
+    // Set solver type
+    SetSolType(SOLType::SOLVER_DCG);
+
+    // The deflation space survives a new Setup with a matrix of the same size
+    const USI newLen = A.GetColSize();
+    if (newLen != len || W.GetNumVecs() != numDeflate) numDeflated = 0;
+    len = newLen;
+
+    // Allocate memory for temporary vectors
+    try {
+        zk.SetValues(len, 0.0);
+        pk.SetValues(len, 0.0);
+        rk.SetValues(len, 0.0);
+        ax.SetValues(len, 0.0);
+        safe.SetValues(len, 0.0);
+
+        alphas.assign(numStore, 0.0);
+        rhos.assign(numStore + 1, 0.0);
+        hist.assign((numStore + 1) * numDeflate, 0.0);
+        mu.assign(numDeflate, 0.0);
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    // Allocate memory for the deflation space and the kept search directions
+    FaspRetCode retCode = FaspRetCode::SUCCESS;
+    if (numDeflated == 0) retCode = W.Allocate(len, numDeflate);
+    if (retCode == FaspRetCode::SUCCESS) retCode = AW.Allocate(len, numDeflate);
+    if (retCode == FaspRetCode::SUCCESS) retCode = Wnew.Allocate(len, numDeflate);
+    if (retCode == FaspRetCode::SUCCESS) retCode = P.Allocate(len, numStore);
+    if (retCode != FaspRetCode::SUCCESS) return retCode;
+    numStored = 0;
+
+    // Setup the coefficient matrix
+    this->A = &A;
+
+    // Print used parameters
+    if (params.verbose > PRINT_MIN) PrintParam(std::cout);
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Clean up work data and forget the deflation space.
+void DCG::Clean()
+{
+    numDeflated = 0;
+    numStored   = 0;
+
+    zk.SetValues(len, 0.0);
+    pk.SetValues(len, 0.0);
+    rk.SetValues(len, 0.0);
+    ax.SetValues(len, 0.0);
+    safe.SetValues(len, 0.0);
+}
+
+/// Make W A-orthonormal for the current A and compute AW.
+void DCG::RefreshDeflation()
+{
+    // Gram-Schmidt twice in the A-inner product; drop dependent vectors
+    USI kk = 0;
+    for (USI i = 0; i < numDeflated; ++i) {
+        W.CopyCol(i, zk);
+        A->Apply(zk, ax);
+        const DBL norm = ax.Dot(zk);
+        for (USI pass = 0; pass < 2; ++pass) {
+            AW.MultiDot(kk, zk, mu.data());
+            W.MultiAXPY(kk, mu.data(), zk);
+            AW.MultiAXPY(kk, mu.data(), ax);
+        }
+        const DBL t = ax.Dot(zk);
+        if (t <= SMALL_TOL * norm) continue; // (nearly) in the span of the others
+        zk.Scale(1.0 / std::sqrt(t));
+        ax.Scale(1.0 / std::sqrt(t));
+        W.SetCol(kk, zk);
+        AW.SetCol(kk++, ax);
+    }
+    numDeflated = kk;
+}
+
+/// Replace W by Ritz vectors from range([W P]) with the smallest Ritz values.
+FaspRetCode DCG::UpdateDeflation()
+{
+    const USI kk   = numDeflated;
+    const USI l    = numStored;
+    const USI n    = kk + l;
+    const USI kNew = std::min(numDeflate, n);
+    if (l == 0 || kNew == 0) return FaspRetCode::SUCCESS;
+
+    try {
+        // F = Z^T A M^{-1} A Z and G = Z^T A Z = diag(I, rho_j / alpha_j), Z = [W P]
+        std::vector<DBL> F(n * n, 0.0), d(n, 1.0);
+        for (USI i = 0; i < kk; ++i) {
+            AW.CopyCol(i, ax);
+            zk.SetValues(len, 0.0);
+            pcd->Solve(ax, zk);
+            AW.MultiDot(kk, zk, &F[i * n]);
+        }
+        for (USI j = 0; j < l; ++j) {
+            // A p_j = (r_j - r_{j+1}) / alpha_j and (AW)^T M^{-1} r_j = hist_j
+            const DBL* h0 = &hist[j * numDeflate];
+            const DBL* h1 = &hist[(j + 1) * numDeflate];
+            for (USI i = 0; i < kk; ++i)
+                F[i + (kk + j) * n] = F[kk + j + i * n] = (h0[i] - h1[i]) / alphas[j];
+            F[kk + j + (kk + j) * n] =
+                (rhos[j] + rhos[j + 1]) / (alphas[j] * alphas[j]);
+            if (j + 1 < l)
+                F[kk + j + (kk + j + 1) * n] = F[kk + j + 1 + (kk + j) * n] =
+                    -rhos[j + 1] / (alphas[j] * alphas[j + 1]);
+            d[kk + j] = std::sqrt(alphas[j] / rhos[j]);
+        }
+
+        // Ritz pairs of M^{-1} A: D F D y = theta y with D = G^{-1/2}
+        for (USI j = 0; j < n; ++j)
+            for (USI i = 0; i < n; ++i) F[i + j * n] *= d[i] * d[j];
+
+        std::vector<DBL> wr, wi, y(n), yi(n);
+        FaspRetCode      retCode = DenseEigValues(n, F, wr, wi);
+        if (retCode != FaspRetCode::SUCCESS) return retCode;
+
+        std::vector<USI> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(),
+                  [&](USI a, USI b) { return wr[a] < wr[b]; });
+
+        // W_new = W y_W + P y_P for the smallest Ritz values
+        for (USI j = 0; j < kNew; ++j) {
+            retCode = DenseEigVector(n, F, wr[order[j]], 0.0, y.data(), yi.data());
+            if (retCode != FaspRetCode::SUCCESS) return retCode;
+            for (USI i = 0; i < n; ++i) y[i] *= d[i];
+            W.Combine(kk, y.data(), zk);
+            P.AddCombine(l, y.data() + kk, zk);
+            Wnew.SetCol(j, zk);
+        }
+        W.Swap(Wnew);
+        numDeflated = kNew;
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Deflated PCG; the deflation space is updated at the end of each solve.
+FaspRetCode DCG::Solve(const VEC& b, VEC& x)
+{
+    FaspRetCode errorCode = FaspRetCode::SUCCESS;
+
+    // Local variables
+    USI    moreStep = 0;
+    double resAbs = 1.0, resRel = 1.0, denAbs = 1.0, ratio = 0.0, resAbsOld = 1.0;
+    double alpha, beta, tmpa, tmpb;
+    bool   collect = true; // residuals still M^{-1}-orthogonal
+
+    PrintHead();
+
+    // Initialize iterative method
+    numIter   = 0;
+    numStored = 0;
+    safe      = x;
+    RefreshDeflation();
+    const USI kk = numDeflated;
+
+    A->Apply(x, rk);  // A * x -> rk
+    rk.XPAY(-1.0, b); // b - rk -> rk
+    resAbs = rk.Norm2();
+    denAbs = (CLOSE_ZERO > resAbs) ? CLOSE_ZERO : resAbs;
+
+    // Coarse correction x += W W^T r so that W^T r = 0
+    if (kk > 0) {
+        W.MultiDot(kk, rk, mu.data());
+        W.Combine(kk, mu.data(), zk);
+        x.AXPY(1.0, zk);
+        AW.MultiAXPY(kk, mu.data(), rk);
+    }
+
+    // Preconditioned search direction, A-orthogonal to W
+    zk.SetValues(len, 0.0); // initialize zk = 0
+    pcd->Solve(rk, zk);     // preconditioning: B(r_k) -> z_k
+    AW.MultiDot(kk, zk, hist.data());
+    pk = zk;
+    W.MultiAXPY(kk, hist.data(), pk);
+    tmpa = zk.Dot(rk);
+
+    // Main deflated CG loop
+    while (numIter < params.maxIter) {
+
+        // Start checking from minIter instead of 0
+        if (numIter == params.minIter) {
+            resAbs    = rk.Norm2();
+            resAbsOld = resAbs; // save initial residual
+            resRel    = resAbs / denAbs;
+            if (resRel < params.relTol || resAbs < params.absTol) break;
+        }
+
+        if (numIter >= params.minIter) PrintInfo(numIter, resRel, resAbs, ratio);
+
+        ++numIter; // iteration count
+
+        A->Apply(pk, ax); // ax = A * p_k, main computational work
+
+        // alpha_k = (z_{k-1}, r_{k-1})/(A*p_{k-1},p_{k-1})
+        tmpb = ax.Dot(pk);
+        if (fabs(tmpb) <= CLOSE_ZERO * CLOSE_ZERO) {
+            resAbs = rk.Norm2();
+            resRel = resAbs / denAbs;
+            if (resRel > params.relTol && resAbs > params.absTol) {
+                FASPXX_WARNING("Divided by zero!");
+                errorCode = FaspRetCode::ERROR_DIVIDE_ZERO;
+            } // otherwise converged to zero solution
+            break;
+        }
+        alpha = tmpa / tmpb;
+
+        // Keep the first search directions for updating W; p_j is counted once
+        // (AW)^T z_{j+1} and rho_{j+1} are known as well
+        collect = collect && numStored < numStore;
+        if (collect) {
+            P.SetCol(numStored, pk);
+            alphas[numStored] = alpha;
+            rhos[numStored]   = tmpa;
+        }
+
+        // Update solution and residual
+        x.AXPY(alpha, pk);   // x_k = x_{k-1} + alpha_k*p_{k-1}
+        rk.AXPY(-alpha, ax); // r_k = r_{k-1} - alpha_k*A*p_{k-1}
+
+        // Compute norm of residual and output iteration information if needed
+        resAbs = rk.Norm2();
+        resRel = resAbs / denAbs;
+        ratio  = resAbs / resAbsOld; // convergence ratio between two steps
+
+        // Save the best solution so far
+        if (numIter >= params.savIter && resAbs < resAbsOld) safe = x;
+
+        // Prevent false convergence
+        if (numIter >= params.minIter && resRel < params.relTol) {
+            // Compute and update the true residual r = b - Ax
+            A->Apply(x, rk);
+            rk.XPAY(-1.0, b);
+
+            double resRelOld = resRel;
+            resAbs           = rk.Norm2();
+            resRel           = resAbs / denAbs;
+            if (resRel < params.relTol || resAbs < params.absTol) break;
+
+            if (params.verbose >= PRINT_MORE) {
+                FASPXX_WARNING("False convergence!");
+                WarnCompRes(resRelOld);
+                WarnRealRes(resRel);
+            }
+            if (moreStep >= params.restart) {
+                if (params.verbose > PRINT_MIN)
+                    FASPXX_WARNING("The tolerance is too small!");
+                errorCode = FaspRetCode::ERROR_SOLVER_TOLSMALL;
+                break;
+            }
+            ++moreStep;
+            collect = false; // the recurrences are broken from now on
+        }
+
+        // Prepare for the next iteration
+        if (numIter < params.maxIter) {
+            // Save the residual for next iteration
+            resAbsOld = resAbs;
+
+            // Apply preconditioner z_k = B(r_k)
+            zk.SetValues(len, 0.0);
+            pcd->Solve(rk, zk);
+
+            // Compute beta_k = (z_k, r_k) / (z_{k-1}, r_{k-1})
+            tmpb = zk.Dot(rk);
+            beta = tmpb / tmpa;
+            tmpa = tmpb;
+
+            // Compute p_k = z_k + beta_k*p_{k-1} - W (AW)^T z_k
+            DBL* h = collect ? &hist[(numStored + 1) * numDeflate] : mu.data();
+            AW.MultiDot(kk, zk, h);
+            pk.XPAY(beta, zk);
+            W.MultiAXPY(kk, h, pk);
+            if (collect) rhos[++numStored] = tmpa;
+        }
+
+    } // End of main deflated CG loop
+
+    // Improve the deflation space for the next solve
+    if (UpdateDeflation() != FaspRetCode::SUCCESS) numDeflated = 0;
+
+    // If minIter == numIter == maxIter (preconditioner only), skip this
+    if (!(numIter == params.minIter && numIter == params.maxIter)) {
+        this->norm2   = resAbs;
+        this->normInf = rk.NormInf();
+        PrintFinal(numIter, resRel, resAbs, ratio);
+    }
+
+    // Restore the saved best iteration if needed
+    if (numIter > params.savIter) x = safe;
+
+    return errorCode;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,115 @@
+/*! \file    DCG.hxx
+ *  \brief   Deflated preconditioned CG class declaration
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+/*! Important Note:
+ *-----------------------------------------------------------------------------------
+ *  Deflated PCG (Saad, Yeung, Erhel and Guyomarc'h 2000) keeps k vectors W with
+ *  W^T A W = I. The initial guess is corrected so that W^T r = 0 and every search
+ *  direction is made A-orthogonal to W, p = z + beta p - W (AW)^T z, so the
+ *  eigenmodes in range(W) are removed from the iteration.
+ *
+ *  During a solve the first l search directions P are kept. Since A p_j is the
+ *  difference of two residuals and the residuals are M^{-1}-orthogonal, the
+ *  projections of A M^{-1} A and A onto [W P] follow from the CG coefficients and
+ *  the products (AW)^T z that the iteration computes anyway. The k Ritz vectors of
+ *  M^{-1} A with the smallest Ritz values in range([W P]) become W for the next
+ *  solve, so W improves from one system of a sequence to the next.
+ */
+
+#ifndef __DCG_HEADER__ /*-- allow multiple inclusions --*/
+#define __DCG_HEADER__ /**< indicate DCG.hxx has been included before */
+
+// Standard header files
+#include <vector>
+
+// FASPXX header files
+#include "ErrorLog.hxx"
+#include "Iter.hxx"
+#include "KrylovBasis.hxx"
+#include "LOP.hxx"
+#include "SOL.hxx"
+
+/*! \class DCG
+ *  \brief Deflated preconditioned CG, recycling eigenvectors from solve to solve.
+ */
+class DCG : public SOL
+{
+private:
+    USI len;         ///< dimension of the solution vector
+    USI numDeflate;  ///< max number k of deflation vectors
+    USI numStore;    ///< number l of search directions kept for the update
+    USI numDeflated; ///< number of vectors in the current W
+    USI numStored;   ///< number of search directions kept in the last solve
+
+    KrylovBasis W;    ///< deflation space, A-orthonormal
+    KrylovBasis AW;   ///< A * W
+    KrylovBasis P;    ///< first search directions of the solve
+    KrylovBasis Wnew; ///< work space for the next W
+
+    VEC rk;   ///< Work vector for residual
+    VEC zk;   ///< Work vector for preconditioned residual
+    VEC pk;   ///< Work vector for search direction
+    VEC ax;   ///< Work vector for A * pk
+    VEC safe; ///< Work vector for safe-guard
+
+    std::vector<DBL> alphas; ///< step lengths of the kept search directions
+    std::vector<DBL> rhos;   ///< (z_j, r_j) of the kept search directions
+    std::vector<DBL> hist;   ///< (AW)^T z_j of the kept search directions
+    std::vector<DBL> mu;     ///< (AW)^T z of the current step
+
+    /// Make W A-orthonormal for the current A and compute AW.
+    void RefreshDeflation();
+
+    /// Replace W by Ritz vectors from range([W P]) with the smallest Ritz values.
+    FaspRetCode UpdateDeflation();
+
+public:
+    /// Default constructor.
+    DCG()
+        : len(0)
+        , numDeflate(8)
+        , numStore(32)
+        , numDeflated(0)
+        , numStored(0)
+        , rk(0)
+        , zk(0)
+        , pk(0)
+        , ax(0)
+        , safe(0){};
+
+    /// Default destructor.
+    ~DCG() = default;
+
+    /// Set the number of deflation vectors and of search directions kept.
+    void SetNumDeflate(USI k, USI l);
+
+    /// Get the dimension of the current deflation space.
+    USI GetNumDeflated() const;
+
+    /// Setup the deflated CG method.
+    FaspRetCode Setup(const LOP& A) override;
+
+    /// Solve Ax=b using the deflated CG method.
+    FaspRetCode Solve(const VEC& b, VEC& x) override;
+
+    /// Clean up work data and forget the deflation space.
+    void Clean() override;
+};
+
+#endif /* end if for __DCG_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
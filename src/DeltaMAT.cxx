@@ -0,0 +1,272 @@
+/*! \file    DeltaMAT.cxx
+ *  \brief   Sparse matrix with delta-encoded column indices
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <algorithm>
+#include <cstring>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// FASPXX header files
+#include "DeltaMAT.hxx"
+
+static const int8_t  DELTA_ESC8  = INT8_MIN;  ///< escape to a 16-bit difference
+static const int16_t DELTA_ESC16 = INT16_MIN; ///< escape to an absolute column
+
+/// Append the code of column col following column prev.
+static void PutDelta(USI prev, USI col, std::vector<int8_t>& codes)
+{
+    const int64_t diff = (int64_t)col - (int64_t)prev;
+    if (diff > INT8_MIN && diff <= INT8_MAX) {
+        codes.push_back((int8_t)diff);
+        return;
+    }
+
+    codes.push_back(DELTA_ESC8);
+    const int16_t d16 = (diff > INT16_MIN && diff <= INT16_MAX) ? diff : DELTA_ESC16;
+    int8_t        buf[6];
+    std::memcpy(buf, &d16, 2);
+    if (d16 != DELTA_ESC16) {
+        codes.insert(codes.end(), buf, buf + 2);
+        return;
+    }
+    std::memcpy(buf + 2, &col, 4);
+    codes.insert(codes.end(), buf, buf + 6);
+}
+
+/// Decode the column following column col and move the code pointer forward.
+static inline USI NextCol(const int8_t*& code, USI col)
+{
+    const int8_t d8 = *code++;
+    if (d8 != DELTA_ESC8) return col + d8;
+
+    int16_t d16;
+    std::memcpy(&d16, code, 2);
+    code += 2;
+    if (d16 != DELTA_ESC16) return col + d16;
+
+    std::memcpy(&col, code, 4);
+    code += 4;
+    return col;
+}
+
+/// Append the header of a row: shift flag and row length.
+static void PutHeader(bool shift, USI len, std::vector<int8_t>& codes)
+{
+    if (len < 127) {
+        codes.push_back((int8_t)(uint8_t)((len << 1) | (shift ? 1 : 0)));
+        return;
+    }
+    codes.push_back((int8_t)(uint8_t)((127 << 1) | (shift ? 1 : 0)));
+    int8_t buf[4];
+    std::memcpy(buf, &len, 4);
+    codes.insert(codes.end(), buf, buf + 4);
+}
+
+/// Decode the header of a row and move the code pointer forward.
+static inline USI GetHeader(const int8_t*& code, bool& shift)
+{
+    const uint8_t h = (uint8_t)*code++;
+    shift           = h & 1;
+    USI len         = h >> 1;
+    if (len == 127) {
+        std::memcpy(&len, code, 4);
+        code += 4;
+    }
+    return len;
+}
+
+/// Compress the column indices of a MAT.
+DeltaMAT::DeltaMAT(const MAT& mat)
+    : nnz(0)
+    , maxRowLen(0)
+    , numParts(1)
+{
+    FaspRetCode retCode = SetValues(mat);
+    if (retCode < 0) throw(FaspRunTime(retCode, __FILE__, __FUNCTION__, __LINE__));
+}
+
+/// Compress the column indices of a MAT; the values are copied.
+FaspRetCode DeltaMAT::SetValues(const MAT& mat)
+{
+    if (mat.values.size() != mat.nnz) return FaspRetCode::ERROR_MAT_DATA;
+
+    const USI numBlocks = (mat.nrow + DELTA_BLOCK_ROWS - 1) / DELTA_BLOCK_ROWS;
+    try {
+        values = mat.values;
+        blockVal.resize(numBlocks + 1);
+        blockCode.resize(numBlocks + 1);
+        codes.clear();
+        codes.reserve(mat.nrow + mat.nnz / 4);
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    maxRowLen = 0;
+    for (USI i = 0; i < mat.nrow; ++i) {
+        const USI begin = mat.rowPtr[i], len = mat.rowPtr[i + 1] - begin;
+        if (i % DELTA_BLOCK_ROWS == 0) { // new block starts
+            blockVal[i / DELTA_BLOCK_ROWS]  = begin;
+            blockCode[i / DELTA_BLOCK_ROWS] = codes.size();
+        }
+        maxRowLen = std::max(maxRowLen, len);
+
+        // Check whether the row is the previous one shifted by one column
+        bool shift = i % DELTA_BLOCK_ROWS > 0 && mat.rowPtr[i - 1] + len == begin;
+        for (USI k = begin; shift && k < begin + len; ++k)
+            shift = mat.colInd[k] == mat.colInd[k - len] + 1;
+
+        PutHeader(shift, len, codes);
+        if (shift) continue;
+
+        USI prev = i;
+        for (USI k = begin; k < begin + len; ++k) {
+            PutDelta(prev, mat.colInd[k], codes);
+            prev = mat.colInd[k];
+        }
+    }
+    blockVal[numBlocks]  = mat.nnz;
+    blockCode[numBlocks] = codes.size();
+    codes.shrink_to_fit();
+
+    // Decoding buffers for Apply and Residual
+#ifdef _OPENMP
+    numParts = std::max(1, std::min(omp_get_max_threads(), (INT)numBlocks));
+#else
+    numParts = 1;
+#endif
+    try {
+        cols.assign((size_t)numParts * maxRowLen, 0);
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    nrow = mat.nrow;
+    mcol = mat.mcol;
+    nnz  = mat.nnz;
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Return this->nnz.
+USI DeltaMAT::GetNNZ() const { return nnz; }
+
+/// Number of bytes of values, block pointers, and column codes.
+size_t DeltaMAT::GetBytes() const
+{
+    return values.size() * sizeof(DBL) + blockVal.size() * sizeof(USI) +
+           blockCode.size() * sizeof(size_t) + codes.size();
+}
+
+/// Sparse matrix-vector multiplication, decoding the columns on the fly.
+void DeltaMAT::Apply(const VEC& v, VEC& w) const
+{
+    const DBL* x;
+    DBL*       y;
+    v.GetArray(&x);
+    w.GetArray(&y);
+
+    const DBL* val       = values.data();
+    const INT  numBlocks = blockVal.size() - 1;
+
+#pragma omp parallel num_threads(numParts)
+    {
+#ifdef _OPENMP
+        USI* const prev = cols.data() + (size_t)omp_get_thread_num() * maxRowLen;
+#else
+        USI* const prev = cols.data();
+#endif
+
+        INT b;
+#pragma omp for schedule(static)
+        for (b = 0; b < numBlocks; ++b) {
+            const int8_t* c    = codes.data() + blockCode[b];
+            const USI     last = std::min((b + 1) * DELTA_BLOCK_ROWS, nrow);
+            USI           k    = blockVal[b];
+            for (USI i = b * DELTA_BLOCK_ROWS; i < last; ++i) {
+                bool      shift;
+                const USI len = GetHeader(c, shift);
+                DBL       sum = 0.0;
+                if (shift) {
+                    for (USI j = 0; j < len; ++j, ++k) sum += val[k] * x[++prev[j]];
+                } else {
+                    USI col = i;
+                    for (USI j = 0; j < len; ++j, ++k) {
+                        prev[j] = col = NextCol(c, col);
+                        sum += val[k] * x[col];
+                    }
+                }
+                y[i] = sum;
+            }
+        }
+    }
+}
+
+/// Residual r = b - Ax, decoding the columns on the fly.
+void DeltaMAT::Residual(const VEC& b, const VEC& x, VEC& r) const
+{
+    if (x.NormInf() < CLOSE_ZERO) {
+        r = b; // if x = 0, for preconditioning
+        return;
+    }
+
+    const DBL *bv, *xv;
+    DBL*       rv;
+    b.GetArray(&bv);
+    x.GetArray(&xv);
+    r.GetArray(&rv);
+
+    const DBL* val       = values.data();
+    const INT  numBlocks = blockVal.size() - 1;
+
+#pragma omp parallel num_threads(numParts)
+    {
+#ifdef _OPENMP
+        USI* const prev = cols.data() + (size_t)omp_get_thread_num() * maxRowLen;
+#else
+        USI* const prev = cols.data();
+#endif
+
+        INT blk;
+#pragma omp for schedule(static)
+        for (blk = 0; blk < numBlocks; ++blk) {
+            const int8_t* c    = codes.data() + blockCode[blk];
+            const USI     last = std::min((blk + 1) * DELTA_BLOCK_ROWS, nrow);
+            USI           k    = blockVal[blk];
+            for (USI i = blk * DELTA_BLOCK_ROWS; i < last; ++i) {
+                bool      shift;
+                const USI len = GetHeader(c, shift);
+                DBL       sum = bv[i];
+                if (shift) {
+                    for (USI j = 0; j < len; ++j, ++k) sum -= val[k] * xv[++prev[j]];
+                } else {
+                    USI col = i;
+                    for (USI j = 0; j < len; ++j, ++k) {
+                        prev[j] = col = NextCol(c, col);
+                        sum -= val[k] * xv[col];
+                    }
+                }
+                rv[i] = sum;
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Allocate thread buffers once         */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,102 @@
+/*! \file    DeltaMAT.hxx
+ *  \brief   Sparse matrix with delta-encoded column indices
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+/*! Important Note:
+ *-----------------------------------------------------------------------------------
+ *  Rows are grouped in blocks of DELTA_BLOCK_ROWS rows, and only the beginning of
+ *  each block in values and in the code stream is stored. Every row starts with a
+ *  header byte: the low bit tells whether the columns are those of the previous row
+ *  shifted by one (typical for stencils) or are given explicitly, and the upper
+ *  seven bits hold the row length (127 means the length follows as a uint32).
+ *
+ *  Explicit columns are stored as signed differences, the first one with respect to
+ *  the row index and the others with respect to the previous column. Each
+ *  difference uses the shortest of the following codes:
+ *
+ *      1 byte : an int8 difference in [-127, 127];
+ *      3 bytes: the escape byte 0x80 followed by an int16 difference;
+ *      7 bytes: 0x80, the int16 escape 0x8000, and the absolute uint32 column.
+ *
+ *  For stencil matrices the index traffic of SpMV drops from 4 bytes to a fraction
+ *  of a byte per nonzero, and the row pointers are gone as well. Apply and Residual
+ *  sum up the entries in the same order as MAT, so the results are identical.
+ *  They decode into per-thread column buffers allocated once in SetValues, so the
+ *  same DeltaMAT must not be applied by several threads at the same time.
+ */
+
+#ifndef __DELTAMAT_HEADER__ /*-- allow multiple inclusions --*/
+#define __DELTAMAT_HEADER__ /**< indicate DeltaMAT.hxx has been included before */
+
+// Standard header files
+#include <cstdint>
+#include <vector>
+
+// FASPXX header files
+#include "LOP.hxx"
+#include "MAT.hxx"
+
+const USI DELTA_BLOCK_ROWS = 64; ///< number of rows in a block
+
+/*! \class DeltaMAT
+ *  \brief Read-only CSR matrix with compressed column indices.
+ */
+class DeltaMAT : public LOP
+{
+private:
+    USI                 nnz;       ///< number of nonzeros of the matrix
+    USI                 maxRowLen; ///< maximal number of nonzeros in a row
+    USI                 numParts;  ///< number of threads in Apply and Residual
+    std::vector<DBL>    values;    ///< nonzero entries, compressed row by row
+    std::vector<USI>    blockVal;  ///< beginning of each block of rows in values
+    std::vector<size_t> blockCode; ///< beginning of each block of rows in codes
+    std::vector<int8_t> codes;     ///< row headers and delta-encoded column indices
+
+    mutable std::vector<USI> cols; ///< columns of the previous row, for each thread
+
+public:
+    /// Default constructor.
+    DeltaMAT()
+        : nnz(0)
+        , maxRowLen(0)
+        , numParts(1){};
+
+    /// Compress the column indices of a MAT.
+    explicit DeltaMAT(const MAT& mat);
+
+    /// Default destructor.
+    ~DeltaMAT() = default;
+
+    /// Compress the column indices of a MAT.
+    FaspRetCode SetValues(const MAT& mat);
+
+    /// Get number of nonzeros of the matrix.
+    USI GetNNZ() const;
+
+    /// Get number of bytes used by the matrix.
+    size_t GetBytes() const;
+
+    /// Sparse matrix-vector multiplication.
+    void Apply(const VEC& v, VEC& w) const override;
+
+    /// Residual b - Ax.
+    void Residual(const VEC& b, const VEC& x, VEC& r) const override;
+};
+
+#endif /* end if for __DELTAMAT_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Allocate thread buffers once         */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,218 @@
+/*! \file    DenseLU.cxx
+ *  \brief   Dense LU direct solver class definition
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <algorithm>
+#include <cmath>
+
+// FASPXX header files
+#include "DenseLU.hxx"
+
+/// Number of columns updated at once in the trailing submatrix update.
+static const USI DENSE_COL_BLOCK = 256;
+
+/// Set panel width of the blocked factorization.
+void DenseLU::SetBlockSize(USI nb) { blockSize = (nb > 0) ? nb : 1; }
+
+/// Densify a sparse matrix and compute its LU factorization.
+FaspRetCode DenseLU::Setup(const MAT& A)
+{
+    // Set solver type
+    SetSolType(SOLType::SOLVER_DENSELU);
+
+    if (A.GetRowSize() != A.GetColSize()) return FaspRetCode::ERROR_MAT_SIZE;
+
+    // Allocate memory for the dense factors
+    try {
+        len = A.GetRowSize();
+        A.GetDense(LU);
+        perm.resize(len);
+        work.resize(len);
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    // Setup the coefficient matrix
+    this->A = &A;
+
+    // Print used parameters
+    if (params.verbose > PRINT_MIN) PrintParam(std::cout);
+
+    return Factorize();
+}
+
+/// Densify a general linear operator column by column and factorize it.
+FaspRetCode DenseLU::Setup(const LOP& A)
+{
+    // Use the sparse matrix directly if possible
+    const MAT* mat = dynamic_cast<const MAT*>(&A);
+    if (mat != nullptr) return Setup(*mat);
+
+    // Set solver type
+    SetSolType(SOLType::SOLVER_DENSELU);
+
+    if (A.GetRowSize() != A.GetColSize()) return FaspRetCode::ERROR_MAT_SIZE;
+
+    // Apply A to the unit vectors to get the dense matrix
+    try {
+        len = A.GetRowSize();
+        LU.assign((size_t)len * len, 0.0);
+        perm.resize(len);
+        work.resize(len);
+
+        VEC unit(len, 0.0), col(len, 0.0);
+        for (USI j = 0; j < len; ++j) {
+            unit[j] = 1.0;
+            A.Apply(unit, col);
+            for (USI i = 0; i < len; ++i) LU[(size_t)i * len + j] = col[i];
+            unit[j] = 0.0;
+        }
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    // Setup the coefficient matrix
+    this->A = &A;
+
+    // Print used parameters
+    if (params.verbose > PRINT_MIN) PrintParam(std::cout);
+
+    return Factorize();
+}
+
+/// Factorize the dense matrix stored in LU in place.
+FaspRetCode DenseLU::Factorize()
+{
+    return Factorize(len, blockSize, LU.data(), perm.data());
+}
+
+/// Right-looking blocked LU with partial pivoting: PA = LU, stored in place.
+FaspRetCode DenseLU::Factorize(const USI n, const USI nb, DBL* a, USI* perm,
+                               const DBL tol)
+{
+    for (USI i = 0; i < n; ++i) perm[i] = i;
+
+    for (USI k = 0; k < n; k += nb) {
+        const USI ke = std::min(k + nb, n); // end of the current panel
+
+        // Factorize the panel a[k:n, k:ke) with unblocked LU
+        for (USI j = k; j < ke; ++j) {
+            USI piv  = j;
+            DBL amax = std::fabs(a[(size_t)j * n + j]);
+            for (USI i = j + 1; i < n; ++i) {
+                const DBL tmp = std::fabs(a[(size_t)i * n + j]);
+                if (tmp > amax) {
+                    amax = tmp;
+                    piv  = i;
+                }
+            }
+            if (amax <= tol) return FaspRetCode::ERROR_DSOLVER_SETUP; // singular
+
+            // Swap whole rows so that L and the trailing matrix stay consistent
+            if (piv != j) {
+                std::swap_ranges(a + (size_t)j * n, a + (size_t)j * n + n,
+                                 a + (size_t)piv * n);
+                std::swap(perm[j], perm[piv]);
+            }
+
+            const DBL* rowj   = a + (size_t)j * n;
+            const DBL  pivInv = 1.0 / rowj[j];
+            for (USI i = j + 1; i < n; ++i) {
+                DBL*      rowi = a + (size_t)i * n;
+                const DBL l    = (rowi[j] *= pivInv);
+                for (USI c = j + 1; c < ke; ++c) rowi[c] -= l * rowj[c];
+            }
+        }
+        if (ke == n) break;
+
+        // Block row of U: a[k:ke, ke:n) = L11^{-1} * a[k:ke, ke:n)
+        for (USI j = k; j < ke; ++j) {
+            const DBL* rowj = a + (size_t)j * n;
+            for (USI i = j + 1; i < ke; ++i) {
+                DBL*      rowi = a + (size_t)i * n;
+                const DBL l    = rowi[j];
+                for (USI c = ke; c < n; ++c) rowi[c] -= l * rowj[c];
+            }
+        }
+
+        // Trailing update A22 -= L21 * U12, column blocks keep U12 in cache
+        for (USI cb = ke; cb < n; cb += DENSE_COL_BLOCK) {
+            const USI ce = std::min(cb + DENSE_COL_BLOCK, n);
+            INT       i;
+#pragma omp parallel for private(i)
+            for (i = (INT)ke; i < (INT)n; ++i) {
+                DBL* rowi = a + (size_t)i * n;
+                for (USI p = k; p < ke; ++p) {
+                    const DBL l = rowi[p];
+                    if (l == 0.0) continue;
+                    const DBL* rowp = a + (size_t)p * n;
+                    for (USI c = cb; c < ce; ++c) rowi[c] -= l * rowp[c];
+                }
+            }
+        }
+    }
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Forward and backward substitution with the factors of PA = LU.
+void DenseLU::Substitute(const USI n, const DBL* a, const USI* perm, const DBL* b,
+                         DBL* x)
+{
+    // Forward substitution with unit lower triangular L: L y = P b
+    for (USI i = 0; i < n; ++i) {
+        const DBL* rowi = a + (size_t)i * n;
+        DBL        sum  = b[perm[i]];
+        for (USI j = 0; j < i; ++j) sum -= rowi[j] * x[j];
+        x[i] = sum;
+    }
+
+    // Backward substitution with upper triangular U: U x = y
+    for (INT i = (INT)n - 1; i >= 0; --i) { // To compare with 0. Need signed INT!
+        const DBL* rowi = a + (size_t)i * n;
+        DBL        sum  = x[i];
+        for (USI j = i + 1; j < n; ++j) sum -= rowi[j] * x[j];
+        x[i] = sum / rowi[i];
+    }
+}
+
+/// Solve Ax=b with the cached factors. Don't check problem sizes.
+FaspRetCode DenseLU::Solve(const VEC& b, VEC& x)
+{
+    const USI n = len;
+
+    if (n > 0) Substitute(n, LU.data(), perm.data(), &b[0], work.data());
+    for (USI i = 0; i < n; ++i) x[i] = work[i];
+
+    numIter = 1;
+    norm2   = 0.0;
+    normInf = 0.0;
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Clean up LU factors.
+void DenseLU::Clean()
+{
+    len = 0;
+    std::vector<DBL>().swap(LU);
+    std::vector<USI>().swap(perm);
+    std::vector<DBL>().swap(work);
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Factorization kernels on raw arrays  */
+/*----------------------------------------------------------------------------*/
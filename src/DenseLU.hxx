@@ -0,0 +1,83 @@
+/*! \file    DenseLU.hxx
+ *  \brief   Dense LU direct solver class declaration
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#ifndef __DENSELU_HEADER__ /*-- allow multiple inclusions --*/
+#define __DENSELU_HEADER__ /**< indicate DenseLU.hxx has been included before */
+
+// Standard header files
+#include <vector>
+
+// FASPXX header files
+#include "ErrorLog.hxx"
+#include "MAT.hxx"
+#include "SOL.hxx"
+
+/*! \class DenseLU
+ *  \brief Dense LU factorization with partial pivoting for small systems.
+ *
+ *  The matrix is densified and factored once in Setup by a right-looking blocked
+ *  LU; every Solve afterwards only applies the row permutation and two triangular
+ *  solves. It is meant for the coarsest level of multigrid and other small systems.
+ */
+class DenseLU : public SOL
+{
+private:
+    USI              len;       ///< dimension of the dense matrix
+    USI              blockSize; ///< panel width of the blocked factorization
+    std::vector<DBL> LU;        ///< L (unit lower, strict part) and U, row-major
+    std::vector<USI> perm;      ///< row permutation from partial pivoting
+    std::vector<DBL> work;      ///< work array for the permuted right-hand side
+
+    /// Factorize the dense matrix stored in LU in place.
+    FaspRetCode Factorize();
+
+public:
+    /// Default constructor.
+    DenseLU()
+        : len(0)
+        , blockSize(64){};
+
+    /// Default destructor.
+    ~DenseLU() = default;
+
+    /// Set panel width of the blocked factorization.
+    void SetBlockSize(USI nb);
+
+    /// Setup and factorize a sparse matrix.
+    FaspRetCode Setup(const MAT& A);
+
+    /// Setup and factorize a general linear operator.
+    FaspRetCode Setup(const LOP& A) override;
+
+    /// Solve Ax=b using the LU factors.
+    FaspRetCode Solve(const VEC& b, VEC& x) override;
+
+    /// Clean up LU factors.
+    void Clean() override;
+
+    /// Blocked LU with partial pivoting of a row-major n x n array in place, PA = LU;
+    /// fails if a pivot is not larger than tol in absolute value.
+    static FaspRetCode Factorize(USI n, USI nb, DBL* a, USI* perm, DBL tol = 0.0);
+
+    /// Solve LU x = P b with the factors of Factorize; x must not overlap b.
+    static void Substitute(USI n, const DBL* a, const USI* perm, const DBL* b, DBL* x);
+};
+
+#endif /* end if for __DENSELU_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Factorization kernels on raw arrays  */
+/*----------------------------------------------------------------------------*/
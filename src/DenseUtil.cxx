@@ -0,0 +1,292 @@
+/*! \file    DenseUtil.cxx
+ *  \brief   Tools definition for small dense matrices in Krylov methods
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// FASPXX header files
+#include "DenseLU.hxx"
+#include "DenseUtil.hxx"
+
+/// Solve A X = B by the LU kernels of DenseLU; A (n x n) is overwritten by the
+/// factors of its transpose and B (n x nrhs) by the solution X.
+FaspRetCode DenseSolve(const USI n, DBL* A, const USI nrhs, DBL* B)
+{
+    // A column-major array is the row-major transpose: swap to get row-major A
+    for (USI j = 0; j < n; ++j)
+        for (USI i = j + 1; i < n; ++i) std::swap(A[i + j * n], A[j + i * n]);
+
+    std::vector<USI> perm;
+    std::vector<DBL> x;
+    try {
+        perm.resize(n);
+        x.resize(n);
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    // One panel is enough for the small projected systems
+    if (DenseLU::Factorize(n, n, A, perm.data(), CLOSE_ZERO) != FaspRetCode::SUCCESS)
+        return FaspRetCode::ERROR_DIVIDE_ZERO;
+
+    for (USI j = 0; j < nrhs; ++j) {
+        DenseLU::Substitute(n, A, perm.data(), B + j * n, x.data());
+        std::copy(x.begin(), x.end(), B + j * n);
+    }
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Thin QR of A (m x n, m >= n) by Gram-Schmidt with reorthogonalization; A is
+/// overwritten by Q and R (n x n) is upper triangular.
+FaspRetCode DenseQR(const USI m, const USI n, DBL* A, DBL* R)
+{
+    std::fill(R, R + n * n, 0.0);
+    for (USI j = 0; j < n; ++j) {
+        DBL* a = A + j * m;
+        for (USI pass = 0; pass < 2; ++pass) {
+            for (USI i = 0; i < j; ++i) {
+                const DBL* q   = A + i * m;
+                DBL        dot = 0.0;
+                for (USI l = 0; l < m; ++l) dot += q[l] * a[l];
+                for (USI l = 0; l < m; ++l) a[l] -= dot * q[l];
+                R[i + j * n] += dot;
+            }
+        }
+        DBL norm = 0.0;
+        for (USI l = 0; l < m; ++l) norm += a[l] * a[l];
+        norm = std::sqrt(norm);
+        if (norm < CLOSE_ZERO) return FaspRetCode::ERROR_DIVIDE_ZERO;
+        for (USI l = 0; l < m; ++l) a[l] /= norm;
+        R[j + j * n] = norm;
+    }
+    return FaspRetCode::SUCCESS;
+}
+
+/// Householder vector v with (I - beta v v^T) x = alpha e_1 for x of length m;
+/// returns beta, zero if x is zero.
+static DBL House(const USI m, const DBL* x, DBL* v)
+{
+    DBL norm = 0.0;
+    for (USI i = 0; i < m; ++i) norm += x[i] * x[i];
+    norm = std::sqrt(norm);
+    if (norm == 0.0) return 0.0;
+
+    // Choose the sign of alpha that avoids cancellation in v[0]
+    std::copy(x, x + m, v);
+    v[0] += (x[0] >= 0.0) ? norm : -norm;
+    return 1.0 / (norm * std::fabs(v[0])); // 2 / (v^T v)
+}
+
+/// H(r0:r0+m, c0:c1] = (I - beta v v^T) H(r0:r0+m, c0:c1], H column-major n x n.
+static void ReflectRows(const USI n, DBL* H, const USI m, const DBL* v, const DBL beta,
+                        const USI r0, const USI c0, const USI c1)
+{
+    for (USI j = c0; j <= c1; ++j) {
+        DBL* col = H + r0 + j * n;
+        DBL  dot = 0.0;
+        for (USI i = 0; i < m; ++i) dot += v[i] * col[i];
+        dot *= beta;
+        for (USI i = 0; i < m; ++i) col[i] -= dot * v[i];
+    }
+}
+
+/// H[r0:r1, c0:c0+m) = H[r0:r1, c0:c0+m) (I - beta v v^T), H column-major n x n.
+static void ReflectCols(const USI n, DBL* H, const USI m, const DBL* v, const DBL beta,
+                        const USI c0, const USI r0, const USI r1)
+{
+    for (USI i = r0; i <= r1; ++i) {
+        DBL* row = H + i + c0 * n;
+        DBL  dot = 0.0;
+        for (USI j = 0; j < m; ++j) dot += row[j * n] * v[j];
+        dot *= beta;
+        for (USI j = 0; j < m; ++j) row[j * n] -= dot * v[j];
+    }
+}
+
+/// Eigenvalues wr + i wi of a general n x n matrix by the Hessenberg QR algorithm;
+/// complex conjugate pairs are stored next to each other, positive part first.
+///
+/// The matrix is reduced to Hessenberg form by Householder reflections and then
+/// deflated by Francis double-shift QR steps, as in Sections 7.4 and 7.5 of Golub
+/// and Van Loan, Matrix Computations; the exceptional shifts follow LAPACK dlahqr.
+FaspRetCode DenseEigValues(const USI n, std::vector<DBL> A, std::vector<DBL>& wr,
+                           std::vector<DBL>& wi)
+{
+    const DBL eps = std::numeric_limits<DBL>::epsilon();
+    DBL*      H   = A.data();
+    DBL       v[3];
+
+    wr.assign(n, 0.0);
+    wi.assign(n, 0.0);
+    if (n == 0) return FaspRetCode::SUCCESS;
+
+    // Hessenberg reduction: zero H(k+2:n, k) with a reflection of rows k+1:n
+    std::vector<DBL> x(n), u(n);
+    for (USI k = 0; k + 2 < n; ++k) {
+        const USI m = n - k - 1;
+        std::copy(H + k + 1 + k * n, H + n + k * n, x.begin());
+        const DBL beta = House(m, x.data(), u.data());
+        if (beta == 0.0) continue;
+        ReflectRows(n, H, m, u.data(), beta, k + 1, k, n - 1);
+        ReflectCols(n, H, m, u.data(), beta, k + 1, 0, n - 1);
+        for (USI i = k + 2; i < n; ++i) H[i + k * n] = 0.0;
+    }
+
+    DBL hnorm = 0.0; // for the deflation test of a zero diagonal
+    for (USI j = 0; j < n; ++j) {
+        const USI iend = std::min(j + 2, n);
+        for (USI i = 0; i < iend; ++i) hnorm += std::fabs(H[i + j * n]);
+    }
+
+    // Francis QR steps on the unreduced block [lo, hi] at the bottom of H
+    INT hi = INT(n) - 1;
+    USI its = 0, totalIts = 0;
+    while (hi >= 0) {
+        // Deflate: the block starts below the last negligible subdiagonal entry
+        INT lo = hi;
+        for (; lo > 0; --lo) {
+            DBL& sub = H[lo + (lo - 1) * n];
+            DBL  dia = std::fabs(H[lo + lo * n]) + std::fabs(H[lo - 1 + (lo - 1) * n]);
+            if (dia == 0.0) dia = hnorm;
+            if (std::fabs(sub) <= eps * dia) {
+                sub = 0.0;
+                break;
+            }
+        }
+
+        if (lo == hi) { // a real eigenvalue
+            wr[hi] = H[hi + hi * n];
+            --hi;
+            its = 0;
+            continue;
+        }
+
+        if (lo == hi - 1) { // a 2 x 2 block: a real pair or a complex pair
+            const DBL a = H[lo + lo * n], b = H[lo + hi * n];
+            const DBL c = H[hi + lo * n], d = H[hi + hi * n];
+            const DBL p = 0.5 * (a - d), disc = p * p + b * c;
+            if (disc >= 0.0) { // lambda = d + w with w^2 - 2 p w - b c = 0
+                const DBL w = p + (p >= 0.0 ? std::sqrt(disc) : -std::sqrt(disc));
+                wr[lo] = d + w;
+                wr[hi] = (w != 0.0) ? d - b * c / w : d;
+            } else {
+                wr[lo] = wr[hi] = d + p;
+                wi[lo]          = std::sqrt(-disc);
+                wi[hi]          = -wi[lo];
+            }
+            hi -= 2;
+            its = 0;
+            continue;
+        }
+
+        if (++totalIts > 30 * n) return FaspRetCode::ERROR_SOLVER_MAXIT;
+
+        // The two shifts are the eigenvalues of a 2 x 2 block [a, b; c, d]: the
+        // trailing one, or an ad hoc one after every 10 steps without deflation
+        DBL a, b, c, d;
+        if (++its % 10 == 0) {
+            const DBL e = std::fabs(H[hi + (hi - 1) * n]) +
+                          std::fabs(H[hi - 1 + (hi - 2) * n]);
+            a = d = H[hi + hi * n] + 0.75 * e;
+            b     = -0.4375 * e;
+            c     = e;
+        } else {
+            a = H[hi - 1 + (hi - 1) * n];
+            b = H[hi - 1 + hi * n];
+            c = H[hi + (hi - 1) * n];
+            d = H[hi + hi * n];
+        }
+
+        // First column of (H - s1 I)(H - s2 I), nonzero in three entries only;
+        // differences to the shifts first avoid cancellation for close eigenvalues
+        const DBL h00 = H[lo + lo * n], h10 = H[lo + 1 + lo * n];
+        x[0] = (h00 - a) * (h00 - d) - b * c + H[lo + (lo + 1) * n] * h10;
+        x[1] = h10 * ((h00 - a) + (H[lo + 1 + (lo + 1) * n] - d));
+        x[2] = h10 * H[lo + 2 + (lo + 1) * n];
+
+        // Chase the bulge down to the bottom of the block
+        for (INT k = lo; k <= hi - 2; ++k) {
+            const DBL beta = House(3, x.data(), v);
+            if (beta != 0.0) {
+                ReflectRows(n, H, 3, v, beta, k, std::max(k - 1, lo), hi);
+                ReflectCols(n, H, 3, v, beta, k, lo, std::min(k + 3, hi));
+                if (k > lo) H[k + 1 + (k - 1) * n] = H[k + 2 + (k - 1) * n] = 0.0;
+            }
+            x[0] = H[k + 1 + k * n];
+            x[1] = H[k + 2 + k * n];
+            if (k < hi - 2) x[2] = H[k + 3 + k * n];
+        }
+        const DBL beta = House(2, x.data(), v);
+        if (beta != 0.0) {
+            ReflectRows(n, H, 2, v, beta, hi - 1, hi - 2, hi);
+            ReflectCols(n, H, 2, v, beta, hi - 1, lo, hi);
+            H[hi + (hi - 2) * n] = 0.0;
+        }
+    }
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Eigenvector vr + i vi of A for the eigenvalue re + i im by inverse iteration,
+/// normalized to unit Euclidean norm; vi is zero for a real eigenvalue.
+FaspRetCode DenseEigVector(const USI n, const std::vector<DBL>& A, const DBL re,
+                           const DBL im, DBL* vr, DBL* vi)
+{
+    // Perturb the shift slightly so that A - lambda I is not exactly singular
+    DBL anorm = 0.0;
+    for (DBL aij : A) anorm = std::max(anorm, std::fabs(aij));
+    const DBL shift = re + 1e-10 * (anorm + std::fabs(re) + std::fabs(im));
+
+    // Real form [A - re I, im I; -im I, A - re I] of the complex shifted matrix
+    const USI        N = (im == 0.0) ? n : 2 * n;
+    std::vector<DBL> M(N * N, 0.0), LU(N * N), x(N, 1.0);
+    for (USI j = 0; j < n; ++j) {
+        for (USI i = 0; i < n; ++i) {
+            M[i + j * N] = A[i + j * n] - (i == j ? shift : 0.0);
+            if (N > n) M[(i + n) + (j + n) * N] = M[i + j * N];
+        }
+        if (N > n) {
+            M[j + (j + n) * N] = im;
+            M[(j + n) + j * N] = -im;
+        }
+    }
+    for (USI i = 0; i < N; ++i) x[i] = 1.0 + 0.1 * std::sin(i + 1.0); // generic start
+
+    // Two steps of inverse iteration are enough with an accurate eigenvalue
+    for (USI it = 0; it < 2; ++it) {
+        LU                = M;
+        FaspRetCode retCode = DenseSolve(N, LU.data(), 1, x.data());
+        if (retCode < 0) return retCode;
+        DBL norm = 0.0;
+        for (DBL xi : x) norm += xi * xi;
+        norm = std::sqrt(norm);
+        if (norm < CLOSE_ZERO) return FaspRetCode::ERROR_DIVIDE_ZERO;
+        for (DBL& xi : x) xi /= norm;
+    }
+
+    for (USI i = 0; i < n; ++i) {
+        vr[i] = x[i];
+        vi[i] = (N > n) ? x[i + n] : 0.0;
+    }
+    return FaspRetCode::SUCCESS;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Own shifted QR, reuse DenseLU        */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,57 @@
+/** \file    DenseUtil.hxx
+ *  \brief   Tools declaration for small dense matrices in Krylov methods
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+/*! Important Note:
+ *-----------------------------------------------------------------------------------
+ *  These routines work on the projected matrices of Krylov methods, whose sizes are
+ *  of the order of the restart number. All matrices are stored column-major, entry
+ *  (i, j) of an m x n matrix at A[i + j * m]. They are written for clarity rather
+ *  than for speed and are not meant for large matrices.
+ */
+
+#ifndef __DENSEUTIL_HEADER__ /*-- allow multiple inclusions --*/
+#define __DENSEUTIL_HEADER__ /**< indicate DenseUtil.hxx has been included before */
+
+// Standard header files
+#include <vector>
+
+// FASPXX header files
+#include "Faspxx.hxx"
+#include "RetCode.hxx"
+
+/// Solve A X = B by the LU kernels of DenseLU; A (n x n) is overwritten by the
+/// factors of its transpose and B (n x nrhs) by the solution X.
+FaspRetCode DenseSolve(USI n, DBL* A, USI nrhs, DBL* B);
+
+/// Thin QR of A (m x n, m >= n) by Gram-Schmidt with reorthogonalization; A is
+/// overwritten by Q and R (n x n) is upper triangular.
+FaspRetCode DenseQR(USI m, USI n, DBL* A, DBL* R);
+
+/// Eigenvalues wr + i wi of a general n x n matrix by the Hessenberg QR algorithm;
+/// complex conjugate pairs are stored next to each other, positive part first.
+FaspRetCode DenseEigValues(USI n, std::vector<DBL> A, std::vector<DBL>& wr,
+                           std::vector<DBL>& wi);
+
+/// Eigenvector vr + i vi of A for the eigenvalue re + i im by inverse iteration,
+/// normalized to unit Euclidean norm; vi is zero for a real eigenvalue.
+FaspRetCode DenseEigVector(USI n, const std::vector<DBL>& A, DBL re, DBL im, DBL* vr,
+                           DBL* vi);
+
+#endif /* end if for __DENSEUTIL_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Reuse DenseLU, rename header guard   */
+/*----------------------------------------------------------------------------*/
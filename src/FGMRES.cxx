@@ -19,13 +19,24 @@ void FGMRES::SetMaxMinRestart(const USI maxRestart, const USI minRestart)
     this->minRestart = minRestart;
 }
 
+/// Set the orthogonalization scheme of the Krylov basis.
+void FGMRES::SetOrthType(const OrthType type) { this->orthType = type; }
+
+/// Set the storage precision of V and Z, before Setup.
+void FGMRES::SetBasisPrec(const BasisPrec prec) { this->basisPrec = prec; }
+
 /// Set up the FGMRES method.
 FaspRetCode FGMRES::Setup(const LOP& A)
 {
-
     // Set solver type
     SetSolType(SOLType::SOLVER_FGMRES);
 
+    return SetupWork(A);
+}
+
+/// Allocate work vectors and the bases for the current solver type.
+FaspRetCode FGMRES::SetupWork(const LOP& A)
+{
     len        = A.GetColSize();
     restart    = params.restart;
     maxRestart = maxRestart > params.maxIter ? params.maxIter : maxRestart;
@@ -36,31 +47,23 @@ FaspRetCode FGMRES::Setup(const LOP& A)
         wk.SetValues(len, 0.0);
         tmp.SetValues(len, 0.0);
         safe.SetValues(len, 0.0);
-        var.resize(len);
+        var.resize(maxRestart + 1);
 
         hcos.resize(maxRestart + 1);
         hsin.resize(maxRestart);
-        hh.resize(maxRestart + 1);
-        for (USI j = 0; j < maxRestart + 1; ++j) hh[j].resize(maxRestart);
+        hh.resize((maxRestart + 1) * maxRestart);
     } catch (std::bad_alloc& ex) {
         return FaspRetCode::ERROR_ALLOC_MEM;
     }
 
     // Allocate memory for restart vectors
     while (maxRestart >= minRestart) {
-        try {
-            for (USI j = 0; j < maxRestart + 1; ++j) {
-                V.push_back(safe);
-                Z.push_back(safe);
-            }
+        if (V.Allocate(len, maxRestart + 1, basisPrec) == FaspRetCode::SUCCESS &&
+            Z.Allocate(len, maxRestart, basisPrec) == FaspRetCode::SUCCESS)
             break;
-        } catch (std::bad_alloc& ex) {
-            maxRestart -= decrease;
-            while (!V.empty()) {
-                V.resize(0);
-                Z.resize(0);
-            }
-        }
+        maxRestart -= decrease; // reduce restart if memory is not enough
+        V.Clean();
+        Z.Clean();
     }
     if (maxRestart < minRestart) return FaspRetCode::ERROR_ALLOC_MEM;
 
@@ -93,17 +96,16 @@ void FGMRES::Clean()
     wk.SetValues(len, 0.0);
     tmp.SetValues(len, 0.0);
     safe.SetValues(len, 0.0);
-    var.assign(len, 0.0);
+    var.assign(maxRestart + 1, 0.0);
 
     hcos.assign(maxRestart + 1, 0.0);
     hsin.assign(maxRestart, 0.0);
-    hh.resize(maxRestart + 1);
-    for (USI j = 0; j < maxRestart + 1; ++j) hh[j].assign(maxRestart, 0.0);
-
-    V.assign(maxRestart + 1, safe);
-    Z.assign(maxRestart + 1, safe);
+    hh.assign((maxRestart + 1) * maxRestart, 0.0);
 }
 
+/// Fixed restart number for FGMRES.
+void FGMRES::UpdateRestart(double /*rate*/) {}
+
 /// Right-preconditioned FGMRES solver.
 FaspRetCode FGMRES::Solve(const VEC& b, VEC& x)
 {
@@ -111,20 +113,27 @@ FaspRetCode FGMRES::Solve(const VEC& b, VEC& x)
     FaspRetCode errorCode = FaspRetCode::SUCCESS;
 
     // local variables
-    double gamma, t, ri, rj, cr = 1.0;
+    double gamma, t, ri, rj;
     double resAbs = 1.0, resRel = 1.0, denAbs = 1.0, ratio = 0.0, resAbsOld = 1.0;
     USI    count = 1, count_1 = 2;
+    USI    ld        = maxRestart + 1; // leading dimension of hh
+    bool   breakdown = false;
 
     PrintHead();
 
     // Initialize iterative method
     numIter = 0;
     safe    = x;
+    restart = params.restart;
+    if (restart > maxRestart)
+        restart = maxRestart;
+    else if (restart < minRestart)
+        restart = minRestart;
 
     // Initialize residual norm
-    A->Apply(x, V[0]);  // A * x -> V[0]
-    V[0].XPAY(-1.0, b); // b - V[0] -> V[0]
-    resAbs = ri = V[0].Norm2();
+    A->Apply(x, wk);  // A * x -> wk
+    wk.XPAY(-1.0, b); // b - wk -> wk
+    resAbs = ri = wk.Norm2();
     denAbs      = (resAbs > CLOSE_ZERO) ? resAbs : CLOSE_ZERO;
 
     // FGMRES(m) outer iteration
@@ -140,7 +149,9 @@ FaspRetCode FGMRES::Solve(const VEC& b, VEC& x)
         // Initial search direction: r/||r||
         if (resAbs < SMALL_DBL) break; // Resiudal is too small
         var[0] = resAbs;
-        V[0].Scale(1 / resAbs);
+        wk.Scale(1 / resAbs);
+        V.SetCol(0, wk); // continue with the rounded copy if stored in low precision
+        if (basisPrec != BASIS_DOUBLE) V.CopyCol(0, wk);
 
         // RESTART CYCLE (right-preconditioning)
         count = 0;
@@ -156,39 +167,38 @@ FaspRetCode FGMRES::Solve(const VEC& b, VEC& x)
 
             // Apply preconditioner
             tmp.SetValues(len, 0.0);
-            pcd->Solve(V[count_1], Z[count_1]);
-
-            A->Apply(Z[count_1], V[count]);
-
-            // Modified Gram-Schmidt orthogonalization
-            for (USI j = 0; j < count; ++j) {
-                hh[j][count_1] = V[count].Dot(V[j]);
-                V[count].AXPBY(1.0, -hh[j][count_1], V[j]);
+            pcd->Solve(wk, tmp); // wk holds the newest basis vector
+            Z.SetCol(count_1, tmp);
+            if (basisPrec != BASIS_DOUBLE) Z.CopyCol(count_1, tmp);
+
+            A->Apply(tmp, wk);
+
+            // Orthogonalize against the basis; new column of H in hj
+            DBL* hj   = hh.data() + count_1 * ld;
+            t         = V.Orthogonalize(count, orthType, wk, hj);
+            hj[count] = t;
+
+            // If t=0, we get solution subspace after the rotations below
+            breakdown = fabs(t) <= CLOSE_ZERO;
+            if (!breakdown) {
+                wk.Scale(1.0 / t);
+                V.SetCol(count, wk);
+                if (basisPrec != BASIS_DOUBLE) V.CopyCol(count, wk);
             }
-            t                  = V[count].Norm2();
-            hh[count][count_1] = t;
-
-            // If t=0, we get solution subspace
-            if (fabs(t) > SMALL_DBL)
-                V[count].Scale(1.0 / t);
-            else
-                break;
 
             for (USI j = 1; j < count; ++j) {
-                t                  = hh[j - 1][count_1];
-                hh[j - 1][count_1] = hsin[j - 1] * hh[j][count_1] + hcos[j - 1] * t;
-                hh[j][count_1]     = -hsin[j - 1] * t + hcos[j - 1] * hh[j][count_1];
+                t         = hj[j - 1];
+                hj[j - 1] = hsin[j - 1] * hj[j] + hcos[j - 1] * t;
+                hj[j]     = -hsin[j - 1] * t + hcos[j - 1] * hj[j];
             }
 
-            t = hh[count][count_1] * hh[count][count_1];
-            t += hh[count_1][count_1] * hh[count_1][count_1];
+            t = hj[count] * hj[count] + hj[count_1] * hj[count_1];
             t = sqrt(t);
 
-            gamma                = t > SMALL_DBL ? t : SMALL_DBL;
-            hcos[count_1]        = hh[count_1][count_1] / gamma;
-            hsin[count_1]        = hh[count][count_1] / gamma;
-            hh[count_1][count_1] = hsin[count_1] * hh[count][count_1] +
-                                   hcos[count_1] * hh[count_1][count_1];
+            gamma         = t > SMALL_DBL ? t : SMALL_DBL;
+            hcos[count_1] = hj[count_1] / gamma;
+            hsin[count_1] = hj[count] / gamma;
+            hj[count_1]   = hsin[count_1] * hj[count] + hcos[count_1] * hj[count_1];
 
             var[count]   = -hsin[count_1] * var[count_1];
             var[count_1] = hcos[count_1] * var[count_1];
@@ -197,7 +207,8 @@ FaspRetCode FGMRES::Solve(const VEC& b, VEC& x)
             resAbsOld    = resAbs;
             resRel       = resAbs / denAbs;
 
-            // Exit restart cycle if reaches tolerance
+            // Exit restart cycle if breaks down or reaches tolerance
+            if (breakdown) break;
             if ((resAbs < params.absTol || resRel < params.relTol) &&
                 numIter > params.minIter)
                 break;
@@ -205,18 +216,13 @@ FaspRetCode FGMRES::Solve(const VEC& b, VEC& x)
         } // end of restart cycle
 
         // Compute solution, first solve upper triangular system
-        var[count_1] = var[count_1] / hh[count_1][count_1];
-        for (USI k = count - 2; k >= 0; --k) {
-            t = 0.0;
-            for (USI j = k + 1; j < count; ++j) t -= hh[k][j] * var[j];
-            t += var[k];
-            var[k] = t / hh[k][k];
+        for (INT k = count_1; k >= 0; --k) {
+            t = var[k];
+            for (USI j = k + 1; j < count; ++j) t -= hh[k + j * ld] * var[j];
+            var[k] = t / hh[k + k * ld];
         }
 
-        wk = Z[count_1];
-        wk.Scale(var[count_1]);
-
-        for (USI j = count - 2; j >= 0; --j) wk.AXPBY(1.0, var[j], Z[j]);
+        Z.Combine(count, var.data(), wk);
 
         x.AXPY(1.0, wk);
 
@@ -233,34 +239,26 @@ FaspRetCode FGMRES::Solve(const VEC& b, VEC& x)
         // Prepare for the next iteration
         //---------------------------------------------
         // Compute residual vector and continue loop
-        A->Apply(x, V[0]);  // A * x -> V[0]
-        V[0].XPAY(-1.0, b); // b - V[0] -> V[0]
+        A->Apply(x, wk);  // A * x -> wk
+        wk.XPAY(-1.0, b); // b - wk -> wk
 
         // Check whether converged
-        resAbs = rj = V[0].Norm2();
+        resAbs = rj = wk.Norm2();
         resRel      = resAbs / denAbs;
         if ((resRel < params.relTol || resAbs < params.absTol) &&
             numIter >= params.minIter)
             break;
 
-        // Choose restart number adaptively
-        cr = rj / ri;
+        // Choose restart number for the next cycle
+        UpdateRestart(rj / ri);
         ri = rj;
-        if (cr > max_cr)
-            restart = maxRestart;
-        else if (cr <= max_cr && cr >= min_cr) {
-            if (restart - decrease > minRestart)
-                restart -= decrease;
-            else
-                restart = maxRestart;
-        }
 
     } // end of main while loop
 
     // If minIter == numIter == maxIter (preconditioner only), skip this
     if (!(numIter == params.minIter && numIter == params.maxIter)) {
-        norm2   = V[0].Norm2();
-        normInf = V[0].NormInf();
+        norm2   = wk.Norm2();
+        normInf = wk.NormInf();
         PrintFinal(numIter, resRel, resAbs, ratio);
     }
 
@@ -277,4 +275,9 @@ FaspRetCode FGMRES::Solve(const VEC& b, VEC& x)
 /*----------------------------------------------------------------------------*/
 /*  Kailei Zhang        July/17/2020     Create file                          */
 /*  Chensong Zhang      Sep/16/2021      Restructure file                     */
+/*  Chensong Zhang      Oct/19/2026      Contiguous basis, low-sync CGS2      */
+/*  Chensong Zhang      Oct/19/2026      Fixed restart, hook for VFGMRES      */
+/*  Chensong Zhang      Oct/19/2026      Add reduced-precision basis option   */
+/*  Chensong Zhang      Oct/19/2026      Reset restart at the start of Solve  */
+/*  Chensong Zhang      Oct/19/2026      Unused rate parameter                */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -17,26 +17,33 @@
 
 // FASPXX header files
 #include "ErrorLog.hxx"
+#include "KrylovBasis.hxx"
 #include "LOP.hxx"
 #include "SOL.hxx"
 
 /*! \class FGMRES
  *  \brief Preconditioned flexible generalized minimal residual method.
+ *
+ *  The restart number is fixed. FGMRES used to adapt it between minRestart and
+ *  maxRestart after each cycle; since Oct/19/2026 that rule is in VFGMRES, which
+ *  has to be used to get the former behavior.
  */
 class FGMRES : public SOL
 {
-private:
+protected:
     VEC wk;
     VEC safe;
     VEC tmp;
 
-    std::vector<std::vector<double>> hh;
-    std::vector<double>              hsin;
-    std::vector<double>              hcos;
-    std::vector<double>              var;
+    std::vector<double> hh; ///< Hessenberg matrix, column by column
+    std::vector<double> hsin;
+    std::vector<double> hcos;
+    std::vector<double> var;
 
-    std::vector<VEC> V;
-    std::vector<VEC> Z;
+    KrylovBasis V;         ///< orthonormal Krylov basis
+    KrylovBasis Z;         ///< preconditioned basis vectors
+    OrthType    orthType;  ///< orthogonalization scheme
+    BasisPrec   basisPrec; ///< storage precision of V and Z
 
     USI maxRestart;
     USI minRestart;
@@ -48,6 +55,12 @@ private:
     const double min_cr   = 0.17364817766693041;
     const USI    decrease = 3;
 
+    /// Allocate work vectors and the bases for the current solver type.
+    FaspRetCode SetupWork(const LOP& A);
+
+    /// Choose the next restart number from the convergence rate; fixed for FGMRES.
+    virtual void UpdateRestart(double rate);
+
 public:
     /// Default constructor.
     FGMRES()
@@ -58,17 +71,25 @@ public:
         , hsin(0)
         , hcos(0)
         , var(0)
+        , orthType(ORTH_CGS2_LOW)
+        , basisPrec(BASIS_DOUBLE)
         , maxRestart(30)
         , minRestart(10)
         , restart(20)
         , len(0){};
 
     /// Default destructor.
-    ~FGMRES() = default;
+    virtual ~FGMRES() = default;
 
     /// Set the maximum and minmum restart numbers for variable FGMRES.
     void SetMaxMinRestart(const USI maxRestart, const USI minRestart);
 
+    /// Set the orthogonalization scheme of the Krylov basis.
+    void SetOrthType(OrthType type);
+
+    /// Set the storage precision of V and Z, before Setup.
+    void SetBasisPrec(BasisPrec prec);
+
     /// Setup the FGMRES method.
     FaspRetCode Setup(const LOP& A) override;
 
@@ -88,4 +109,7 @@ public:
 /*----------------------------------------------------------------------------*/
 /*  Kailei Zhang        July/16/2020     Create file                          */
 /*  Chensong Zhang      Sep/16/2021      Restructure file                     */
+/*  Chensong Zhang      Oct/19/2026      Contiguous basis, low-sync CGS2      */
+/*  Chensong Zhang      Oct/19/2026      Restart fixed, adaptive in VFGMRES   */
+/*  Chensong Zhang      Oct/19/2026      Add reduced-precision basis option   */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
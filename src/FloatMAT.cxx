@@ -0,0 +1,107 @@
+/*! \file    FloatMAT.cxx
+ *  \brief   CSR matrix with single precision entries
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// FASPXX header files
+#include "FloatMAT.hxx"
+
+/// Round the entries of a MAT to single precision.
+FloatMAT::FloatMAT(const MAT& mat)
+    : nnz(0)
+{
+    FaspRetCode retCode = SetValues(mat);
+    if (retCode < 0) throw(FaspRunTime(retCode, __FILE__, __FUNCTION__, __LINE__));
+}
+
+/// Round the entries of a MAT to single precision; the indices are copied.
+FaspRetCode FloatMAT::SetValues(const MAT& mat)
+{
+    if (mat.values.size() != mat.nnz) return FaspRetCode::ERROR_MAT_DATA;
+
+    try {
+        values.assign(mat.values.begin(), mat.values.end());
+        colInd = mat.colInd;
+        rowPtr = mat.rowPtr;
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    nrow = mat.nrow;
+    mcol = mat.mcol;
+    nnz  = mat.nnz;
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Return this->nnz.
+USI FloatMAT::GetNNZ() const { return nnz; }
+
+/// Number of bytes of values, column indices, and row pointers.
+size_t FloatMAT::GetBytes() const
+{
+    return values.size() * sizeof(float) +
+           (colInd.size() + rowPtr.size()) * sizeof(USI);
+}
+
+/// Sparse matrix-vector multiplication, summing up in double precision.
+void FloatMAT::Apply(const VEC& v, VEC& w) const
+{
+    const DBL* x;
+    DBL*       y;
+    v.GetArray(&x);
+    w.GetArray(&y);
+
+    const float* val = values.data();
+    const USI*   col = colInd.data();
+    const INT    n   = nrow;
+
+    INT i;
+#pragma omp parallel for schedule(static)
+    for (i = 0; i < n; ++i) {
+        DBL sum = 0.0;
+        for (USI k = rowPtr[i]; k < rowPtr[i + 1]; ++k) sum += val[k] * x[col[k]];
+        y[i] = sum;
+    }
+}
+
+/// Residual r = b - Ax, summing up in double precision.
+void FloatMAT::Residual(const VEC& b, const VEC& x, VEC& r) const
+{
+    if (x.NormInf() < CLOSE_ZERO) {
+        r = b; // if x = 0, for preconditioning
+        return;
+    }
+
+    const DBL *bv, *xv;
+    DBL*       rv;
+    b.GetArray(&bv);
+    x.GetArray(&xv);
+    r.GetArray(&rv);
+
+    const float* val = values.data();
+    const USI*   col = colInd.data();
+    const INT    n   = nrow;
+
+    INT i;
+#pragma omp parallel for schedule(static)
+    for (i = 0; i < n; ++i) {
+        DBL sum = bv[i];
+        for (USI k = rowPtr[i]; k < rowPtr[i + 1]; ++k) sum -= val[k] * xv[col[k]];
+        rv[i] = sum;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,79 @@
+/*! \file    FloatMAT.hxx
+ *  \brief   CSR matrix with single precision entries
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+/*! Important Note:
+ *-----------------------------------------------------------------------------------
+ *  The entries of a MAT are rounded to float, the column indices and row pointers
+ *  are kept. The products are summed up in double, so the only error is the
+ *  relative perturbation of about 6e-8 of each entry. SpMV is bound by memory
+ *  traffic, which drops from 12 to 8 bytes per nonzero.
+ *
+ *  It is meant for the inner solves of mixed-precision iterative refinement, where
+ *  the residual is computed with the original MAT.
+ */
+
+#ifndef __FLOATMAT_HEADER__ /*-- allow multiple inclusions --*/
+#define __FLOATMAT_HEADER__ /**< indicate FloatMAT.hxx has been included before */
+
+// Standard header files
+#include <vector>
+
+// FASPXX header files
+#include "LOP.hxx"
+#include "MAT.hxx"
+
+/*! \class FloatMAT
+ *  \brief Read-only CSR matrix with entries in single precision.
+ */
+class FloatMAT : public LOP
+{
+private:
+    USI                nnz;    ///< number of nonzeros of the matrix
+    std::vector<float> values; ///< nonzero entries in single precision
+    std::vector<USI>   colInd; ///< column indices of the nonzero in values
+    std::vector<USI>   rowPtr; ///< pointers to the beginning of each row in values
+
+public:
+    /// Default constructor.
+    FloatMAT()
+        : nnz(0){};
+
+    /// Round the entries of a MAT to single precision.
+    explicit FloatMAT(const MAT& mat);
+
+    /// Default destructor.
+    ~FloatMAT() = default;
+
+    /// Round the entries of a MAT to single precision.
+    FaspRetCode SetValues(const MAT& mat);
+
+    /// Get number of nonzeros of the matrix.
+    USI GetNNZ() const;
+
+    /// Get number of bytes used by the matrix.
+    size_t GetBytes() const;
+
+    /// Sparse matrix-vector multiplication.
+    void Apply(const VEC& v, VEC& w) const override;
+
+    /// Residual b - Ax.
+    void Residual(const VEC& b, const VEC& x, VEC& r) const override;
+};
+
+#endif /* end if for __FLOATMAT_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
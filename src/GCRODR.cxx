@@ -0,0 +1,434 @@
+/*! \file    GCRODR.cxx
+ *  \brief   GMRES with deflated restarting and subspace recycling definition
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <algorithm>
+#include <numeric>
+
+// FASPXX header files
+#include "DenseUtil.hxx"
+#include "GCRODR.hxx"
+
+/// Set the number of harmonic Ritz vectors kept at restarts.
+void GCRODR::SetNumDeflate(const USI k) { this->numDeflate = k; }
+
+/// Set the orthogonalization scheme of the Krylov basis.
+void GCRODR::SetOrthType(const OrthType type) { this->orthType = type; }
+
+/// Get the dimension of the current recycled space.
+USI GCRODR::GetNumRecycled() const { return numRecycled; }
+
+/// Set up the GCRO-DR method.
+FaspRetCode GCRODR::Setup(const LOP& A)
+{
+    // Set solver type
+    SetSolType(SOLType::SOLVER_GCRODR);
+
+    return SetupWork(A);
+}
+
+/// Set up the GMRES-DR method.
+FaspRetCode GMRESDR::Setup(const LOP& A)
+{
+    // Set solver type
+    SetSolType(SOLType::SOLVER_GMRESDR);
+
+    return SetupWork(A);
+}
+
+/// Allocate work vectors and the bases; keep U if the size does not change.
+FaspRetCode GCRODR::SetupWork(const LOP& A)
+{
+    // At least one Arnoldi step per cycle after k + 1 vectors are kept
+    maxRestart = std::max(params.restart, USI(2));
+    numDeflate = std::min(numDeflate, USI(maxRestart - 2));
+
+    // The recycled space survives a new Setup with a matrix of the same size
+    const USI newLen = A.GetColSize();
+    if (newLen != len || U.GetNumVecs() != numDeflate + 1) numRecycled = 0;
+    len = newLen;
+
+    // Allocate memory for temporary vectors
+    try {
+        wk.SetValues(len, 0.0);
+        zk.SetValues(len, 0.0);
+        rk.SetValues(len, 0.0);
+        safe.SetValues(len, 0.0);
+
+        hh.assign((maxRestart + 1) * maxRestart, 0.0);
+        hraw.assign((maxRestart + 1) * maxRestart, 0.0);
+        bb.assign((numDeflate + 1) * maxRestart, 0.0);
+        hsin.assign(maxRestart, 0.0);
+        hcos.assign(maxRestart, 0.0);
+        var.assign(maxRestart + 1, 0.0);
+        coef.assign(maxRestart + 1, 0.0);
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    // Allocate memory for the bases
+    FaspRetCode retCode = V.Allocate(len, maxRestart + 1);
+    if (retCode == FaspRetCode::SUCCESS && numRecycled == 0)
+        retCode = U.Allocate(len, numDeflate + 1);
+    if (retCode == FaspRetCode::SUCCESS) retCode = C.Allocate(len, numDeflate + 1);
+    if (retCode == FaspRetCode::SUCCESS) retCode = Unew.Allocate(len, numDeflate + 1);
+    if (retCode == FaspRetCode::SUCCESS) retCode = Cnew.Allocate(len, numDeflate + 1);
+    if (retCode != FaspRetCode::SUCCESS) return retCode;
+
+    // Setup the coefficient matrix
+    this->A = &A;
+
+    // Print used parameters
+    if (params.verbose > PRINT_MIN) PrintParam(std::cout);
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Clean up work data and forget the recycled space.
+void GCRODR::Clean()
+{
+    numRecycled = 0;
+
+    wk.SetValues(len, 0.0);
+    zk.SetValues(len, 0.0);
+    rk.SetValues(len, 0.0);
+    safe.SetValues(len, 0.0);
+
+    std::fill(hh.begin(), hh.end(), 0.0);
+    std::fill(hraw.begin(), hraw.end(), 0.0);
+    std::fill(bb.begin(), bb.end(), 0.0);
+    std::fill(var.begin(), var.end(), 0.0);
+}
+
+/// Recompute C = A M^{-1} U with the current A and rescale U to match.
+void GCRODR::RefreshRecycled()
+{
+    // QR of A M^{-1} U column by column: C R = A M^{-1} U, then U <- U R^{-1}
+    const USI kk = numRecycled;
+    DBL*      r  = coef.data();
+    for (USI i = 0; i < kk; ++i) {
+        U.CopyCol(i, wk);
+        zk.SetValues(len, 0.0);
+        pcd->Solve(wk, zk);
+        A->Apply(zk, wk);
+
+        const DBL norm = wk.Norm2();
+        const DBL t    = C.Orthogonalize(i, orthType, wk, r);
+        if (t <= SMALL_TOL * norm) { // A M^{-1} U is (nearly) rank deficient
+            numRecycled = i;
+            return;
+        }
+        wk.Scale(1.0 / t);
+        C.SetCol(i, wk);
+
+        U.CopyCol(i, zk);
+        U.MultiAXPY(i, r, zk);
+        zk.Scale(1.0 / t);
+        U.SetCol(i, zk);
+    }
+}
+
+/// Replace U and C by harmonic Ritz vectors of a cycle with s Arnoldi steps.
+FaspRetCode GCRODR::UpdateRecycled(const USI s)
+{
+    const USI kk   = numRecycled;
+    const USI mm   = kk + s;           // columns of [U V_s]
+    const USI rows = mm + 1;           // columns of [C V_{s+1}]
+    const USI ld   = maxRestart + 1;   // leading dimension of hh and hraw
+    const USI ldb  = numDeflate + 1;   // leading dimension of bb
+    const USI kNew = std::min(numDeflate, USI(mm - 1));
+    if (s == 0 || kNew == 0) return FaspRetCode::SUCCESS;
+
+    try {
+        // G = [C V_{s+1}]^T A M^{-1} [U D, V_s] = [D B; 0 Hbar], D = diag(1/|u_i|)
+        // W = [C V_{s+1}]^T [U D, V_s]
+        std::vector<DBL> d(kk), G(rows * mm, 0.0), W(rows * mm, 0.0);
+        for (USI i = 0; i < kk; ++i) {
+            U.CopyCol(i, wk);
+            d[i] = 1.0 / wk.Norm2();
+            C.MultiDot(kk, wk, &W[i * rows]);
+            V.MultiDot(s + 1, wk, &W[kk + i * rows]);
+            for (USI j = 0; j < rows; ++j) W[j + i * rows] *= d[i];
+            G[i + i * rows] = d[i];
+        }
+        for (USI j = 0; j < s; ++j) {
+            DBL* gj = &G[(kk + j) * rows];
+            std::copy(&bb[j * ldb], &bb[j * ldb] + kk, gj);
+            std::copy(&hraw[j * ld], &hraw[j * ld] + j + 2, gj + kk);
+            W[kk + j + (kk + j) * rows] = 1.0;
+        }
+
+        // Harmonic Ritz pairs: G^T G z = theta G^T W z, as (G^T G)^{-1} G^T W
+        std::vector<DBL> S(mm * mm, 0.0), T(mm * mm, 0.0);
+        for (USI j = 0; j < mm; ++j) {
+            for (USI i = 0; i < mm; ++i) {
+                DBL sij = 0.0, tij = 0.0;
+                for (USI l = 0; l < rows; ++l) {
+                    sij += G[l + i * rows] * G[l + j * rows];
+                    tij += G[l + i * rows] * W[l + j * rows];
+                }
+                S[i + j * mm] = sij;
+                T[i + j * mm] = tij;
+            }
+        }
+        FaspRetCode retCode = DenseSolve(mm, S.data(), mm, T.data());
+        if (retCode != FaspRetCode::SUCCESS) return retCode;
+
+        std::vector<DBL> wr, wi;
+        retCode = DenseEigValues(mm, T, wr, wi);
+        if (retCode != FaspRetCode::SUCCESS) return retCode;
+
+        // Smallest |theta| are the largest |1/theta|; conjugates come in pairs
+        std::vector<USI> order(mm);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](USI a, USI b) {
+            const DBL ma = wr[a] * wr[a] + wi[a] * wi[a];
+            const DBL mb = wr[b] * wr[b] + wi[b] * wi[b];
+            return ma > mb || (ma == mb && wi[a] > wi[b]);
+        });
+
+        // Real and imaginary parts of the eigenvectors span the kept subspace
+        std::vector<DBL> P(mm * (kNew + 1)), vi(mm);
+        USI              kSel = 0;
+        for (USI idx : order) {
+            if (kSel >= kNew) break;
+            if (wi[idx] < 0.0) continue; // taken with its conjugate
+            retCode = DenseEigVector(mm, T, wr[idx], wi[idx], &P[kSel * mm], vi.data());
+            if (retCode != FaspRetCode::SUCCESS) return retCode;
+            ++kSel;
+            if (wi[idx] > 0.0) std::copy(vi.begin(), vi.end(), &P[kSel++ * mm]);
+        }
+
+        // Q R = G P, then C_new = [C V_{s+1}] Q and U_new = [U D, V_s] P R^{-1}
+        std::vector<DBL> Q(rows * kSel, 0.0), R(kSel * kSel);
+        for (USI j = 0; j < kSel; ++j)
+            for (USI l = 0; l < mm; ++l)
+                for (USI i = 0; i < rows; ++i)
+                    Q[i + j * rows] += G[i + l * rows] * P[l + j * mm];
+        retCode = DenseQR(rows, kSel, Q.data(), R.data());
+        if (retCode != FaspRetCode::SUCCESS) return retCode;
+
+        for (USI j = 0; j < kSel; ++j) {
+            DBL* pj = &P[j * mm];
+            for (USI i = 0; i < j; ++i)
+                for (USI l = 0; l < mm; ++l) pj[l] -= R[i + j * kSel] * P[l + i * mm];
+            for (USI l = 0; l < mm; ++l) pj[l] /= R[j + j * kSel];
+        }
+
+        for (USI j = 0; j < kSel; ++j) {
+            DBL* pj = &P[j * mm];
+            for (USI i = 0; i < kk; ++i) coef[i] = d[i] * pj[i];
+            U.Combine(kk, coef.data(), wk);
+            V.AddCombine(s, pj + kk, wk);
+            Unew.SetCol(j, wk);
+
+            C.Combine(kk, &Q[j * rows], wk);
+            V.AddCombine(s + 1, &Q[kk + j * rows], wk);
+            Cnew.SetCol(j, wk);
+        }
+        U.Swap(Unew);
+        C.Swap(Cnew);
+        numRecycled = kSel;
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Right-preconditioned GCRO-DR solver.
+FaspRetCode GCRODR::Solve(const VEC& b, VEC& x)
+{
+    FaspRetCode errorCode = FaspRetCode::SUCCESS;
+
+    // local variables
+    double gamma, t, beta;
+    double resAbs = 1.0, resRel = 1.0, denAbs = 1.0, ratio = 0.0, resAbsOld = 1.0;
+    USI    count = 0, count_1 = 0, kk;
+    USI    ld        = maxRestart + 1; // leading dimension of hh and hraw
+    USI    ldb       = numDeflate + 1; // leading dimension of bb
+    bool   breakdown = false, converged = false;
+
+    PrintHead();
+
+    // Initialize iterative method
+    numIter = 0;
+    safe    = x;
+    if (!recycle) numRecycled = 0;
+
+    // Recycled space from the last Solve: recompute C for the current A
+    if (numRecycled > 0) RefreshRecycled();
+
+    // Initialize residual norm
+    A->Apply(x, rk);  // A * x -> rk
+    rk.XPAY(-1.0, b); // b - rk -> rk
+    resAbs = rk.Norm2();
+    denAbs = (resAbs > CLOSE_ZERO) ? resAbs : CLOSE_ZERO;
+
+    // Minimize the residual over the recycled space: x += M^{-1} U C^T r
+    if (numRecycled > 0) {
+        C.MultiDot(numRecycled, rk, coef.data());
+        C.MultiAXPY(numRecycled, coef.data(), rk);
+        U.Combine(numRecycled, coef.data(), wk);
+        zk.SetValues(len, 0.0);
+        pcd->Solve(wk, zk);
+        x.AXPY(1.0, zk);
+        resAbs = rk.Norm2();
+        resRel = resAbs / denAbs;
+    }
+
+    // GCRO-DR(m,k) outer iteration
+    while (numIter < params.maxIter) {
+
+        // Start from minIter instead of 0
+        if (numIter == params.minIter) {
+            resRel    = resAbs / denAbs;
+            resAbsOld = resAbs;
+            if (resRel < params.relTol || resAbs < params.absTol) break;
+        }
+
+        // Initial search direction: r/||r||
+        if (resAbs < CLOSE_ZERO) break; // Resiudal is too small
+        kk   = numRecycled;
+        beta = resAbs;
+        std::fill(var.begin(), var.end(), 0.0);
+        var[0] = beta;
+        wk     = rk;
+        wk.Scale(1.0 / beta);
+        V.SetCol(0, wk);
+
+        // RESTART CYCLE with (I - C C^T) A M^{-1} (right-preconditioning)
+        count = 0;
+        while (count < maxRestart - kk && numIter < params.maxIter) {
+
+            if (numIter >= params.minIter) PrintInfo(numIter, resRel, resAbs, ratio);
+
+            ++numIter;         // total iteration number
+            count_1 = count++; // inner iteration number
+
+            // Apply preconditioner and matrix
+            zk.SetValues(len, 0.0);
+            pcd->Solve(wk, zk); // wk holds the newest basis vector
+            A->Apply(zk, wk);
+
+            // Orthogonalize against C, then against V; new column of H in hj
+            if (kk > 0) C.Orthogonalize(kk, orthType, wk, bb.data() + count_1 * ldb);
+            DBL* hj   = hh.data() + count_1 * ld;
+            t         = V.Orthogonalize(count, orthType, wk, hj);
+            hj[count] = t;
+            std::copy(hj, hj + count + 1, hraw.data() + count_1 * ld);
+
+            // If t=0, we get solution subspace after the rotations below
+            breakdown = fabs(t) <= CLOSE_ZERO;
+            if (!breakdown) {
+                wk.Scale(1.0 / t);
+                V.SetCol(count, wk);
+            }
+
+            for (USI j = 1; j < count; ++j) {
+                t         = hj[j - 1];
+                hj[j - 1] = hsin[j - 1] * hj[j] + hcos[j - 1] * t;
+                hj[j]     = -hsin[j - 1] * t + hcos[j - 1] * hj[j];
+            }
+
+            t = hj[count] * hj[count] + hj[count_1] * hj[count_1];
+            t = sqrt(t);
+
+            gamma         = t > CLOSE_ZERO ? t : CLOSE_ZERO;
+            hcos[count_1] = hj[count_1] / gamma;
+            hsin[count_1] = hj[count] / gamma;
+            hj[count_1]   = hsin[count_1] * hj[count] + hcos[count_1] * hj[count_1];
+
+            var[count]   = -hsin[count_1] * var[count_1];
+            var[count_1] = hcos[count_1] * var[count_1];
+            resAbs       = fabs(var[count]);
+            ratio        = resAbs / resAbsOld;
+            resAbsOld    = resAbs;
+            resRel       = resAbs / denAbs;
+
+            // Exit restart cycle if breaks down or reaches tolerance
+            if (breakdown) break;
+            if ((resAbs < params.absTol || resRel < params.relTol) &&
+                numIter > params.minIter)
+                break;
+
+        } // end of restart cycle
+
+        // Compute solution, first solve upper triangular system
+        for (INT k = count_1; k >= 0; --k) {
+            t = var[k];
+            for (USI j = k + 1; j < count; ++j) t -= hh[k + j * ld] * var[j];
+            var[k] = t / hh[k + k * ld];
+        }
+
+        // x += M^{-1} (V y - U B y)
+        V.Combine(count, var.data(), wk);
+        if (kk > 0) {
+            for (USI i = 0; i < kk; ++i) {
+                coef[i] = 0.0;
+                for (USI j = 0; j < count; ++j) coef[i] += bb[i + j * ldb] * var[j];
+            }
+            U.MultiAXPY(kk, coef.data(), wk);
+        }
+        zk.SetValues(len, 0.0);
+        pcd->Solve(wk, zk);
+        x.AXPY(1.0, zk);
+
+        // Save the best solution so far
+        if (numIter >= params.savIter && resAbs < resAbsOld) safe = x;
+
+        // Residual r = V_{s+1} (beta e_1 - Hbar y) without applying A
+        for (USI i = 0; i <= count; ++i) {
+            coef[i] = (i == 0) ? beta : 0.0;
+            for (USI j = (i > 0 ? i - 1 : 0); j < count; ++j)
+                coef[i] -= hraw[i + j * ld] * var[j];
+        }
+        V.Combine(count + 1, coef.data(), rk);
+
+        // Check whether converged
+        resAbs    = rk.Norm2();
+        resRel    = resAbs / denAbs;
+        converged = (resRel < params.relTol || resAbs < params.absTol) &&
+                    numIter >= params.minIter;
+
+        // Deflate for the next cycle, or keep the subspace for the next Solve
+        if (!converged || recycle) {
+            if (UpdateRecycled(count) != FaspRetCode::SUCCESS) numRecycled = 0;
+        }
+        if (converged) break;
+
+    } // end of main while loop
+
+    if (numIter >= params.maxIter && !converged)
+        errorCode = FaspRetCode::ERROR_SOLVER_MAXIT;
+
+    // If minIter == numIter == maxIter (preconditioner only), skip this
+    if (!(numIter == params.minIter && numIter == params.maxIter)) {
+        A->Apply(x, wk);  // A * x -> wk
+        wk.XPAY(-1.0, b); // b - wk -> wk
+        norm2   = wk.Norm2();
+        normInf = wk.NormInf();
+        PrintFinal(numIter, resRel, resAbs, ratio);
+    }
+
+    // Restore the saved best iteration if needed
+    if (numIter > params.savIter) x = safe;
+
+    return errorCode;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,142 @@
+/*! \file    GCRODR.hxx
+ *  \brief   GMRES with deflated restarting and subspace recycling declaration
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+/*! Important Note:
+ *-----------------------------------------------------------------------------------
+ *  GCRO-DR (Parks, de Sturler et al. 2006) keeps a subspace U of dimension k and
+ *  C = A M^{-1} U with orthonormal columns. Each cycle first removes the part of the
+ *  residual in range(C), then runs m-k Arnoldi steps with (I - C C^T) A M^{-1}. At
+ *  the end of a cycle, the k harmonic Ritz vectors of A M^{-1} with the smallest
+ *  harmonic Ritz values in range([U V]) become the new U, so the slow eigenmodes are
+ *  deflated in all later cycles instead of being rebuilt after every restart.
+ *
+ *  U is kept from one Solve to the next. For a sequence of systems with slowly
+ *  changing matrices, C is recomputed from U and the current A at the start of each
+ *  Solve and the recycled space deflates the new system from the first iteration.
+ *  GMRES-DR is the same iteration with U discarded at the start of each Solve; its
+ *  iterates coincide with those of Morgan's GMRES-DR in exact arithmetic.
+ */
+
+#ifndef __GCRODR_HEADER__ /*-- allow multiple inclusions --*/
+#define __GCRODR_HEADER__ /**< indicate GCRODR.hxx has been included before */
+
+// Standard header files
+#include <cmath>
+#include <vector>
+
+// FASPXX header files
+#include "ErrorLog.hxx"
+#include "KrylovBasis.hxx"
+#include "LOP.hxx"
+#include "SOL.hxx"
+
+/*! \class GCRODR
+ *  \brief Right-preconditioned GCRO-DR, GMRES with deflated restarting and recycling.
+ */
+class GCRODR : public SOL
+{
+protected:
+    USI      len;         ///< dimension of the solution vector
+    USI      maxRestart;  ///< dimension m of the search space in a cycle
+    USI      numDeflate;  ///< number k of harmonic Ritz vectors to keep
+    USI      numRecycled; ///< number of vectors in the current recycled space
+    bool     recycle;     ///< keep the recycled space from one Solve to the next
+    OrthType orthType;    ///< orthogonalization scheme
+
+    KrylovBasis V;    ///< orthonormal basis of the projected Krylov space
+    KrylovBasis U;    ///< recycled space, before preconditioning
+    KrylovBasis C;    ///< orthonormal basis of A M^{-1} U
+    KrylovBasis Unew; ///< work space for the next U
+    KrylovBasis Cnew; ///< work space for the next C
+
+    VEC wk;   ///< Work vector for the newest basis vector
+    VEC zk;   ///< Work vector for the preconditioned vector
+    VEC rk;   ///< Work vector for the residual
+    VEC safe; ///< Work vector for safe-guard
+
+    std::vector<DBL> hh;   ///< Hessenberg matrix, Givens rotations applied
+    std::vector<DBL> hraw; ///< Hessenberg matrix as built by Arnoldi
+    std::vector<DBL> bb;   ///< projections C^T A M^{-1} V of the cycle
+    std::vector<DBL> hsin; ///< sines of the Givens rotations
+    std::vector<DBL> hcos; ///< cosines of the Givens rotations
+    std::vector<DBL> var;  ///< rotated right-hand side and solution coefficients
+    std::vector<DBL> coef; ///< coefficients for combining basis vectors
+
+    /// Allocate work vectors and the bases; keep U if the size does not change.
+    FaspRetCode SetupWork(const LOP& A);
+
+    /// Recompute C = A M^{-1} U with the current A and rescale U to match.
+    void RefreshRecycled();
+
+    /// Replace U and C by harmonic Ritz vectors of a cycle with s Arnoldi steps.
+    FaspRetCode UpdateRecycled(USI s);
+
+public:
+    /// Default constructor.
+    GCRODR()
+        : len(0)
+        , maxRestart(30)
+        , numDeflate(10)
+        , numRecycled(0)
+        , recycle(true)
+        , orthType(ORTH_CGS2_LOW)
+        , wk(0)
+        , zk(0)
+        , rk(0)
+        , safe(0){};
+
+    /// Default destructor.
+    virtual ~GCRODR() = default;
+
+    /// Set the number of harmonic Ritz vectors kept at restarts.
+    void SetNumDeflate(USI k);
+
+    /// Set the orthogonalization scheme of the Krylov basis.
+    void SetOrthType(OrthType type);
+
+    /// Get the dimension of the current recycled space.
+    USI GetNumRecycled() const;
+
+    /// Setup the GCRO-DR method.
+    FaspRetCode Setup(const LOP& A) override;
+
+    /// Solve Ax=b using the GCRO-DR method.
+    FaspRetCode Solve(const VEC& b, VEC& x) override;
+
+    /// Clean up work data and forget the recycled space.
+    void Clean() override;
+};
+
+/*! \class GMRESDR
+ *  \brief Right-preconditioned GMRES with deflated restarting.
+ */
+class GMRESDR : public GCRODR
+{
+public:
+    /// Default constructor.
+    GMRESDR() { recycle = false; };
+
+    /// Default destructor.
+    ~GMRESDR() = default;
+
+    /// Setup the GMRES-DR method.
+    FaspRetCode Setup(const LOP& A) override;
+};
+
+#endif /* end if for __GCRODR_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
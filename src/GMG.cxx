@@ -0,0 +1,460 @@
+/*! \file    GMG.cxx
+ *  \brief   Geometric multigrid on structured grids definition
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// FASPXX header files
+#include "GMG.hxx"
+
+/// Shape of the Galerkin coarse operator of a stencil with shape S.
+template <StencilShape S>
+struct GalerkinShape {
+    static const StencilShape value =
+        (S == STENCIL_5P2D || S == STENCIL_9P2D) ? STENCIL_9P2D : STENCIL_27P3D;
+};
+
+/// Coarse points and weights interpolating fine point g in one direction.
+static inline USI InterpWeights(USI g, USI nc, USI* J, DBL* w)
+{
+    if (g % 2 == 1) { // on a coarse point
+        if ((g - 1) / 2 >= nc) return 0;
+        J[0] = (g - 1) / 2, w[0] = 1.0;
+        return 1;
+    }
+
+    USI m = 0; // between two coarse points
+    if (g >= 2) J[m] = g / 2 - 1, w[m++] = 0.5;
+    if (g / 2 < nc) J[m] = g / 2, w[m++] = 0.5;
+    return m;
+}
+
+/// Restriction from an nx x ny x nz fine grid.
+FullWeighting::FullWeighting(USI nx, USI ny, USI nz, bool coarsenZ)
+    : nx(nx)
+    , ny(ny)
+    , nz(nz)
+    , coarsenZ(coarsenZ)
+{
+    mcol = nx * ny * nz;
+    nrow = (nx - 1) / 2 * ((ny - 1) / 2) * (coarsenZ ? (nz - 1) / 2 : nz);
+}
+
+/// Restrict by the weights 1/4, 1/2, 1/4 in each coarsened direction.
+void FullWeighting::Apply(const VEC& x, VEC& y) const
+{
+    if (y.GetSize() != nrow) y.SetValues(nrow, 0.0);
+
+    const USI  cx = (nx - 1) / 2, cy = (ny - 1) / 2, cz = coarsenZ ? (nz - 1) / 2 : nz;
+    const DBL* xf;
+    DBL*       yc;
+    x.GetArray(&xf);
+    y.GetArray(&yc);
+
+    INT line;
+#pragma omp parallel for private(line) schedule(static)
+    for (line = 0; line < (INT)(cy * cz); ++line) {
+        const USI J = line % cy, K = line / cy;
+        DBL*      yl = yc + (size_t)line * cx;
+        for (USI I = 0; I < cx; ++I) yl[I] = 0.0;
+
+        // Fine lines around the coarse line
+        const USI kBeg = coarsenZ ? 2 * K : K, kEnd = coarsenZ ? 2 * K + 2 : K;
+        for (USI k = kBeg; k <= kEnd; ++k) {
+            for (USI j = 2 * J; j <= 2 * J + 2; ++j) {
+                const DBL  w  = (j == 2 * J + 1 ? 0.5 : 0.25) *
+                              (coarsenZ ? (k == 2 * K + 1 ? 0.5 : 0.25) : 1.0);
+                const DBL* xl = xf + ((size_t)k * ny + j) * nx;
+#pragma omp simd
+                for (USI I = 0; I < cx; ++I)
+                    yl[I] += w * (0.25 * xl[2 * I] + 0.5 * xl[2 * I + 1] +
+                                  0.25 * xl[2 * I + 2]);
+            }
+        }
+    }
+}
+
+/// Prolongation to an nx x ny x nz fine grid.
+Bilinear::Bilinear(USI nx, USI ny, USI nz, bool coarsenZ)
+    : nx(nx)
+    , ny(ny)
+    , nz(nz)
+    , coarsenZ(coarsenZ)
+{
+    nrow = nx * ny * nz;
+    mcol = (nx - 1) / 2 * ((ny - 1) / 2) * (coarsenZ ? (nz - 1) / 2 : nz);
+}
+
+/// Interpolate linearly in each coarsened direction.
+void Bilinear::Apply(const VEC& x, VEC& y) const
+{
+    if (y.GetSize() != nrow) y.SetValues(nrow, 0.0);
+
+    const USI  cx = (nx - 1) / 2, cy = (ny - 1) / 2, cz = coarsenZ ? (nz - 1) / 2 : nz;
+    const DBL* xc;
+    DBL*       yf;
+    x.GetArray(&xc);
+    y.GetArray(&yf);
+
+    INT line;
+#pragma omp parallel for private(line) schedule(static)
+    for (line = 0; line < (INT)(ny * nz); ++line) {
+        const USI j = line % ny, k = line / ny;
+        DBL*      yl = yf + (size_t)line * nx;
+        for (USI i = 0; i < nx; ++i) yl[i] = 0.0;
+
+        // Coarse lines around the fine line
+        USI Jy[2], Jz[2];
+        DBL wy[2], wz[2];
+        const USI my = InterpWeights(j, cy, Jy, wy);
+        USI       mz = 1;
+        if (coarsenZ)
+            mz = InterpWeights(k, cz, Jz, wz);
+        else
+            Jz[0] = k, wz[0] = 1.0;
+
+        for (USI c = 0; c < mz; ++c) {
+            for (USI a = 0; a < my; ++a) {
+                const DBL  w  = wy[a] * wz[c];
+                const DBL* xl = xc + ((size_t)Jz[c] * cy + Jy[a]) * cx;
+                for (USI I = 0; I < cx; ++I) {
+                    yl[2 * I] += 0.5 * w * xl[I];
+                    yl[2 * I + 1] += w * xl[I];
+                    yl[2 * I + 2] += 0.5 * w * xl[I];
+                }
+            }
+        }
+    }
+}
+
+/// Sweep the colors in reverse order, e.g. for post-smoothing.
+template <StencilShape S>
+void RBGS<S>::SetReverse(bool reverse)
+{
+    this->reverse = reverse;
+}
+
+/// Setup the smoother for a stencil operator.
+template <StencilShape S>
+FaspRetCode RBGS<S>::Setup(const StencilOp<S>& A)
+{
+    // Set solver type
+    SetSolType(SOLType::SOLVER_GS);
+
+    for (USI i = 0; i < A.GetRowSize(); ++i)
+        if (A.GetCoef(S / 2, i) == 0.0) return FaspRetCode::ERROR_MAT_ZERODIAG;
+
+    // Setup the coefficient matrix
+    this->A = &A;
+    oper    = &A;
+    for (USI p = 0; p < S; ++p) StencilOp<S>::GetPoint(p, dx[p], dy[p], dz[p]);
+
+    // Print used parameters if necessary
+    if (params.verbose > PRINT_MIN) PrintParam(std::cout);
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Relax all grid points of one color; points of the same color are independent.
+template <StencilShape S>
+void RBGS<S>::Relax(USI color, const DBL* b, DBL* x) const
+{
+    const StencilOp<S>& op = *oper;
+    const USI           nx = op.nx, ny = op.ny, nz = op.nz, n = op.nrow;
+    const DBL*          cf = op.coef.data();
+    const bool          var = op.variable;
+
+    INT line;
+#pragma omp parallel for private(line) schedule(static)
+    for (line = 0; line < (INT)(ny * nz); ++line) {
+        const USI j = line % ny, k = line / ny;
+
+        // First point of this color on the line, if any
+        USI first;
+        if (numColors == 2) {
+            first = (color + j + k) % 2;
+        } else {
+            if (j % 2 != (color / 2) % 2 || k % 2 != color / 4) continue;
+            first = color % 2;
+        }
+
+        bool valid[S], full = true;
+        for (USI p = 0; p < S; ++p) {
+            valid[p] = (USI)(j + dy[p]) < ny && (USI)(k + dz[p]) < nz;
+            full     = full && valid[p];
+        }
+
+        const size_t base = (size_t)line * nx;
+        for (USI i = first; i < nx; i += 2) {
+            const size_t idx = base + i;
+            DBL          sum = 0.0;
+            if (full && i > 0 && i + 1 < nx) {
+                for (USI p = 0; p < S; ++p)
+                    sum += (var ? cf[p * n + idx] : cf[p]) * x[idx + op.offset[p]];
+            } else {
+                for (USI p = 0; p < S; ++p) {
+                    if (!valid[p] || (USI)(i + dx[p]) >= nx) continue;
+                    sum += (var ? cf[p * n + idx] : cf[p]) * x[idx + op.offset[p]];
+                }
+            }
+            x[idx] += (b[idx] - sum) / (var ? cf[S / 2 * n + idx] : cf[S / 2]);
+        }
+    }
+}
+
+/// Do params.maxIter sweeps on Ax=b without checking convergence.
+template <StencilShape S>
+FaspRetCode RBGS<S>::Solve(const VEC& b, VEC& x)
+{
+    const DBL* bv;
+    DBL*       xv;
+    b.GetArray(&bv);
+    x.GetArray(&xv);
+
+    for (numIter = 0; numIter < params.maxIter; ++numIter)
+        for (USI c = 0; c < numColors; ++c) Relax(reverse ? numColors - 1 - c : c, bv, xv);
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Rediscretize: inject the stencil to the coarse points and scale it by 1/4.
+template <StencilShape S>
+static FaspRetCode RediscretizeOper(const StencilOp<S>& A, StencilOp<S>& Ac)
+{
+    const bool coarsenZ = !(S == STENCIL_5P2D || S == STENCIL_9P2D);
+    USI        nx, ny, nz;
+    A.GetGrid(nx, ny, nz);
+    const USI cx = (nx - 1) / 2, cy = (ny - 1) / 2, cz = coarsenZ ? (nz - 1) / 2 : nz;
+    const USI nc = cx * cy * cz;
+
+    std::vector<DBL> coef;
+    try {
+        coef.resize(A.IsVariable() ? (size_t)S * nc : (size_t)S);
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    if (!A.IsVariable()) {
+        for (USI p = 0; p < S; ++p) coef[p] = 0.25 * A.GetCoef(p, 0);
+    } else {
+        for (USI ic = 0; ic < nc; ++ic) {
+            const USI I = ic % cx, J = ic / cx % cy, K = ic / cx / cy;
+            const USI f = ((coarsenZ ? 2 * K + 1 : K) * ny + 2 * J + 1) * nx + 2 * I + 1;
+            for (USI p = 0; p < S; ++p) coef[(size_t)p * nc + ic] = 0.25 * A.GetCoef(p, f);
+        }
+    }
+
+    return Ac.SetValues(cx, cy, cz, coef);
+}
+
+/// Galerkin product R A P, computed stencil-wise for each coarse point.
+template <StencilShape S, StencilShape C>
+static FaspRetCode GalerkinOper(const StencilOp<S>& A, StencilOp<C>& Ac)
+{
+    const bool coarsenZ = (C == STENCIL_27P3D);
+    USI        nx, ny, nz;
+    A.GetGrid(nx, ny, nz);
+    const USI cx = (nx - 1) / 2, cy = (ny - 1) / 2, cz = coarsenZ ? (nz - 1) / 2 : nz;
+    const USI nc = cx * cy * cz;
+
+    std::vector<DBL> coef;
+    try {
+        coef.assign((size_t)C * nc, 0.0);
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    INT ic;
+#pragma omp parallel for private(ic) schedule(static)
+    for (ic = 0; ic < (INT)nc; ++ic) {
+        const USI I = ic % cx, J = ic / cx % cy, K = ic / cx / cy;
+        const USI kBeg = coarsenZ ? 2 * K : K, kEnd = coarsenZ ? 2 * K + 2 : K;
+
+        // Fine points f in row ic of R, their neighbors g, and the coarse points of g
+        for (USI fk = kBeg; fk <= kEnd; ++fk) {
+            for (USI fj = 2 * J; fj <= 2 * J + 2; ++fj) {
+                for (USI fi = 2 * I; fi <= 2 * I + 2; ++fi) {
+                    const DBL rw = (fi == 2 * I + 1 ? 0.5 : 0.25) *
+                                   (fj == 2 * J + 1 ? 0.5 : 0.25) *
+                                   (coarsenZ ? (fk == 2 * K + 1 ? 0.5 : 0.25) : 1.0);
+                    const USI f  = (fk * ny + fj) * nx + fi;
+                    for (USI p = 0; p < S; ++p) {
+                        INT dx, dy, dz;
+                        StencilOp<S>::GetPoint(p, dx, dy, dz);
+                        const USI gi = fi + dx, gj = fj + dy, gk = fk + dz;
+                        if (gi >= nx || gj >= ny || gk >= nz) continue;
+
+                        USI Ji[2], Jj[2], Jk[2];
+                        DBL wi[2], wj[2], wk[2];
+                        const USI mi = InterpWeights(gi, cx, Ji, wi);
+                        const USI mj = InterpWeights(gj, cy, Jj, wj);
+                        USI       mk = 1;
+                        if (coarsenZ)
+                            mk = InterpWeights(gk, cz, Jk, wk);
+                        else
+                            Jk[0] = gk, wk[0] = 1.0;
+
+                        const DBL a = rw * A.GetCoef(p, f);
+                        for (USI c = 0; c < mk; ++c) {
+                            for (USI b = 0; b < mj; ++b) {
+                                for (USI d = 0; d < mi; ++d) {
+                                    const USI q = (coarsenZ ? (Jk[c] + 1 - K) * 9 : 0) +
+                                                  (Jj[b] + 1 - J) * 3 + (Ji[d] + 1 - I);
+                                    coef[(size_t)q * nc + ic] += a * wi[d] * wj[b] * wk[c];
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Store the stencil only once if it is the same at all coarse points
+    bool             constant = true;
+    std::vector<DBL> ref(C, 0.0);
+    for (USI q = 0; q < C && constant; ++q) {
+        INT qx, qy, qz;
+        StencilOp<C>::GetPoint(q, qx, qy, qz);
+        bool found = false;
+        for (USI i = 0; i < nc && constant; ++i) {
+            const USI I = i % cx, J = i / cx % cy, K = i / cx / cy;
+            if (I + qx >= cx || J + qy >= cy || K + qz >= cz) continue;
+            if (!found) ref[q] = coef[(size_t)q * nc + i], found = true;
+            constant = (coef[(size_t)q * nc + i] == ref[q]);
+        }
+    }
+    if (constant) coef.swap(ref);
+
+    return Ac.SetValues(cx, cy, cz, coef);
+}
+
+/// Set how to form coarse-level operators.
+void GMG::SetCoarseType(GMGCoarse type) { coarseType = type; }
+
+/// Set max number of levels, including the finest one.
+void GMG::SetMaxLevels(USI levels) { maxLevels = levels; }
+
+/// Set the problem size at which coarsening stops.
+void GMG::SetCoarseSize(USI size) { coarseSize = size; }
+
+/// Set number of pre- and post-smoothing sweeps.
+void GMG::SetNumSweeps(USI sweeps) { numSweeps = sweeps; }
+
+/// Make the V-cycle symmetric, e.g. as a preconditioner for CG.
+void GMG::SetSymmetric(bool symmetric) { this->symmetric = symmetric; }
+
+/// Get number of levels, including the finest one.
+USI GMG::GetNumLevels() const { return transfers.size() / 2 + 1; }
+
+/// Build the levels below the one of A recursively.
+template <StencilShape S>
+FaspRetCode GMG::Coarsen(const StencilOp<S>& A)
+{
+    const bool coarsenZ = !(S == STENCIL_5P2D || S == STENCIL_9P2D);
+    const USI  level    = transfers.size() / 2;
+    USI        nx, ny, nz;
+    A.GetGrid(nx, ny, nz);
+
+    // Coarsest level: solve directly
+    if (nx < 3 || ny < 3 || (coarsenZ && nz < 3) || level + 1 >= maxLevels ||
+        (level > 0 && A.GetRowSize() <= coarseSize)) {
+        if (level == 0) return FaspRetCode::ERROR_MAT_SIZE; // nothing to coarsen
+        return directSol.Setup(A);
+    }
+
+    // Smoothers and transfer operators of this level
+    FaspRetCode retCode = FaspRetCode::SUCCESS;
+    try {
+        std::unique_ptr<RBGS<S>> pre(new RBGS<S>), post(new RBGS<S>);
+        pre->SetMaxIter(numSweeps);
+        post->SetMaxIter(numSweeps);
+        post->SetReverse(symmetric);
+        if ((retCode = pre->Setup(A)) < 0 || (retCode = post->Setup(A)) < 0)
+            return retCode;
+        smoothers.push_back(std::move(pre));
+        smoothers.push_back(std::move(post));
+
+        transfers.emplace_back(new FullWeighting(nx, ny, nz, coarsenZ));
+        transfers.emplace_back(new Bilinear(nx, ny, nz, coarsenZ));
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    // Coarse operator and the levels below it
+    if (coarseType == GMG_GALERKIN) {
+        StencilOp<GalerkinShape<S>::value>* Ac = new StencilOp<GalerkinShape<S>::value>;
+        opers.emplace_back(Ac);
+        if ((retCode = GalerkinOper(A, *Ac)) < 0) return retCode;
+        return Coarsen(*Ac);
+    } else {
+        StencilOp<S>* Ac = new StencilOp<S>;
+        opers.emplace_back(Ac);
+        if ((retCode = RediscretizeOper(A, *Ac)) < 0) return retCode;
+        return Coarsen(*Ac);
+    }
+}
+
+/// Setup the grid hierarchy for a stencil operator and wire it into MG.
+template <StencilShape S>
+FaspRetCode GMG::Setup(const StencilOp<S>& A)
+{
+    Clean();
+
+    FaspRetCode retCode = Coarsen(A);
+    if (retCode < 0) {
+        Clean();
+        return retCode;
+    }
+
+    const USI numCoarse = transfers.size() / 2;
+    if ((retCode = SetupALL(A, numCoarse)) < 0) return retCode;
+    for (USI l = 0; l < numCoarse; ++l) {
+        retCode = SetupLevel(l, transfers[2 * l].get(), transfers[2 * l + 1].get(),
+                             opers[l].get(), smoothers[2 * l].get(),
+                             smoothers[2 * l + 1].get(),
+                             l + 1 == numCoarse ? &directSol : nullptr);
+        if (retCode < 0) return retCode;
+    }
+    SetNumCycles(1); // V-cycle
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Clean up the grid hierarchy.
+void GMG::Clean()
+{
+    MG<LOP>::Clean();
+    opers.clear();
+    transfers.clear();
+    smoothers.clear();
+    directSol.Clean();
+}
+
+// Explicitly instantiate the supported shapes
+template class RBGS<STENCIL_5P2D>;
+template class RBGS<STENCIL_9P2D>;
+template class RBGS<STENCIL_7P3D>;
+template class RBGS<STENCIL_19P3D>;
+template class RBGS<STENCIL_27P3D>;
+
+template FaspRetCode GMG::Setup(const StencilOp<STENCIL_5P2D>& A);
+template FaspRetCode GMG::Setup(const StencilOp<STENCIL_9P2D>& A);
+template FaspRetCode GMG::Setup(const StencilOp<STENCIL_7P3D>& A);
+template FaspRetCode GMG::Setup(const StencilOp<STENCIL_19P3D>& A);
+template FaspRetCode GMG::Setup(const StencilOp<STENCIL_27P3D>& A);
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Release the MG arena in Clean        */
+/*  Chensong Zhang      Oct/19/2026      Same type in both conditional arms   */
+/*----------------------------------------------------------------------------*/
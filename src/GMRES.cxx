@@ -15,6 +15,13 @@
 /// Solve Ax=b using the GMRES method.
 FaspRetCode GMRES::Solve(const VEC& b, VEC& x)
 {
+    // Each solve starts from the restart number of Setup
+    restart = params.restart;
+    if (restart > maxRestart)
+        restart = maxRestart;
+    else if (restart < minRestart)
+        restart = minRestart;
+
     if (useRightPrecond)
         return this->RSolve(b, x);
     else
@@ -34,6 +41,12 @@ void GMRES::SetMaxMinRestart(const USI maxRestart, const USI minRestart)
     this->minRestart = minRestart;
 }
 
+/// Set the orthogonalization scheme of the Krylov basis.
+void GMRES::SetOrthType(const OrthType type) { this->orthType = type; }
+
+/// Set the storage precision of the Krylov basis, before Setup.
+void GMRES::SetBasisPrec(const BasisPrec prec) { this->basisPrec = prec; }
+
 /// Set up the GMRES method
 FaspRetCode GMRES::Setup(const LOP& A)
 {
@@ -50,25 +63,20 @@ FaspRetCode GMRES::Setup(const LOP& A)
         wk.SetValues(len, 0.0);
         tmp.SetValues(len, 0.0);
         safe.SetValues(len, 0.0);
-        var.resize(len);
+        var.resize(maxRestart + 1);
 
         hcos.resize(maxRestart + 1);
         hsin.resize(maxRestart);
-        hh.resize(maxRestart + 1);
-        for (USI j = 0; j < maxRestart + 1; ++j) hh[j].resize(maxRestart);
+        hh.resize((maxRestart + 1) * maxRestart);
     } catch (std::bad_alloc& ex) {
         return FaspRetCode::ERROR_ALLOC_MEM;
     }
 
     // Alocate memory for restart vectors
     while (maxRestart >= minRestart) {
-        try {
-            for (USI j = 0; j < maxRestart + 1; ++j) V.push_back(safe);
-            break;
-        } catch (std::bad_alloc& ex) {
-            maxRestart -= decrease; // reduce restart if memory is not enough
-            while (!V.empty()) V.resize(0);
-        }
+        if (V.Allocate(len, maxRestart + 1, basisPrec) == FaspRetCode::SUCCESS) break;
+        maxRestart -= decrease; // reduce restart if memory is not enough
+        V.Clean();
     }
     if (maxRestart < minRestart) return FaspRetCode::ERROR_ALLOC_MEM;
 
@@ -100,14 +108,11 @@ void GMRES::Clean()
     wk.SetValues(len, 0.0);
     tmp.SetValues(len, 0.0);
     safe.SetValues(len, 0.0);
-    var.assign(len, 0.0);
+    var.assign(maxRestart + 1, 0.0);
 
     hcos.assign(maxRestart + 1, 0.0);
     hsin.assign(maxRestart, 0.0);
-    hh.resize(maxRestart + 1);
-    for (USI j = 0; j < maxRestart + 1; ++j) hh[j].assign(maxRestart, 0.0);
-
-    V.assign(maxRestart + 1, safe);
+    hh.assign((maxRestart + 1) * maxRestart, 0.0);
 }
 
 /// Solve Ax=b using the right preconditioned GMRES method.
@@ -119,6 +124,8 @@ FaspRetCode GMRES::RSolve(const VEC& b, VEC& x)
     double gamma, t, ri, rj, cr = 1.0;
     double resAbs = 1.0, resRel = 1.0, denAbs = 1.0, ratio = 0.0, resAbsOld = 1.0;
     USI    count = 1, count_1 = 2;
+    USI    ld        = maxRestart + 1; // leading dimension of hh
+    bool   breakdown = false;
 
     PrintHead();
 
@@ -127,9 +134,9 @@ FaspRetCode GMRES::RSolve(const VEC& b, VEC& x)
     safe    = x;
 
     // Initialize residual and its norm
-    A->Apply(x, V[0]);  // A * x -> V[0]
-    V[0].XPAY(-1.0, b); // b - V[0] -> V[0]
-    resAbs = ri = V[0].Norm2();
+    A->Apply(x, wk);  // A * x -> wk
+    wk.XPAY(-1.0, b); // b - wk -> wk
+    resAbs = ri = wk.Norm2();
     denAbs      = (CLOSE_ZERO > resAbs) ? CLOSE_ZERO : resAbs;
 
     // GMRES(m) outer iteration
@@ -145,7 +152,9 @@ FaspRetCode GMRES::RSolve(const VEC& b, VEC& x)
         // Initial search direction: r / ||r||
         if (resAbs < SMALL_DBL) break; // Residual is too small
         var[0] = resAbs;
-        V[0].Scale(1 / resAbs);
+        wk.Scale(1 / resAbs);
+        V.SetCol(0, wk); // continue with the rounded copy if stored in low precision
+        if (basisPrec != BASIS_DOUBLE) V.CopyCol(0, wk);
 
         // RESTART CYCLE (right-preconditioning)
         count = 0;
@@ -161,39 +170,36 @@ FaspRetCode GMRES::RSolve(const VEC& b, VEC& x)
 
             // Apply preconditioner
             tmp.SetValues(len, 0.0);
-            pcd->Solve(V[count_1], tmp);
+            pcd->Solve(wk, tmp); // wk holds the newest basis vector
 
-            A->Apply(tmp, V[count]);
+            A->Apply(tmp, wk);
 
-            // Modified Gram-Schmidt orthogonalization
-            for (USI j = 0; j < count; ++j) {
-                hh[j][count_1] = V[count].Dot(V[j]);
-                V[count].AXPBY(1.0, -hh[j][count_1], V[j]);
-            }
-            t                  = V[count].Norm2();
-            hh[count][count_1] = t;
+            // Orthogonalize against the basis; new column of H in hj
+            DBL* hj   = hh.data() + count_1 * ld;
+            t         = V.Orthogonalize(count, orthType, wk, hj);
+            hj[count] = t;
 
-            // If t=0, we get solution subspace
-            if (fabs(t) > SMALL_DBL)
-                V[count].Scale(1.0 / t);
-            else
-                break;
+            // If t=0, we get solution subspace after the rotations below
+            breakdown = fabs(t) <= CLOSE_ZERO;
+            if (!breakdown) {
+                wk.Scale(1.0 / t);
+                V.SetCol(count, wk);
+                if (basisPrec != BASIS_DOUBLE) V.CopyCol(count, wk);
+            }
 
             for (USI j = 1; j < count; ++j) {
-                t                  = hh[j - 1][count_1];
-                hh[j - 1][count_1] = hsin[j - 1] * hh[j][count_1] + hcos[j - 1] * t;
-                hh[j][count_1]     = -hsin[j - 1] * t + hcos[j - 1] * hh[j][count_1];
+                t         = hj[j - 1];
+                hj[j - 1] = hsin[j - 1] * hj[j] + hcos[j - 1] * t;
+                hj[j]     = -hsin[j - 1] * t + hcos[j - 1] * hj[j];
             }
 
-            t = hh[count][count_1] * hh[count][count_1];
-            t += hh[count_1][count_1] * hh[count_1][count_1];
+            t = hj[count] * hj[count] + hj[count_1] * hj[count_1];
             t = sqrt(t);
 
-            gamma                = t > SMALL_DBL ? t : SMALL_DBL;
-            hcos[count_1]        = hh[count_1][count_1] / gamma;
-            hsin[count_1]        = hh[count][count_1] / gamma;
-            hh[count_1][count_1] = hsin[count_1] * hh[count][count_1] +
-                                   hcos[count_1] * hh[count_1][count_1];
+            gamma         = t > SMALL_DBL ? t : SMALL_DBL;
+            hcos[count_1] = hj[count_1] / gamma;
+            hsin[count_1] = hj[count] / gamma;
+            hj[count_1]   = hsin[count_1] * hj[count] + hcos[count_1] * hj[count_1];
 
             var[count]   = -hsin[count_1] * var[count_1];
             var[count_1] = hcos[count_1] * var[count_1];
@@ -202,7 +208,8 @@ FaspRetCode GMRES::RSolve(const VEC& b, VEC& x)
             resRel       = resAbs / denAbs;
             resAbsOld    = resAbs;
 
-            // Exit restart cycle if reaches tolerance
+            // Exit restart cycle if breaks down or reaches tolerance
+            if (breakdown) break;
             if ((resAbs < params.absTol || resRel < params.relTol) &&
                 numIter > params.minIter)
                 break;
@@ -210,18 +217,13 @@ FaspRetCode GMRES::RSolve(const VEC& b, VEC& x)
         } // end of restart cycle
 
         // Compute solution, first solve upper triangular system
-        var[count_1] = var[count_1] / hh[count_1][count_1];
-        for (USI k = count - 2; k >= 0; --k) {
-            t = 0.0;
-            for (USI j = k + 1; j < count; ++j) t -= hh[k][j] * var[j];
-            t += var[k];
-            var[k] = t / hh[k][k];
+        for (INT k = count_1; k >= 0; --k) {
+            t = var[k];
+            for (USI j = k + 1; j < count; ++j) t -= hh[k + j * ld] * var[j];
+            var[k] = t / hh[k + k * ld];
         }
 
-        wk = V[count_1];
-        wk.Scale(var[count_1]);
-
-        for (USI j = count - 2; j >= 0; --j) wk.AXPBY(1.0, var[j], V[j]);
+        V.Combine(count, var.data(), wk);
 
         // Apply preconditioner
         tmp.SetValues(len, 0.0);
@@ -242,11 +244,11 @@ FaspRetCode GMRES::RSolve(const VEC& b, VEC& x)
         //---------------------------------------------
         // Prepare for the next iteration
         //---------------------------------------------
-        A->Apply(x, V[0]);  // A * x -> V[0]
-        V[0].XPAY(-1.0, b); // b - V[0] -> V[0]
+        A->Apply(x, wk);  // A * x -> wk
+        wk.XPAY(-1.0, b); // b - wk -> wk
 
         // Check whether converged
-        resAbs = rj = V[0].Norm2();
+        resAbs = rj = wk.Norm2();
         resRel      = resAbs / denAbs;
         if ((resRel < params.relTol || resAbs < params.absTol) &&
             numIter >= params.minIter)
@@ -258,7 +260,7 @@ FaspRetCode GMRES::RSolve(const VEC& b, VEC& x)
         if (cr > max_cr)
             restart = maxRestart;
         else if (cr < max_cr && cr > min_cr) {
-            if (restart - decrease > minRestart)
+            if (restart > minRestart + decrease)
                 restart -= decrease;
             else
                 restart = maxRestart;
@@ -268,8 +270,8 @@ FaspRetCode GMRES::RSolve(const VEC& b, VEC& x)
 
     // If minIter == numIter == maxIter (preconditioner only), skip this
     if (!(numIter == params.minIter && numIter == params.maxIter)) {
-        norm2   = V[0].Norm2();
-        normInf = V[0].NormInf();
+        norm2   = wk.Norm2();
+        normInf = wk.NormInf();
         PrintFinal(numIter, resRel, resAbs, ratio);
     }
 
@@ -288,6 +290,8 @@ FaspRetCode GMRES::LSolve(const VEC& b, VEC& x)
     double gamma, t, ri, rj, cr = 1.0;
     double resAbs = 1.0, resRel = 1.0, denAbs = 1.0, ratio = 0.0, resAbsOld = 1.0;
     USI    count = 1, count_1 = 2;
+    USI    ld        = maxRestart + 1; // leading dimension of hh
+    bool   breakdown = false;
 
     PrintHead();
 
@@ -301,9 +305,9 @@ FaspRetCode GMRES::LSolve(const VEC& b, VEC& x)
     ri = tmp.Norm2();
 
     // Apply preconditioner
-    V[0].SetValues(len, 0.0);
-    pcd->Solve(tmp, V[0]);
-    resAbs = V[0].Norm2();
+    wk.SetValues(len, 0.0);
+    pcd->Solve(tmp, wk);
+    resAbs = wk.Norm2();
     denAbs = (CLOSE_ZERO > resAbs) ? CLOSE_ZERO : resAbs;
 
     // GMRES(m) outer iteration
@@ -319,7 +323,9 @@ FaspRetCode GMRES::LSolve(const VEC& b, VEC& x)
         // Initial search direction: r / ||r||
         if (resAbs < SMALL_DBL) break; // Residual is too small
         var[0] = resAbs;
-        V[0].Scale(1 / resAbs);
+        wk.Scale(1 / resAbs);
+        V.SetCol(0, wk); // continue with the rounded copy if stored in low precision
+        if (basisPrec != BASIS_DOUBLE) V.CopyCol(0, wk);
 
         // RESTART CYCLE (left-preconditioning)
         count = 0;
@@ -333,39 +339,36 @@ FaspRetCode GMRES::LSolve(const VEC& b, VEC& x)
             ++numIter;         // total iteration number
             count_1 = count++; // inner iteration number
 
-            A->Apply(V[count_1], tmp);
-            V[count].SetValues(len, 0.0);
-            pcd->Solve(tmp, V[count]); // apply preconditioner
-
-            // Modified Gram-Schmidt orthogonalization
-            for (USI j = 0; j < count; ++j) {
-                hh[j][count_1] = V[count].Dot(V[j]);
-                V[count].AXPBY(1.0, -hh[j][count_1], V[j]);
+            A->Apply(wk, tmp); // wk holds the newest basis vector
+            wk.SetValues(len, 0.0);
+            pcd->Solve(tmp, wk); // apply preconditioner
+
+            // Orthogonalize against the basis; new column of H in hj
+            DBL* hj   = hh.data() + count_1 * ld;
+            t         = V.Orthogonalize(count, orthType, wk, hj);
+            hj[count] = t;
+
+            // If t=0, we get solution subspace after the rotations below
+            breakdown = fabs(t) <= CLOSE_ZERO;
+            if (!breakdown) {
+                wk.Scale(1.0 / t);
+                V.SetCol(count, wk);
+                if (basisPrec != BASIS_DOUBLE) V.CopyCol(count, wk);
             }
-            t                  = V[count].Norm2();
-            hh[count][count_1] = t;
-
-            // if t=0, we get solution subspace
-            if (fabs(t) > SMALL_DBL)
-                V[count].Scale(1.0 / t);
-            else
-                break;
 
             for (USI j = 1; j < count; ++j) {
-                t                  = hh[j - 1][count_1];
-                hh[j - 1][count_1] = hsin[j - 1] * hh[j][count_1] + hcos[j - 1] * t;
-                hh[j][count_1]     = -hsin[j - 1] * t + hcos[j - 1] * hh[j][count_1];
+                t         = hj[j - 1];
+                hj[j - 1] = hsin[j - 1] * hj[j] + hcos[j - 1] * t;
+                hj[j]     = -hsin[j - 1] * t + hcos[j - 1] * hj[j];
             }
 
-            t = hh[count][count_1] * hh[count][count_1];
-            t += hh[count_1][count_1] * hh[count_1][count_1];
+            t = hj[count] * hj[count] + hj[count_1] * hj[count_1];
             t = sqrt(t);
 
-            gamma                = t > SMALL_DBL ? t : SMALL_DBL;
-            hcos[count_1]        = hh[count_1][count_1] / gamma;
-            hsin[count_1]        = hh[count][count_1] / gamma;
-            hh[count_1][count_1] = hsin[count_1] * hh[count][count_1] +
-                                   hcos[count_1] * hh[count_1][count_1];
+            gamma         = t > SMALL_DBL ? t : SMALL_DBL;
+            hcos[count_1] = hj[count_1] / gamma;
+            hsin[count_1] = hj[count] / gamma;
+            hj[count_1]   = hsin[count_1] * hj[count] + hcos[count_1] * hj[count_1];
 
             var[count]   = -hsin[count_1] * var[count_1];
             var[count_1] = hcos[count_1] * var[count_1];
@@ -374,7 +377,8 @@ FaspRetCode GMRES::LSolve(const VEC& b, VEC& x)
             resAbsOld    = resAbs;
             resRel       = resAbs / denAbs;
 
-            // Exit restart cycle if reaches tolerance
+            // Exit restart cycle if breaks down or reaches tolerance
+            if (breakdown) break;
             if ((resAbs < params.absTol || resRel < params.relTol) &&
                 numIter > params.minIter)
                 break;
@@ -382,18 +386,13 @@ FaspRetCode GMRES::LSolve(const VEC& b, VEC& x)
         } // End of restart cycle
 
         // Compute solution, first solve upper triangular system
-        var[count_1] = var[count_1] / hh[count_1][count_1];
-        for (USI k = count - 2; k >= 0; --k) {
-            t = 0.0;
-            for (USI j = k + 1; j < count; ++j) t -= hh[k][j] * var[j];
-            t += var[k];
-            var[k] = t / hh[k][k];
+        for (INT k = count_1; k >= 0; --k) {
+            t = var[k];
+            for (USI j = k + 1; j < count; ++j) t -= hh[k + j * ld] * var[j];
+            var[k] = t / hh[k + k * ld];
         }
 
-        wk = V[count_1];
-        wk.Scale(var[count_1]);
-
-        for (USI j = count - 2; j >= 0; --j) wk.AXPBY(1.0, var[j], V[j]);
+        V.Combine(count, var.data(), wk);
 
         // Update iterative solution
         x.AXPY(1.0, wk);
@@ -415,11 +414,11 @@ FaspRetCode GMRES::LSolve(const VEC& b, VEC& x)
         rj = tmp.Norm2();
 
         // Apply preconditioner
-        V[0].SetValues(len, 0.0);
-        pcd->Solve(tmp, V[0]);
+        wk.SetValues(len, 0.0);
+        pcd->Solve(tmp, wk);
 
         // Check whether converged
-        resAbs = V[0].Norm2();
+        resAbs = wk.Norm2();
         resRel = resAbs / denAbs;
         if ((resRel < params.relTol || resAbs < params.absTol) &&
             numIter >= params.minIter)
@@ -431,7 +430,7 @@ FaspRetCode GMRES::LSolve(const VEC& b, VEC& x)
         if (cr > max_cr)
             restart = maxRestart;
         else if (cr < max_cr && cr > min_cr) {
-            if (restart - decrease > minRestart)
+            if (restart > minRestart + decrease)
                 restart -= decrease;
             else
                 restart = maxRestart;
@@ -459,4 +458,8 @@ FaspRetCode GMRES::LSolve(const VEC& b, VEC& x)
 /*----------------------------------------------------------------------------*/
 /*  Kailei Zhang        July/11/2020     Create file                          */
 /*  Chensong Zhang      Sep/16/2021      Restructure file                     */
+/*  Chensong Zhang      Oct/19/2026      Contiguous basis, low-sync CGS2      */
+/*  Chensong Zhang      Oct/19/2026      Add reduced-precision basis option   */
+/*  Chensong Zhang      Oct/19/2026      Reset restart at the start of Solve  */
+/*  Chensong Zhang      Oct/19/2026      No unsigned underflow in restart     */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -17,6 +17,7 @@
 
 // FASPXX header files
 #include "ErrorLog.hxx"
+#include "KrylovBasis.hxx"
 #include "LOP.hxx"
 #include "SOL.hxx"
 
@@ -30,11 +31,13 @@ private:
     VEC tmp;
     VEC safe;
 
-    std::vector<std::vector<double>> hh;
-    std::vector<double>              hsin;
-    std::vector<double>              hcos;
-    std::vector<double>              var;
-    std::vector<VEC>                 V;
+    std::vector<double> hh; ///< Hessenberg matrix, column by column
+    std::vector<double> hsin;
+    std::vector<double> hcos;
+    std::vector<double> var;
+    KrylovBasis         V;         ///< orthonormal Krylov basis
+    OrthType            orthType;  ///< orthogonalization scheme
+    BasisPrec           basisPrec; ///< storage precision of the Krylov basis
 
     bool useRightPrecond;
     USI  maxRestart;
@@ -57,6 +60,8 @@ public:
         , hsin(0)
         , hcos(0)
         , var(0)
+        , orthType(ORTH_CGS2_LOW)
+        , basisPrec(BASIS_DOUBLE)
         , useRightPrecond(true)
         , maxRestart(30)
         , minRestart(10)
@@ -75,6 +80,12 @@ public:
     /// Set the maximum and minmum restart numbers for GMRES.
     void SetMaxMinRestart(const USI maxRestart, const USI minRestart);
 
+    /// Set the orthogonalization scheme of the Krylov basis.
+    void SetOrthType(OrthType type);
+
+    /// Set the storage precision of the Krylov basis, before Setup.
+    void SetBasisPrec(BasisPrec prec);
+
     /// Setup the GMRES method.
     FaspRetCode Setup(const LOP& A) override;
 
@@ -101,4 +112,6 @@ private:
 /*----------------------------------------------------------------------------*/
 /*  Kailei Zhang        July/16/2020     Create file                          */
 /*  Chensong Zhang      Sep/17/2021      Call right/left precond in Solve     */
+/*  Chensong Zhang      Oct/19/2026      Contiguous basis, low-sync CGS2      */
+/*  Chensong Zhang      Oct/19/2026      Add reduced-precision basis option   */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
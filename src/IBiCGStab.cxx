@@ -0,0 +1,276 @@
+/*! \file    IBiCGStab.cxx
+ *  \brief   Preconditioned improved BiCGStab class definition
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <cmath>
+
+// FASPXX header files
+#include "IBiCGStab.hxx"
+#include "Iter.hxx"
+
+/// d = [(t,s), (t,t), (r0*,s), (r0*,t), (s,s)] in one sweep.
+static void FusedDots(const VEC& t, const VEC& s, const VEC& r0star, DBL* d)
+{
+    const INT  n = t.GetSize();
+    const DBL *pt, *ps, *pr;
+    t.GetArray(&pt);
+    s.GetArray(&ps);
+    r0star.GetArray(&pr);
+
+    INT i;
+    DBL ts = 0.0, tt = 0.0, rs = 0.0, rt = 0.0, ss = 0.0;
+#pragma omp parallel for reduction(+ : ts, tt, rs, rt, ss)
+    for (i = 0; i < n; ++i) {
+        ts += pt[i] * ps[i];
+        tt += pt[i] * pt[i];
+        rs += pr[i] * ps[i];
+        rt += pr[i] * pt[i];
+        ss += ps[i] * ps[i];
+    } /*-- End of omp for --*/
+
+    d[0] = ts, d[1] = tt, d[2] = rs, d[3] = rt, d[4] = ss;
+}
+
+/// x += alpha ph + omega sh, r = s - omega t, p = r + beta (p - omega v) in one pass.
+static void FusedUpdate(const DBL alpha, const DBL omega, const DBL beta, const VEC& ph,
+                        const VEC& sh, const VEC& t, const VEC& v, VEC& x, VEC& r,
+                        VEC& p)
+{
+    const INT  n = x.GetSize();
+    const DBL *pph, *psh, *pt, *pv;
+    DBL *      px, *pr, *pp;
+    ph.GetArray(&pph);
+    sh.GetArray(&psh);
+    t.GetArray(&pt);
+    v.GetArray(&pv);
+    x.GetArray(&px);
+    r.GetArray(&pr);
+    p.GetArray(&pp);
+
+    INT i;
+#pragma omp parallel for
+    for (i = 0; i < n; ++i) {
+        px[i] += alpha * pph[i] + omega * psh[i];
+        pr[i] -= omega * pt[i];
+        pp[i] = pr[i] + beta * (pp[i] - omega * pv[i]);
+    } /*-- End of omp for --*/
+}
+
+/// Allocate memory, setup coefficient matrix of the linear system.
+FaspRetCode IBiCGStab::Setup(const LOP& A)
+{
+    // Set solver type
+    SetSolType(SOLType::SOLVER_IBICGSTAB);
+
+    // Allocate memory for temporary vectors
+    try {
+        len = A.GetColSize();
+        r0star.SetValues(len, 0.0);
+        rk.SetValues(len, 0.0);
+        pk.SetValues(len, 0.0);
+        vk.SetValues(len, 0.0);
+        tk.SetValues(len, 0.0);
+        ph.SetValues(len, 0.0);
+        sh.SetValues(len, 0.0);
+        safe.SetValues(len, 0.0);
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    // Setup the coefficient matrix
+    this->A = &A;
+
+    // Print used parameters
+    if (params.verbose > PRINT_MIN) PrintParam(std::cout);
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Clean up temp memory allocated for improved BiCGStab.
+void IBiCGStab::Clean()
+{
+    r0star.SetValues(len, 0.0);
+    rk.SetValues(len, 0.0);
+    pk.SetValues(len, 0.0);
+    vk.SetValues(len, 0.0);
+    tk.SetValues(len, 0.0);
+    ph.SetValues(len, 0.0);
+    sh.SetValues(len, 0.0);
+    safe.SetValues(len, 0.0);
+}
+
+/// Right-preconditioned BiCGStab with fused kernels. Don't check problem sizes.
+FaspRetCode IBiCGStab::Solve(const VEC& b, VEC& x)
+{
+    FaspRetCode errorCode = FaspRetCode::SUCCESS;
+
+    // Local variables
+    const double reliable = 1e-6; // relative accuracy asked from the recurrences
+
+    USI    moreStep = 0;
+    double resAbs = 1.0, resRel = 1.0, denAbs = 1.0, ratio = 0.0, resAbsOld = 1.0;
+    double rho, rhoNew, delta, alpha, omega, beta, rr, r0Norm;
+    double d[5]; // (t,s), (t,t), (r0*,s), (r0*,t), (s,s)
+    bool   converged = false;
+
+    PrintHead();
+
+    // Initialize iterative method
+    numIter = 0;
+    safe    = x;
+    A->Apply(x, rk);  // A * x -> rk
+    rk.XPAY(-1.0, b); // b - rk -> rk
+    resAbs = rk.Norm2();
+    denAbs = (CLOSE_ZERO > resAbs) ? CLOSE_ZERO : resAbs;
+
+    // Prepare for the main loop
+    r0star = rk;
+    pk     = rk;
+    r0Norm = resAbs;
+    rho    = resAbs * resAbs;
+
+    // Main BiCGStab loop
+    while (numIter < params.maxIter) {
+
+        // Start from minIter instead of 0
+        if (numIter == params.minIter) {
+            resRel    = resAbs / denAbs;
+            resAbsOld = resAbs;
+            if (resRel < params.relTol || resAbs < params.absTol) break;
+        }
+
+        if (numIter >= params.minIter) PrintInfo(numIter, resRel, resAbs, ratio);
+
+        ++numIter; // iteration count
+
+        // v = A M^{-1} p, alpha = rho / (r0*, v): first reduction
+        ph.SetValues(len, 0.0);
+        pcd->Solve(pk, ph);
+        A->Apply(ph, vk);
+        delta = r0star.Dot(vk);
+        if (fabs(delta) <= CLOSE_ZERO * CLOSE_ZERO) {
+            FASPXX_WARNING("Divided by zero!"); // Possible breakdown
+            errorCode = FaspRetCode::ERROR_DIVIDE_ZERO;
+            break;
+        }
+        alpha = rho / delta;
+
+        // s = r - alpha v, t = A M^{-1} s, all inner products: second reduction
+        rk.AXPY(-alpha, vk);
+        sh.SetValues(len, 0.0);
+        pcd->Solve(rk, sh);
+        A->Apply(sh, tk);
+        FusedDots(tk, rk, r0star, d);
+
+        if (d[1] <= CLOSE_ZERO * CLOSE_ZERO || fabs(d[0]) <= CLOSE_ZERO * d[1]) {
+            // s = 0 is a lucky breakdown; otherwise BiCGStab cannot proceed
+            x.AXPY(alpha, ph);
+            resAbs = sqrt(d[4]);
+            resRel = resAbs / denAbs;
+            if (resRel < params.relTol || resAbs < params.absTol) {
+                converged = true;
+                break;
+            }
+            FASPXX_WARNING("Divided by zero!"); // Possible breakdown
+            errorCode = FaspRetCode::ERROR_DIVIDE_ZERO;
+            break;
+        }
+        omega  = d[0] / d[1];
+        rhoNew = d[2] - omega * d[3];
+        rr     = d[4] - 2.0 * omega * d[0] + omega * omega * d[1];
+
+        // The recurrences are only reliable well above the rounding level of s and
+        // omega t; after a near breakdown they cancel and are recomputed directly
+        const double scale = r0Norm * (sqrt(d[4]) + fabs(omega) * sqrt(d[1]));
+        if (fabs(rhoNew) > reliable * scale) {
+            // Update x, r and p in one pass
+            beta = rhoNew / rho * alpha / omega;
+            FusedUpdate(alpha, omega, beta, ph, sh, tk, vk, x, rk, pk);
+        } else {
+            x.AXPY(alpha, ph);
+            x.AXPY(omega, sh);
+            rk.AXPY(-omega, tk);
+            rhoNew = rk.Dot(r0star);
+            beta   = rhoNew / rho * alpha / omega;
+            pk.AXPY(-omega, vk);
+            pk.XPAY(beta, rk);
+        }
+        rho = rhoNew;
+
+        resAbs = (rr > reliable * reliable * d[4]) ? sqrt(rr) : rk.Norm2();
+        resRel = resAbs / denAbs;
+        ratio  = resAbs / resAbsOld;
+
+        // Save the best solution so far
+        if (numIter >= params.savIter && resAbs < resAbsOld) safe = x;
+        resAbsOld = resAbs;
+
+        // Prevent false convergence
+        if ((resRel < params.relTol || resAbs < params.absTol) &&
+            numIter >= params.minIter) {
+            // Compute true residual r = b - Ax and update residual
+            A->Apply(x, rk);
+            rk.XPAY(-1.0, b);
+
+            double resRelOld = resRel;
+            resAbs           = rk.Norm2();
+            resRel           = resAbs / denAbs;
+            if (resRel < params.relTol || resAbs < params.absTol) {
+                converged = true;
+                break;
+            }
+
+            if (params.verbose >= PRINT_MORE) {
+                FASPXX_WARNING("False convergence!");
+                WarnCompRes(resRelOld);
+                WarnRealRes(resRel);
+            }
+
+            if (moreStep >= params.restart) {
+                // Note: restart has different meaning here
+                if (params.verbose > PRINT_MIN)
+                    FASPXX_WARNING("The tolerance might be too small!");
+                errorCode = FaspRetCode::ERROR_SOLVER_TOLSMALL;
+                break;
+            }
+
+            // Restart from the true residual
+            pk  = rk;
+            rho = rk.Dot(r0star);
+            ++moreStep;
+        }
+
+    } // End of main BiCGStab loop
+
+    if (errorCode == FaspRetCode::SUCCESS && !converged &&
+        numIter >= params.maxIter && params.maxIter > params.minIter)
+        errorCode = FaspRetCode::ERROR_SOLVER_MAXIT;
+
+    // If minIter == numIter == maxIter (preconditioner only), skip this
+    if (!(numIter == params.minIter && numIter == params.maxIter)) {
+        this->norm2   = resAbs;
+        this->normInf = rk.NormInf();
+        PrintFinal(numIter, resRel, resAbs, ratio);
+    }
+
+    // Restore the saved best iteration if needed
+    if (numIter > params.savIter) x = safe;
+
+    return errorCode;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
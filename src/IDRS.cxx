@@ -0,0 +1,284 @@
+/*! \file    IDRS.cxx
+ *  \brief   Preconditioned IDR(s) class definition
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <cmath>
+#include <random>
+
+// FASPXX header files
+#include "IDRS.hxx"
+#include "Iter.hxx"
+
+/// Set the number of shadow vectors s.
+void IDRS::SetShadowDim(const USI s) { this->shadowDim = s > 0 ? s : 1; }
+
+/// Allocate memory, setup coefficient matrix of the linear system.
+FaspRetCode IDRS::Setup(const LOP& A)
+{
+    // Set solver type
+    SetSolType(SOLType::SOLVER_IDRS);
+
+    const USI s = shadowDim;
+
+    // Allocate memory for temporary vectors
+    try {
+        len = A.GetColSize();
+        rk.SetValues(len, 0.0);
+        zk.SetValues(len, 0.0);
+        uk.SetValues(len, 0.0);
+        gk.SetValues(len, 0.0);
+        safe.SetValues(len, 0.0);
+
+        mm.assign(s * s, 0.0);
+        f.assign(s, 0.0);
+        c.assign(s, 0.0);
+        h.assign(s, 0.0);
+        alpha.assign(s, 0.0);
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    FaspRetCode retCode = P.Allocate(len, s);
+    if (retCode == FaspRetCode::SUCCESS) retCode = G.Allocate(len, s);
+    if (retCode == FaspRetCode::SUCCESS) retCode = U.Allocate(len, s);
+    if (retCode != FaspRetCode::SUCCESS) return retCode;
+
+    // Shadow vectors: orthonormalized random vectors, fixed seed for repeatability
+    std::mt19937                     gen(5489u);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    for (USI j = 0; j < s; ++j) {
+        for (USI i = 0; i < len; ++i) uk[i] = normal(gen);
+        const DBL t = P.Orthogonalize(j, ORTH_CGS2, uk, h.data());
+        uk.Scale(1.0 / t);
+        P.SetCol(j, uk);
+    }
+
+    // Setup the coefficient matrix
+    this->A = &A;
+
+    // Print used parameters
+    if (params.verbose > PRINT_MIN) PrintParam(std::cout);
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Clean up temp memory allocated for IDR(s).
+void IDRS::Clean()
+{
+    rk.SetValues(len, 0.0);
+    zk.SetValues(len, 0.0);
+    uk.SetValues(len, 0.0);
+    gk.SetValues(len, 0.0);
+    safe.SetValues(len, 0.0);
+}
+
+/// Right-preconditioned IDR(s) with biorthogonalization. Don't check problem sizes.
+FaspRetCode IDRS::Solve(const VEC& b, VEC& x)
+{
+    FaspRetCode errorCode = FaspRetCode::SUCCESS;
+
+    // Local variables
+    const USI    s     = shadowDim;
+    const double kappa = 0.7; // keep |cos(t, r)| of the MR step above kappa
+
+    USI    moreStep = 0;
+    double resAbs = 1.0, resRel = 1.0, denAbs = 1.0, ratio = 0.0, resAbsOld = 1.0;
+    double omega = 1.0, beta, t, nr, nt, tr;
+    bool   converged = false;
+
+    PrintHead();
+
+    // Initialize iterative method
+    numIter = 0;
+    safe    = x;
+    A->Apply(x, rk);  // A * x -> rk
+    rk.XPAY(-1.0, b); // b - rk -> rk
+    resAbs = rk.Norm2();
+    denAbs = (CLOSE_ZERO > resAbs) ? CLOSE_ZERO : resAbs;
+
+    // G = U = 0 and P^T G = I
+    G.Zero();
+    U.Zero();
+    std::fill(mm.begin(), mm.end(), 0.0);
+    for (USI i = 0; i < s; ++i) mm[i + i * s] = 1.0;
+
+    // Main IDR(s) loop
+    while (numIter < params.maxIter) {
+
+        // Start from minIter instead of 0
+        if (numIter == params.minIter) {
+            resRel    = resAbs / denAbs;
+            resAbsOld = resAbs;
+            if (resRel < params.relTol || resAbs < params.absTol) break;
+        }
+
+        // f = P^T r
+        P.MultiDot(s, rk, f.data());
+
+        // s steps in the current IDR subspace
+        for (USI k = 0; k < s && numIter < params.maxIter; ++k) {
+
+            if (numIter >= params.minIter) PrintInfo(numIter, resRel, resAbs, ratio);
+
+            // Solve the lower triangular system mm(k:s,k:s) c = f(k:s)
+            for (USI i = 0; i < k; ++i) c[i] = 0.0;
+            for (USI i = k; i < s; ++i) {
+                t = f[i];
+                for (USI j = k; j < i; ++j) t -= mm[i + j * s] * c[j];
+                c[i] = t / mm[i + i * s];
+            }
+
+            // u = U c + omega M^{-1} (r - G c) and g = A u
+            gk = rk;
+            G.MultiAXPY(s, c.data(), gk);
+            zk.SetValues(len, 0.0);
+            pcd->Solve(gk, zk);
+            U.Combine(s, c.data(), uk);
+            uk.AXPY(omega, zk);
+            A->Apply(uk, gk);
+            ++numIter;
+
+            // Make g orthogonal to P(:,0:k), one sweep of inner products per pass
+            for (USI pass = 0; pass < 2; ++pass) {
+                P.MultiDot(s, gk, h.data());
+                for (USI i = 0; i < k; ++i) {
+                    t = h[i];
+                    for (USI j = 0; j < i; ++j) t -= mm[i + j * s] * alpha[j];
+                    alpha[i] = t / mm[i + i * s];
+                }
+                G.MultiAXPY(k, alpha.data(), gk);
+                U.MultiAXPY(k, alpha.data(), uk);
+                if (k == 0) break; // nothing to orthogonalize against
+            }
+            for (USI i = k; i < s; ++i) {
+                t = h[i];
+                for (USI j = 0; j < k; ++j) t -= mm[i + j * s] * alpha[j];
+                mm[i + k * s] = t;
+            }
+            for (USI i = 0; i < k; ++i) mm[i + k * s] = 0.0;
+            G.SetCol(k, gk);
+            U.SetCol(k, uk);
+
+            if (fabs(mm[k + k * s]) <= CLOSE_ZERO) {
+                FASPXX_WARNING("Divided by zero!"); // Possible breakdown
+                errorCode = FaspRetCode::ERROR_DIVIDE_ZERO;
+                break;
+            }
+
+            // Make r orthogonal to P(:,0:k+1)
+            beta = f[k] / mm[k + k * s];
+            rk.AXPY(-beta, gk);
+            x.AXPY(beta, uk);
+            for (USI i = k + 1; i < s; ++i) f[i] -= beta * mm[i + k * s];
+
+            resAbs = rk.Norm2();
+            resRel = resAbs / denAbs;
+            ratio  = resAbs / resAbsOld;
+
+            // Save the best solution so far
+            if (numIter >= params.savIter && resAbs < resAbsOld) safe = x;
+            resAbsOld = resAbs;
+            converged = (resRel < params.relTol || resAbs < params.absTol) &&
+                        numIter >= params.minIter;
+            if (converged) break;
+        }
+        if (errorCode < 0 || numIter >= params.maxIter) break;
+
+        // Enter the next subspace with a minimal residual step
+        if (!converged) {
+            if (numIter >= params.minIter) PrintInfo(numIter, resRel, resAbs, ratio);
+
+            zk.SetValues(len, 0.0);
+            pcd->Solve(rk, zk);
+            A->Apply(zk, gk);
+            ++numIter;
+
+            nr    = rk.Norm2();
+            nt    = gk.Norm2();
+            tr    = gk.Dot(rk);
+            omega = tr / (nt * nt);
+            t     = fabs(tr) / (nt * nr);
+            if (t > 0.0 && t < kappa) omega *= kappa / t;
+            if (fabs(omega) <= CLOSE_ZERO) {
+                FASPXX_WARNING("Divided by zero!"); // Possible breakdown
+                errorCode = FaspRetCode::ERROR_DIVIDE_ZERO;
+                break;
+            }
+
+            rk.AXPY(-omega, gk);
+            x.AXPY(omega, zk);
+
+            resAbs = rk.Norm2();
+            resRel = resAbs / denAbs;
+            ratio  = resAbs / resAbsOld;
+
+            // Save the best solution so far
+            if (numIter >= params.savIter && resAbs < resAbsOld) safe = x;
+            resAbsOld = resAbs;
+            converged = (resRel < params.relTol || resAbs < params.absTol) &&
+                        numIter >= params.minIter;
+        }
+
+        // Prevent false convergence
+        if (converged) {
+            // Compute true residual r = b - Ax and update residual
+            A->Apply(x, rk);
+            rk.XPAY(-1.0, b);
+
+            double resRelOld = resRel;
+            resAbs           = rk.Norm2();
+            resRel           = resAbs / denAbs;
+            if (resRel < params.relTol || resAbs < params.absTol) break;
+
+            if (params.verbose >= PRINT_MORE) {
+                FASPXX_WARNING("False convergence!");
+                WarnCompRes(resRelOld);
+                WarnRealRes(resRel);
+            }
+
+            if (moreStep >= params.restart) {
+                // Note: restart has different meaning here
+                if (params.verbose > PRINT_MIN)
+                    FASPXX_WARNING("The tolerance might be too small!");
+                errorCode = FaspRetCode::ERROR_SOLVER_TOLSMALL;
+                break;
+            }
+            converged = false;
+            ++moreStep;
+        }
+
+    } // End of main IDR(s) loop
+
+    if (errorCode == FaspRetCode::SUCCESS && !converged &&
+        numIter >= params.maxIter && params.maxIter > params.minIter)
+        errorCode = FaspRetCode::ERROR_SOLVER_MAXIT;
+
+    // If minIter == numIter == maxIter (preconditioner only), skip this
+    if (!(numIter == params.minIter && numIter == params.maxIter)) {
+        this->norm2   = resAbs;
+        this->normInf = rk.NormInf();
+        PrintFinal(numIter, resRel, resAbs, ratio);
+    }
+
+    // Restore the saved best iteration if needed
+    if (numIter > params.savIter) x = safe;
+
+    return errorCode;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Zero bases in place on each solve    */
+/*----------------------------------------------------------------------------*/
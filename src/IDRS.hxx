@@ -0,0 +1,100 @@
+/*! \file    IDRS.hxx
+ *  \brief   Preconditioned IDR(s) class declaration
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+/*! Important Note:
+ *-----------------------------------------------------------------------------------
+ *  IDR(s) with biorthogonalization (van Gijzen and Sonneveld 2011) forces the
+ *  residuals into a sequence of shrinking subspaces defined by s shadow vectors P.
+ *  Each cycle takes s steps that make the new residual orthogonal to one more
+ *  column of P, and one minimal residual step that enters the next subspace. It
+ *  needs at most n + n/s matrix-vector products in exact arithmetic and about 3s
+ *  vectors of storage, however slow the convergence. IDR(1) is equivalent to
+ *  BiCGStab. Each new vector is biorthogonalized in two passes, each with all inner
+ *  products against P in one sweep; a single pass loses stability for strongly
+ *  nonnormal A.
+ *
+ *  Preconditioning is from the right, so the residual is that of the original
+ *  system. The iteration number counts matrix-vector products.
+ */
+
+#ifndef __IDRS_HEADER__ /*-- allow multiple inclusions --*/
+#define __IDRS_HEADER__ /**< indicate IDRS.hxx has been included before */
+
+// Standard header files
+#include <vector>
+
+// FASPXX header files
+#include "ErrorLog.hxx"
+#include "KrylovBasis.hxx"
+#include "LOP.hxx"
+#include "SOL.hxx"
+
+/*! \class IDRS
+ *  \brief Right-preconditioned induced dimension reduction method IDR(s).
+ */
+class IDRS : public SOL
+{
+private:
+    USI len;       ///< dimension of the solution vector
+    USI shadowDim; ///< number s of shadow vectors
+
+    KrylovBasis P; ///< orthonormal shadow vectors
+    KrylovBasis G; ///< A * U, the residual differences
+    KrylovBasis U; ///< solution differences
+
+    VEC rk;   ///< Work vector for residual
+    VEC zk;   ///< Work vector for preconditioned vector
+    VEC uk;   ///< Work vector for new column of U
+    VEC gk;   ///< Work vector for new column of G
+    VEC safe; ///< Work vector for safe-guard
+
+    std::vector<DBL> mm;    ///< P^T G, lower triangular, column by column
+    std::vector<DBL> f;     ///< P^T r
+    std::vector<DBL> c;     ///< coefficients of G and U for the next vector
+    std::vector<DBL> h;     ///< P^T g of the new vector
+    std::vector<DBL> alpha; ///< biorthogonalization coefficients
+
+public:
+    /// Default constructor.
+    IDRS()
+        : len(0)
+        , shadowDim(4)
+        , rk(0)
+        , zk(0)
+        , uk(0)
+        , gk(0)
+        , safe(0){};
+
+    /// Default destructor.
+    ~IDRS() = default;
+
+    /// Set the number of shadow vectors s.
+    void SetShadowDim(USI s);
+
+    /// Setup the IDR(s) method.
+    FaspRetCode Setup(const LOP& A) override;
+
+    /// Solve Ax=b using the IDR(s) method.
+    FaspRetCode Solve(const VEC& b, VEC& x) override;
+
+    /// Clean up IDR(s) data allocated during Setup.
+    void Clean() override;
+};
+
+#endif /* end if for __IDRS_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
@@ -52,6 +52,14 @@ FaspRetCode Jacobi::Setup(const MAT& A)
     return FaspRetCode::SUCCESS;
 }
 
+/// Setup Jacobi preconditioner with a linear operator, which has to be a MAT.
+FaspRetCode Jacobi::Setup(const LOP& A)
+{
+    const MAT* mat = dynamic_cast<const MAT*>(&A);
+    if (mat == nullptr) return FaspRetCode::ERROR_INPUT_PAR;
+    return Setup(*mat);
+}
+
 /// Solve Ax=b using the Jacobi method. Don't check problem sizes.
 FaspRetCode Jacobi::Solve(const VEC& b, VEC& x)
 {
@@ -118,4 +126,5 @@ FaspRetCode Jacobi::Solve(const VEC& b, VEC& x)
 /*----------------------------------------------------------------------------*/
 /*  Kailei Zhang        Dec/02/2019      Create file                          */
 /*  Chensong Zhang      Sep/16/2021      Restructure file                     */
+/*  Chensong Zhang      Oct/19/2026      Setup Jacobi with a linear operator  */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -63,6 +63,9 @@ public:
     /// Setup the Jacobi method.
     FaspRetCode Setup(const MAT& A);
 
+    /// Setup the Jacobi method with a linear operator, which has to be a MAT.
+    FaspRetCode Setup(const LOP& A) override;
+
     /// Clean up Jacobi data allocated during Setup.
     void Clean() override{};
 
@@ -79,4 +82,5 @@ public:
 /*----------------------------------------------------------------------------*/
 /*  Kailei Zhang        Dec/02/2019      Create file                          */
 /*  Chensong Zhang      Sep/16/2021      Restructure file                     */
+/*  Chensong Zhang      Oct/19/2026      Setup Jacobi with a linear operator  */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -12,31 +12,55 @@
 // FASPXX header files
 #include "Krylov.hxx"
 
-/// All supported Krylov methods can be accessed using this interface
-FaspRetCode Krylov(LOP& A, VEC& b, VEC& x, SOL& pcd, SOLParams& params)
+/// Create a Krylov method of the given type; nullptr if it is not a Krylov method.
+std::unique_ptr<SOL> CreateKrylov(SOLType type)
 {
-    SOL solver;
-    solver.SetSolTypeFromName(params); // get solver type
-    auto sol = &solver;
-
-    switch (params.type) {
+    switch (type) {
         case SOLType::SOLVER_CG:
-            sol = new class CG();
-            break;
+            return std::make_unique<CG>();
         case SOLType::SOLVER_BICGSTAB:
-            sol = new class BiCGStab();
-            break;
+            return std::make_unique<BiCGStab>();
+        case SOLType::SOLVER_MINRES:
+            return std::make_unique<MINRES>();
         case SOLType::SOLVER_GMRES:
-            sol = new class GMRES();
-            break;
+            return std::make_unique<GMRES>();
         case SOLType::SOLVER_FGMRES:
-            sol = new class FGMRES();
-            break;
+            return std::make_unique<FGMRES>();
+        case SOLType::SOLVER_VFGMRES:
+            return std::make_unique<VFGMRES>();
+        case SOLType::SOLVER_GMRESDR:
+            return std::make_unique<GMRESDR>();
+        case SOLType::SOLVER_GCRODR:
+            return std::make_unique<GCRODR>();
+        case SOLType::SOLVER_DCG:
+            return std::make_unique<DCG>();
+        case SOLType::SOLVER_IDRS:
+            return std::make_unique<IDRS>();
+        case SOLType::SOLVER_BICGSTABL:
+            return std::make_unique<BiCGStabL>();
+        case SOLType::SOLVER_IBICGSTAB:
+            return std::make_unique<IBiCGStab>();
         default:
+            return nullptr;
+    }
+}
+
+/// Create the method named in params, bind A and pcd, allocate work vectors. A
+/// and pcd have to live as long as the solver is used.
+FaspRetCode KrylovSolver::Setup(const LOP& A, SOL& pcd, SOLParams& params)
+{
+    SOL::SetSolTypeFromName(params); // get solver type
+
+    try {
+        sol = CreateKrylov(params.type);
+        if (sol == nullptr) {
             // Set default solver, should never reach here!!!
             if (params.verbose > PRINT_NONE)
                 FASPXX_WARNING("Unknown Krylov method! Use CG instead!");
-            sol = new class CG();
+            sol = CreateKrylov(SOLType::SOLVER_CG);
+        }
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
     }
 
     sol->SetOutput(params.verbose);
@@ -46,12 +70,50 @@ FaspRetCode Krylov(LOP& A, VEC& b, VEC& x, SOL& pcd, SOLParams& params)
     sol->SetRestart(params.restart);
     sol->SetRelTol(params.relTol);
     sol->SetAbsTol(params.absTol);
-    sol->Setup(A);
+    FaspRetCode retCode = sol->Setup(A);
+    if (retCode < 0) return retCode;
     sol->SetupPCD(pcd);
 
+    return FaspRetCode::SUCCESS;
+}
+
+/// Solve Ax=b with the work vectors of Setup; no allocation in here.
+FaspRetCode KrylovSolver::Solve(const VEC& b, VEC& x)
+{
+    if (sol == nullptr) return FaspRetCode::ERROR_SOLVER_TYPE; // not set up
     return sol->Solve(b, x);
 }
 
+/// Get number of iterations of the last solve.
+USI KrylovSolver::GetIterations() const
+{
+    return (sol == nullptr) ? 0 : sol->GetIterations();
+}
+
+/// Get Euclidean norm of the residual of the last solve.
+double KrylovSolver::GetNorm2() const
+{
+    return (sol == nullptr) ? LARGE_DBL : sol->GetNorm2();
+}
+
+/// Release the method and its work vectors.
+void KrylovSolver::Clean()
+{
+    sol.reset();
+}
+
+/// All supported Krylov methods can be accessed using this interface. For
+/// repeated solves with the same operator, use KrylovSolver instead.
+FaspRetCode Krylov(LOP& A, VEC& b, VEC& x, SOL& pcd, SOLParams& params)
+{
+    KrylovSolver solver;
+
+    FaspRetCode retCode = solver.Setup(A, pcd, params);
+    if (retCode < 0) return retCode;
+
+    return solver.Solve(b, x);
+}
+
 /*----------------------------------------------------------------------------*/
 /*  Brief Change History of This File                                         */
 /*----------------------------------------------------------------------------*/
@@ -59,4 +121,13 @@ FaspRetCode Krylov(LOP& A, VEC& b, VEC& x, SOL& pcd, SOLParams& params)
 /*----------------------------------------------------------------------------*/
 /*  Kailei Zhang        Dec/27/2019      Create file                          */
 /*  Chensong Zhang      Sep/16/2021      Restructure file                     */
+/*  Chensong Zhang      Oct/19/2026      Add reusable KrylovSolver            */
+/*  Chensong Zhang      Oct/19/2026      Add variable-restart VFGMRES         */
+/*  Chensong Zhang      Oct/19/2026      Add MINRES                           */
+/*  Chensong Zhang      Oct/19/2026      Add GMRES-DR and GCRO-DR             */
+/*  Chensong Zhang      Oct/19/2026      Add deflated CG                      */
+/*  Chensong Zhang      Oct/19/2026      Add IDR(s) and BiCGStab(l)           */
+/*  Chensong Zhang      Oct/19/2026      Add improved BiCGStab                */
+/*  Chensong Zhang      Oct/19/2026      Add MPIR                             */
+/*  Chensong Zhang      Oct/19/2026      Keep MPIR out of the Krylov factory  */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -12,16 +12,60 @@
 #ifndef __KRYLOV_HEADER__ /*-- allow multiple inclusions --*/
 #define __KRYLOV_HEADER__ /**< indicate Krylov.hxx has been included before */
 
+// Standard header files
+#include <memory>
+
 // FASPXX header files
 #include "BiCGStab.hxx"
+#include "BiCGStabL.hxx"
 #include "CG.hxx"
+#include "DCG.hxx"
 #include "FGMRES.hxx"
+#include "GCRODR.hxx"
 #include "GMRES.hxx"
+#include "IBiCGStab.hxx"
+#include "IDRS.hxx"
 #include "Iter.hxx"
+#include "MINRES.hxx"
 #include "RetCode.hxx"
 #include "SOL.hxx"
+#include "VFGMRES.hxx"
+
+/// Create a Krylov method of the given type; nullptr if it is not a Krylov method.
+std::unique_ptr<SOL> CreateKrylov(SOLType type);
+
+/*! \class KrylovSolver
+ *  \brief Krylov method bound to one operator and one preconditioner for many solves.
+ */
+class KrylovSolver
+{
+private:
+    std::unique_ptr<SOL> sol; ///< Krylov method of the chosen type
+
+public:
+    /// Default constructor.
+    KrylovSolver() = default;
+
+    /// Default destructor.
+    ~KrylovSolver() = default;
+
+    /// Create the method named in params, bind A and pcd, allocate work vectors.
+    FaspRetCode Setup(const LOP& A, SOL& pcd, SOLParams& params);
+
+    /// Solve Ax=b with the work vectors of Setup; no allocation in here.
+    FaspRetCode Solve(const VEC& b, VEC& x);
+
+    /// Get number of iterations of the last solve.
+    USI GetIterations() const;
+
+    /// Get Euclidean norm of the residual of the last solve.
+    double GetNorm2() const;
+
+    /// Release the method and its work vectors.
+    void Clean();
+};
 
-/// General interface to Krylov subspace methods.
+/// General interface to Krylov subspace methods for a single solve.
 FaspRetCode Krylov(LOP& A, VEC& b, VEC& x, SOL& pcd, SOLParams& params);
 
 #endif // __KRYLOV_HEADER__
@@ -33,4 +77,13 @@ FaspRetCode Krylov(LOP& A, VEC& b, VEC& x, SOL& pcd, SOLParams& params);
 /*----------------------------------------------------------------------------*/
 /*  Kailei Zhang        Dec/27/2019      Create file                          */
 /*  Chensong Zhang      Sep/17/2021      Add GMRES methods                    */
+/*  Chensong Zhang      Oct/19/2026      Add reusable KrylovSolver            */
+/*  Chensong Zhang      Oct/19/2026      Add variable-restart VFGMRES         */
+/*  Chensong Zhang      Oct/19/2026      Add MINRES                           */
+/*  Chensong Zhang      Oct/19/2026      Add GMRES-DR and GCRO-DR             */
+/*  Chensong Zhang      Oct/19/2026      Add deflated CG                      */
+/*  Chensong Zhang      Oct/19/2026      Add IDR(s) and BiCGStab(l)           */
+/*  Chensong Zhang      Oct/19/2026      Add improved BiCGStab                */
+/*  Chensong Zhang      Oct/19/2026      Add MPIR                             */
+/*  Chensong Zhang      Oct/19/2026      Keep MPIR out of the Krylov factory  */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
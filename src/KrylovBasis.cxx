@@ -0,0 +1,353 @@
+/*! \file    KrylovBasis.cxx
+ *  \brief   Contiguous Krylov basis with block orthogonalization kernels
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// FASPXX header files
+#include "ErrorLog.hxx"
+#include "KrylovBasis.hxx"
+
+/// Number of rows swept at a time; k columns of a block stay in cache.
+static const USI blockSize = 512;
+
+/// Read a stored entry in double precision.
+static inline DBL Load(const DBL v) { return v; }
+
+/// Read a stored entry in double precision.
+static inline DBL Load(const float v) { return v; }
+
+/// Read a stored entry in double precision; bf16 is the upper half of a float.
+static inline DBL Load(const uint16_t v)
+{
+    const uint32_t u = static_cast<uint32_t>(v) << 16;
+    float          f;
+    std::memcpy(&f, &u, 4);
+    return f;
+}
+
+/// Round x to the storage precision.
+static inline void Store(const DBL x, DBL& v) { v = x; }
+
+/// Round x to the storage precision.
+static inline void Store(const DBL x, float& v) { v = static_cast<float>(x); }
+
+/// Round x to the storage precision; round to nearest even from float.
+static inline void Store(const DBL x, uint16_t& v)
+{
+    const float f = static_cast<float>(x);
+    uint32_t    u;
+    std::memcpy(&u, &f, 4);
+    u += 0x7FFF + ((u >> 16) & 1);
+    v = static_cast<uint16_t>(u >> 16);
+}
+
+/// h = V_k^T x, and return x^T x if withNorm, for columns stored in V.
+template <typename T>
+static DBL DotKernel(const T* V, const USI len, const USI k, const DBL* x, DBL* h,
+                     const bool withNorm)
+{
+    const INT numBlocks = (len + blockSize - 1) / blockSize;
+
+    INT b;
+    DBL norm = 0.0;
+    if (k == 0) { // no zero-length array section in the reduction below
+        if (!withNorm) return norm;
+#pragma omp parallel for reduction(+ : norm)
+        for (b = 0; b < INT(len); ++b) norm += x[b] * x[b];
+        return norm;
+    }
+
+    std::fill(h, h + k, 0.0);
+#pragma omp parallel for reduction(+ : h[:k], norm)
+    for (b = 0; b < numBlocks; ++b) {
+        const USI begin = b * blockSize, end = std::min(begin + blockSize, len);
+        if (withNorm)
+            for (USI i = begin; i < end; ++i) norm += x[i] * x[i];
+        for (USI j = 0; j < k; ++j) {
+            const T* v   = V + static_cast<size_t>(j) * len;
+            DBL      dot = 0.0;
+            for (USI i = begin; i < end; ++i) dot += Load(v[i]) * x[i];
+            h[j] += dot;
+        }
+    } /*-- End of omp for --*/
+
+    return norm;
+}
+
+/// x += a V_k y for columns stored in V.
+template <typename T>
+static void UpdateKernel(const T* V, const USI len, const USI k, const DBL a,
+                         const DBL* y, DBL* x)
+{
+    const INT numBlocks = (len + blockSize - 1) / blockSize;
+
+    INT b;
+#pragma omp parallel for
+    for (b = 0; b < numBlocks; ++b) {
+        const USI begin = b * blockSize, end = std::min(begin + blockSize, len);
+        for (USI j = 0; j < k; ++j) {
+            const T*  v  = V + static_cast<size_t>(j) * len;
+            const DBL ay = a * y[j];
+            for (USI i = begin; i < end; ++i) x[i] += ay * Load(v[i]);
+        }
+    } /*-- End of omp for --*/
+}
+
+/// Modified Gram-Schmidt of x against columns stored in V, one column at a time.
+template <typename T>
+static void MGSKernel(const T* V, const USI len, const USI k, DBL* x, DBL* h)
+{
+    for (USI j = 0; j < k; ++j) {
+        const T* v   = V + static_cast<size_t>(j) * len;
+        DBL      dot = 0.0;
+        INT      i;
+#pragma omp parallel for reduction(+ : dot)
+        for (i = 0; i < INT(len); ++i) dot += Load(v[i]) * x[i];
+        h[j] = dot;
+#pragma omp parallel for
+        for (i = 0; i < INT(len); ++i) x[i] -= dot * Load(v[i]);
+    }
+}
+
+/// Allocate numVecs columns of length len, stored in the given precision.
+FaspRetCode KrylovBasis::Allocate(const USI len, const USI numVecs,
+                                  const BasisPrec prec)
+{
+    const size_t size = static_cast<size_t>(len) * numVecs;
+    try {
+        std::vector<DBL>().swap(data);
+        std::vector<float>().swap(fdata);
+        std::vector<uint16_t>().swap(hdata);
+        switch (prec) {
+            case BASIS_FLOAT:
+                fdata.assign(size, 0.0f);
+                break;
+            case BASIS_BF16:
+                hdata.assign(size, 0);
+                break;
+            default:
+                data.assign(size, 0.0);
+        }
+        proj.assign(numVecs, 0.0);
+    } catch (std::bad_alloc& ex) {
+        Clean();
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+    this->len     = len;
+    this->numVecs = numVecs;
+    this->prec    = prec;
+    return FaspRetCode::SUCCESS;
+}
+
+/// Get max number of basis vectors.
+USI KrylovBasis::GetNumVecs() const { return numVecs; }
+
+/// Get storage precision of the basis.
+BasisPrec KrylovBasis::GetPrec() const { return prec; }
+
+/// Set all the entries to zero, without changing the size.
+void KrylovBasis::Zero()
+{
+    std::fill(data.begin(), data.end(), 0.0);
+    std::fill(fdata.begin(), fdata.end(), 0.0f);
+    std::fill(hdata.begin(), hdata.end(), 0);
+}
+
+/// Get pointer to column j; only for double storage.
+DBL* KrylovBasis::GetCol(const USI j)
+{
+    if (prec != BASIS_DOUBLE) FASPXX_ABORT("Basis is not stored in double!");
+    return data.data() + static_cast<size_t>(j) * len;
+}
+
+/// Get pointer to column j, entries cannot be modified; only for double storage.
+const DBL* KrylovBasis::GetCol(const USI j) const
+{
+    if (prec != BASIS_DOUBLE) FASPXX_ABORT("Basis is not stored in double!");
+    return data.data() + static_cast<size_t>(j) * len;
+}
+
+/// Copy v to column j, rounded to the storage precision.
+void KrylovBasis::SetCol(const USI j, const VEC& v)
+{
+    const DBL* x;
+    v.GetArray(&x);
+    const size_t offset = static_cast<size_t>(j) * len;
+    switch (prec) {
+        case BASIS_FLOAT:
+            for (USI i = 0; i < len; ++i) Store(x[i], fdata[offset + i]);
+            break;
+        case BASIS_BF16:
+            for (USI i = 0; i < len; ++i) Store(x[i], hdata[offset + i]);
+            break;
+        default:
+            std::copy(x, x + len, data.data() + offset);
+    }
+}
+
+/// Copy column j to v.
+void KrylovBasis::CopyCol(const USI j, VEC& v) const
+{
+    const size_t offset = static_cast<size_t>(j) * len;
+    if (prec == BASIS_DOUBLE) {
+        v.SetValues(len, data.data() + offset);
+        return;
+    }
+
+    v.SetValues(len, 0.0);
+    DBL* x;
+    v.GetArray(&x);
+    if (prec == BASIS_FLOAT)
+        for (USI i = 0; i < len; ++i) x[i] = Load(fdata[offset + i]);
+    else
+        for (USI i = 0; i < len; ++i) x[i] = Load(hdata[offset + i]);
+}
+
+/// h = V_k^T w for the first k columns V_k.
+void KrylovBasis::MultiDot(const USI k, const VEC& w, DBL* h) const
+{
+    MultiDotNorm(k, w, h, false);
+}
+
+/// h = V_k^T w and return w^T w, in one sweep.
+DBL KrylovBasis::MultiDotNorm(const USI k, const VEC& w, DBL* h) const
+{
+    return MultiDotNorm(k, w, h, true);
+}
+
+/// h = V_k^T w and, if withNorm, return w^T w, in one sweep.
+DBL KrylovBasis::MultiDotNorm(const USI k, const VEC& w, DBL* h,
+                              const bool withNorm) const
+{
+    const DBL* x;
+    w.GetArray(&x);
+    switch (prec) {
+        case BASIS_FLOAT:
+            return DotKernel(fdata.data(), len, k, x, h, withNorm);
+        case BASIS_BF16:
+            return DotKernel(hdata.data(), len, k, x, h, withNorm);
+        default:
+            return DotKernel(data.data(), len, k, x, h, withNorm);
+    }
+}
+
+/// w -= V_k h for the first k columns V_k.
+void KrylovBasis::MultiAXPY(const USI k, const DBL* h, VEC& w) const
+{
+    Update(k, -1.0, h, w);
+}
+
+/// w = V_k y for the first k columns V_k.
+void KrylovBasis::Combine(const USI k, const DBL* y, VEC& w) const
+{
+    w.SetValues(len, 0.0);
+    Update(k, 1.0, y, w);
+}
+
+/// w += V_k y for the first k columns V_k.
+void KrylovBasis::AddCombine(const USI k, const DBL* y, VEC& w) const
+{
+    Update(k, 1.0, y, w);
+}
+
+/// w += a V_k y for the first k columns V_k.
+void KrylovBasis::Update(const USI k, const DBL a, const DBL* y, VEC& w) const
+{
+    DBL* x;
+    w.GetArray(&x);
+    switch (prec) {
+        case BASIS_FLOAT:
+            UpdateKernel(fdata.data(), len, k, a, y, x);
+            break;
+        case BASIS_BF16:
+            UpdateKernel(hdata.data(), len, k, a, y, x);
+            break;
+        default:
+            UpdateKernel(data.data(), len, k, a, y, x);
+    }
+}
+
+/// Exchange the contents with another basis of the same kind.
+void KrylovBasis::Swap(KrylovBasis& other)
+{
+    std::swap(len, other.len);
+    std::swap(numVecs, other.numVecs);
+    std::swap(prec, other.prec);
+    data.swap(other.data);
+    fdata.swap(other.fdata);
+    hdata.swap(other.hdata);
+    proj.swap(other.proj);
+}
+
+/// Orthogonalize w against V_k, save V_k^T w in h and return the norm of w.
+DBL KrylovBasis::Orthogonalize(const USI k, const OrthType type, VEC& w, DBL* h)
+{
+    switch (type) {
+        case ORTH_MGS: {
+            DBL* x;
+            w.GetArray(&x);
+            if (prec == BASIS_FLOAT)
+                MGSKernel(fdata.data(), len, k, x, h);
+            else if (prec == BASIS_BF16)
+                MGSKernel(hdata.data(), len, k, x, h);
+            else
+                MGSKernel(data.data(), len, k, x, h);
+            return w.Norm2();
+        }
+        case ORTH_CGS2: {
+            MultiDot(k, w, h);
+            MultiAXPY(k, h, w);
+            MultiDot(k, w, proj.data());
+            MultiAXPY(k, proj.data(), w);
+            for (USI j = 0; j < k; ++j) h[j] += proj[j];
+            return w.Norm2();
+        }
+        default: { // ORTH_CGS2_LOW
+            MultiDot(k, w, h);
+            MultiAXPY(k, h, w);
+            const DBL norm = MultiDotNorm(k, w, proj.data());
+            MultiAXPY(k, proj.data(), w);
+            DBL projNorm = 0.0;
+            for (USI j = 0; j < k; ++j) {
+                h[j] += proj[j];
+                projNorm += proj[j] * proj[j];
+            }
+            // Pythagoras is safe unless w is (almost) in the span of V_k
+            if (norm - projNorm > 0.5 * norm) return std::sqrt(norm - projNorm);
+            return w.Norm2();
+        }
+    }
+}
+
+/// Release the basis.
+void KrylovBasis::Clean()
+{
+    std::vector<DBL>().swap(data);
+    std::vector<float>().swap(fdata);
+    std::vector<uint16_t>().swap(hdata);
+    std::vector<DBL>().swap(proj);
+    len     = 0;
+    numVecs = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Add AddCombine and Swap              */
+/*  Chensong Zhang      Oct/19/2026      Add float and bf16 storage           */
+/*  Chensong Zhang      Oct/19/2026      Add Zero                             */
+/*----------------------------------------------------------------------------*/
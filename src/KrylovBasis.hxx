@@ -0,0 +1,148 @@
+/*! \file    KrylovBasis.hxx
+ *  \brief   Contiguous Krylov basis with block orthogonalization kernels
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+/*! Important Note:
+ *-----------------------------------------------------------------------------------
+ *  The basis vectors are the columns of one column-major len x numVecs array, so
+ *  that the projections onto the first k columns, V_k^T w, and the update
+ *  w -= V_k h sweep the rows in cache-sized blocks and read V_k and w only once,
+ *  instead of doing k separate Dot and AXPY calls. The orthogonalization schemes are
+ *
+ *      ORTH_MGS      : modified Gram-Schmidt, one reduction per basis vector;
+ *      ORTH_CGS2     : classical Gram-Schmidt twice, three reductions in total;
+ *      ORTH_CGS2_LOW : CGS2 with the norm fused into the second projection and the
+ *                      final norm from ||w||^2 - ||h||^2, two reductions in total.
+ *
+ *  The reorthogonalization of CGS2 keeps the basis orthogonal to working accuracy,
+ *  like MGS, so both CGS2 variants can replace MGS in GMRES without loss.
+ *
+ *  The basis can be stored in float or bf16 to cut its memory and the traffic of
+ *  the kernels by a half or three quarters. Entries are rounded once by SetCol and
+ *  every dot product and update is carried out in double, so the basis is only
+ *  orthogonal up to the storage precision; GetCol is for double storage only.
+ */
+
+#ifndef __KRYLOVBASIS_HEADER__ /*-- allow multiple inclusions --*/
+#define __KRYLOVBASIS_HEADER__ /**< indicate KrylovBasis.hxx has been included before */
+
+// Standard header files
+#include <cstdint>
+#include <vector>
+
+// FASPXX header files
+#include "RetCode.hxx"
+#include "VEC.hxx"
+
+/// Orthogonalization schemes for Krylov bases.
+enum OrthType {
+    ORTH_MGS      = 0, ///< Modified Gram-Schmidt
+    ORTH_CGS2     = 1, ///< Classical Gram-Schmidt with reorthogonalization
+    ORTH_CGS2_LOW = 2  ///< CGS2 with fused norms, two reductions
+};
+
+/// Storage precisions for Krylov bases.
+enum BasisPrec {
+    BASIS_DOUBLE = 0, ///< IEEE double, 8 bytes per entry
+    BASIS_FLOAT  = 1, ///< IEEE single, 4 bytes per entry
+    BASIS_BF16   = 2  ///< bfloat16, upper half of a float, 2 bytes per entry
+};
+
+/*! \class KrylovBasis
+ *  \brief Krylov basis stored column by column in one contiguous array.
+ */
+class KrylovBasis
+{
+private:
+    USI                   len;     ///< length of each basis vector
+    USI                   numVecs; ///< max number of basis vectors
+    BasisPrec             prec;    ///< storage precision of the basis
+    std::vector<DBL>      data;    ///< column-major basis, column j at data[j * len]
+    std::vector<float>    fdata;   ///< the same in single precision
+    std::vector<uint16_t> hdata;   ///< the same in bf16
+    std::vector<DBL>      proj;    ///< coefficients of the reorthogonalization
+
+    /// h = V_k^T w and, if withNorm, return w^T w, in one sweep.
+    DBL MultiDotNorm(USI k, const VEC& w, DBL* h, bool withNorm) const;
+
+    /// w += a V_k y for the first k columns V_k.
+    void Update(USI k, DBL a, const DBL* y, VEC& w) const;
+
+public:
+    /// Default constructor.
+    KrylovBasis()
+        : len(0)
+        , numVecs(0)
+        , prec(BASIS_DOUBLE){};
+
+    /// Default destructor.
+    ~KrylovBasis() = default;
+
+    /// Allocate numVecs columns of length len, stored in the given precision.
+    FaspRetCode Allocate(USI len, USI numVecs, BasisPrec prec = BASIS_DOUBLE);
+
+    /// Get max number of basis vectors.
+    USI GetNumVecs() const;
+
+    /// Get storage precision of the basis.
+    BasisPrec GetPrec() const;
+
+    /// Set all the entries to zero, without changing the size.
+    void Zero();
+
+    /// Get pointer to column j; only for double storage.
+    DBL* GetCol(USI j);
+
+    /// Get pointer to column j, entries cannot be modified; only for double storage.
+    const DBL* GetCol(USI j) const;
+
+    /// Copy v to column j, rounded to the storage precision.
+    void SetCol(USI j, const VEC& v);
+
+    /// Copy column j to v.
+    void CopyCol(USI j, VEC& v) const;
+
+    /// h = V_k^T w for the first k columns V_k.
+    void MultiDot(USI k, const VEC& w, DBL* h) const;
+
+    /// h = V_k^T w and return w^T w, in one sweep.
+    DBL MultiDotNorm(USI k, const VEC& w, DBL* h) const;
+
+    /// w -= V_k h for the first k columns V_k.
+    void MultiAXPY(USI k, const DBL* h, VEC& w) const;
+
+    /// w = V_k y for the first k columns V_k.
+    void Combine(USI k, const DBL* y, VEC& w) const;
+
+    /// w += V_k y for the first k columns V_k.
+    void AddCombine(USI k, const DBL* y, VEC& w) const;
+
+    /// Exchange the contents with another basis of the same kind.
+    void Swap(KrylovBasis& other);
+
+    /// Orthogonalize w against V_k, save V_k^T w in h and return the norm of w.
+    DBL Orthogonalize(USI k, OrthType type, VEC& w, DBL* h);
+
+    /// Release the basis.
+    void Clean();
+};
+
+#endif /* end if for __KRYLOVBASIS_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Add AddCombine and Swap              */
+/*  Chensong Zhang      Oct/19/2026      Add float and bf16 storage           */
+/*  Chensong Zhang      Oct/19/2026      Add Zero                             */
+/*----------------------------------------------------------------------------*/
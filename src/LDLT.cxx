@@ -0,0 +1,778 @@
+/*! \file    LDLT.cxx
+ *  \brief   Supernodal sparse LDL^T direct solver class definition
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// FASPXX header files
+#include "LDLT.hxx"
+
+/// Maximal number of iterative refinement steps after static pivoting.
+static const USI MAX_REFINE_NUM = 3;
+
+/// Largest element growth max|L D| / max|A| accepted without pivoting.
+static const DBL MAX_GROWTH = 1.0 / std::sqrt(std::numeric_limits<DBL>::epsilon());
+
+/// Supernodes of at most this many columns are merged regardless of explicit zeros.
+static const USI RELAX_SMALL = 4;
+
+/// Fraction of explicit zeros allowed when merging larger supernodes.
+static const DBL RELAX_FRAC = 0.05;
+
+/// Subgraphs with at most this many nodes are not dissected any further.
+static const USI ND_LEAF_SIZE = 32;
+
+/// Nested dissection ordering of a symmetric graph: perm[new] = old. Separators are
+/// the middle level of a level structure from a pseudo-peripheral node and get the
+/// last numbers; the two remaining parts are ordered recursively, and small parts
+/// in reverse breadth-first order.
+static void OrderND(USI n, const std::vector<USI>& adjPtr,
+                    const std::vector<USI>& adjInd, std::vector<USI>& perm)
+{
+    std::vector<INT> owner(n, 0);  // subgraph that each unnumbered node belongs to
+    std::vector<INT> level(n, -1); // level in the current level structure
+    std::vector<USI> queue, last, tmp, partA, partB, sep;
+    std::vector<std::vector<USI>> stack;
+    INT                           numParts = 1;
+
+    auto degree = [&](USI i) { return adjPtr[i + 1] - adjPtr[i]; };
+
+    // Breadth-first search from root inside subgraph id; fills queue and level[],
+    // and returns the last level and its nodes
+    auto bfs = [&](USI root, INT id, std::vector<USI>& lastLevel) {
+        for (USI i : queue) level[i] = -1; // reset the previous search
+        queue.assign(1, root);
+        level[root] = 0;
+        for (USI head = 0; head < queue.size(); ++head) {
+            const USI i = queue[head];
+            for (USI k = adjPtr[i]; k < adjPtr[i + 1]; ++k) {
+                const USI j = adjInd[k];
+                if (owner[j] == id && level[j] < 0) {
+                    level[j] = level[i] + 1;
+                    queue.push_back(j);
+                }
+            }
+        }
+        const INT depth = level[queue.back()];
+        lastLevel.clear();
+        for (USI i : queue)
+            if (level[i] == depth) lastLevel.push_back(i);
+        return depth;
+    };
+
+    perm.resize(n);
+    USI next = n; // numbers are given from the back
+    stack.emplace_back(n);
+    for (USI i = 0; i < n; ++i) stack[0][i] = i;
+
+    while (!stack.empty()) {
+        std::vector<USI> nodes;
+        nodes.swap(stack.back());
+        stack.pop_back();
+        const INT id = owner[nodes[0]];
+
+        // Pseudo-peripheral node of the component containing the first node
+        USI root = nodes[0], from = root;
+        INT depth = bfs(root, id, last);
+        for (USI it = 0; it < 5; ++it) {
+            USI cand = last[0];
+            for (USI i : last)
+                if (degree(i) < degree(cand)) cand = i;
+            from               = cand;
+            const INT newDepth = bfs(cand, id, tmp);
+            if (newDepth <= depth) break;
+            root  = cand;
+            depth = newDepth;
+            last.swap(tmp);
+        }
+        if (from != root) bfs(root, id, last); // level structure from the root
+
+        // Other components are handled as a separate subgraph
+        if (queue.size() < nodes.size()) {
+            partB.clear();
+            for (USI i : nodes)
+                if (level[i] < 0) partB.push_back(i);
+            for (USI i : partB) owner[i] = numParts;
+            numParts++;
+            stack.push_back(partB);
+        }
+
+        // Small or compact component: reverse breadth-first order
+        if (queue.size() <= ND_LEAF_SIZE || depth < 2) {
+            for (USI i : queue) perm[--next] = i;
+            continue;
+        }
+
+        // Separator: nodes on the middle level with a neighbor on the next level
+        const INT mid = depth / 2;
+        partA.clear();
+        partB.clear();
+        sep.clear();
+        for (USI i : queue) {
+            if (level[i] < mid) {
+                partA.push_back(i);
+            } else if (level[i] > mid) {
+                partB.push_back(i);
+            } else {
+                bool cut = false;
+                for (USI k = adjPtr[i]; k < adjPtr[i + 1] && !cut; ++k) {
+                    const USI j = adjInd[k];
+                    cut         = (owner[j] == id && level[j] == mid + 1);
+                }
+                (cut ? sep : partA).push_back(i);
+            }
+        }
+        for (USI i : sep) {
+            owner[i]     = -1;
+            perm[--next] = i;
+        }
+        for (USI i : partA) owner[i] = numParts;
+        for (USI i : partB) owner[i] = numParts + 1;
+        numParts += 2;
+        stack.push_back(partA);
+        stack.push_back(partB); // numbered next, right before the separator
+    }
+}
+
+/// Strict lower triangular pattern, row by row, of the permuted matrix.
+static void BuildLower(USI n, const USI* rp, const USI* ci,
+                       const std::vector<USI>& pinv, std::vector<USI>& lowPtr,
+                       std::vector<USI>& lowInd)
+{
+    lowPtr.assign(n + 1, 0);
+    for (USI r = 0; r < n; ++r)
+        for (USI k = rp[r]; k < rp[r + 1]; ++k) {
+            const USI c = ci[k];
+            if (c >= r) continue;
+            lowPtr[std::max(pinv[r], pinv[c]) + 1]++;
+        }
+    for (USI i = 0; i < n; ++i) lowPtr[i + 1] += lowPtr[i];
+
+    lowInd.resize(lowPtr[n]);
+    std::vector<USI> pos(lowPtr.begin(), lowPtr.end() - 1);
+    for (USI r = 0; r < n; ++r)
+        for (USI k = rp[r]; k < rp[r + 1]; ++k) {
+            const USI c = ci[k];
+            if (c >= r) continue;
+            const USI i = std::max(pinv[r], pinv[c]), j = std::min(pinv[r], pinv[c]);
+            lowInd[pos[i]++] = j;
+        }
+}
+
+/// Elimination tree from the strict lower pattern, with path compression.
+static void ETree(USI n, const std::vector<USI>& lowPtr,
+                  const std::vector<USI>& lowInd, std::vector<INT>& parent)
+{
+    std::vector<INT> ancestor(n, -1);
+    parent.assign(n, -1);
+    for (USI k = 0; k < n; ++k) {
+        for (USI p = lowPtr[k]; p < lowPtr[k + 1]; ++p) {
+            INT i = lowInd[p];
+            while (i != -1 && i < (INT)k) {
+                const INT next = ancestor[i];
+                ancestor[i]    = k;
+                if (next == -1) parent[i] = k;
+                i = next;
+            }
+        }
+    }
+}
+
+/// Postorder of a forest given by parent pointers: post[new] = old.
+static void Postorder(USI n, const std::vector<INT>& parent, std::vector<USI>& post)
+{
+    // Children lists in increasing order
+    std::vector<INT> head(n, -1), next(n, -1), stack;
+    for (INT j = (INT)n - 1; j >= 0; --j) { // To compare with 0. Need signed INT!
+        if (parent[j] == -1) continue;
+        next[j]         = head[parent[j]];
+        head[parent[j]] = j;
+    }
+
+    post.clear();
+    post.reserve(n);
+    for (USI root = 0; root < n; ++root) {
+        if (parent[root] != -1) continue;
+        stack.push_back(root);
+        while (!stack.empty()) {
+            const INT p     = stack.back();
+            const INT child = head[p];
+            if (child == -1) {
+                stack.pop_back();
+                post.push_back(p);
+            } else {
+                head[p] = next[child];
+                stack.push_back(child);
+            }
+        }
+    }
+}
+
+/// Assume the matrix is SPD or not.
+void LDLT::SetSPD(bool flag) { spd = flag; }
+
+/// Set maximal number of columns in one supernode.
+void LDLT::SetMaxSuperSize(USI size) { maxSuperSize = (size > 0) ? size : 1; }
+
+/// Get number of perturbed pivots in the last factorization.
+USI LDLT::GetNumPerturbed() const { return numPerturbed; }
+
+/// Get number of nonzeros of the factor L.
+size_t LDLT::GetFactorNNZ() const
+{
+    size_t nnzL = 0;
+    for (USI s = 0; s < numSuper; ++s) {
+        const size_t nc = superPtr[s + 1] - superPtr[s];
+        const size_t nr = rowPtrS[s + 1] - rowPtrS[s];
+        nnzL += nr * nc - nc * (nc - 1) / 2;
+    }
+    return nnzL;
+}
+
+/// Get number of supernodes.
+USI LDLT::GetNumSuper() const { return numSuper; }
+
+/// Get number of levels of the supernodal elimination tree.
+USI LDLT::GetNumLevels() const { return levelPtr.empty() ? 0 : levelPtr.size() - 1; }
+
+/// Get number of leaves of the supernodal elimination tree.
+USI LDLT::GetNumLeaves() const { return levelPtr.size() < 2 ? 0 : levelPtr[1]; }
+
+/// Setup with a linear operator; only MAT is supported.
+FaspRetCode LDLT::Setup(const LOP& A)
+{
+    const MAT* mat = dynamic_cast<const MAT*>(&A);
+    if (mat == nullptr) return FaspRetCode::ERROR_INPUT_PAR;
+    return Setup(*mat);
+}
+
+/// Symbolic analysis followed by numeric factorization.
+FaspRetCode LDLT::Setup(const MAT& A)
+{
+    FaspRetCode retCode = FaspRetCode::SUCCESS;
+
+    // Set solver type
+    SetSolType(SOLType::SOLVER_LDLT);
+
+    if (A.GetRowSize() != A.GetColSize()) return FaspRetCode::ERROR_MAT_SIZE;
+
+    try {
+        retCode = Analyze(A);
+        if (retCode < 0) return retCode;
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    // Setup the coefficient matrix
+    this->A = &A;
+
+    // Print used parameters
+    if (params.verbose > PRINT_MIN) PrintParam(std::cout);
+
+    retCode = Factorize(A);
+
+    if (params.verbose > PRINT_NONE) {
+        std::cout << "LDLT: n = " << n << ", supernodes = " << numSuper
+                  << ", levels = " << GetNumLevels() << ", nnz(L) = " << GetFactorNNZ()
+                  << ", perturbed pivots = " << numPerturbed << ", growth = " << growth
+                  << std::endl;
+    }
+
+    return retCode;
+}
+
+/// Ordering, elimination tree, column counts, supernodes and update lists.
+FaspRetCode LDLT::Analyze(const MAT& A)
+{
+    n                   = A.GetRowSize();
+    const USI* const rp = A.rowPtr.data();
+    const USI* const ci = A.colInd.data();
+
+    // Adjacency graph of the symmetric pattern (lower part of A mirrored)
+    std::vector<USI> adjPtr(n + 1, 0), adjInd;
+    for (USI r = 0; r < n; ++r)
+        for (USI k = rp[r]; k < rp[r + 1]; ++k) {
+            const USI c = ci[k];
+            if (c >= r) continue;
+            adjPtr[r + 1]++;
+            adjPtr[c + 1]++;
+        }
+    for (USI i = 0; i < n; ++i) adjPtr[i + 1] += adjPtr[i];
+    adjInd.resize(adjPtr[n]);
+    {
+        std::vector<USI> pos(adjPtr.begin(), adjPtr.end() - 1);
+        for (USI r = 0; r < n; ++r)
+            for (USI k = rp[r]; k < rp[r + 1]; ++k) {
+                const USI c = ci[k];
+                if (c >= r) continue;
+                adjInd[pos[r]++] = c;
+                adjInd[pos[c]++] = r;
+            }
+    }
+
+    // Fill-reducing ordering
+    OrderND(n, adjPtr, adjInd, perm);
+    std::vector<USI>().swap(adjInd);
+    pinv.resize(n);
+    for (USI i = 0; i < n; ++i) pinv[perm[i]] = i;
+
+    // Elimination tree; relabel in postorder so that supernodes are contiguous
+    std::vector<USI> lowPtr, lowInd, post;
+    std::vector<INT> parent;
+    BuildLower(n, rp, ci, pinv, lowPtr, lowInd);
+    ETree(n, lowPtr, lowInd, parent);
+    Postorder(n, parent, post);
+    {
+        std::vector<USI> tmp(n);
+        for (USI i = 0; i < n; ++i) tmp[i] = perm[post[i]];
+        perm.swap(tmp);
+        for (USI i = 0; i < n; ++i) pinv[perm[i]] = i;
+    }
+    BuildLower(n, rp, ci, pinv, lowPtr, lowInd);
+    ETree(n, lowPtr, lowInd, parent);
+
+    // Column counts of L from row subtrees
+    std::vector<USI> colCount(n, 1);
+    std::vector<INT> mark(n, -1);
+    for (USI k = 0; k < n; ++k) {
+        mark[k] = k;
+        for (USI p = lowPtr[k]; p < lowPtr[k + 1]; ++p) {
+            for (INT j = lowInd[p]; mark[j] != (INT)k; j = parent[j]) {
+                colCount[j]++;
+                mark[j] = k;
+            }
+        }
+    }
+
+    // Relaxed supernodes: j joins the supernode of its child j-1 if the explicit
+    // zeros stored in the dense block stay few; the rows of a supernode are its
+    // columns and the rows of its last column below them
+    superPtr.assign(1, 0);
+    snode.resize(n);
+    size_t nnzSuper = 0; // true nonzeros in the current supernode
+    for (USI j = 0; j < n; ++j) {
+        if (j > 0) {
+            const size_t nc    = j + 1 - superPtr.back();
+            const size_t nr    = nc - 1 + colCount[j];
+            const size_t total = nr * nc - nc * (nc - 1) / 2;
+            const size_t zeros = total - nnzSuper - colCount[j];
+            const bool   merge = parent[j - 1] == (INT)j && nc <= maxSuperSize &&
+                               (nc <= RELAX_SMALL || zeros <= RELAX_FRAC * total);
+            if (!merge) {
+                superPtr.push_back(j);
+                nnzSuper = 0;
+            }
+        }
+        nnzSuper += colCount[j];
+        snode[j] = superPtr.size() - 1;
+    }
+    superPtr.push_back(n);
+    numSuper = superPtr.size() - 1;
+
+    // Row structures of supernodes: diagonal block first, then rows below
+    rowPtrS.assign(numSuper + 1, 0);
+    valPtr.assign(numSuper + 1, 0);
+    for (USI s = 0; s < numSuper; ++s) {
+        const USI nc   = superPtr[s + 1] - superPtr[s];
+        const USI nr   = nc - 1 + colCount[superPtr[s + 1] - 1];
+        rowPtrS[s + 1] = rowPtrS[s] + nr;
+        valPtr[s + 1]  = valPtr[s] + (size_t)nr * nc;
+    }
+    rowIndS.resize(rowPtrS[numSuper]);
+    std::vector<USI> pos(numSuper);
+    std::vector<INT> lastRow(numSuper, -1);
+    for (USI s = 0; s < numSuper; ++s) {
+        pos[s] = rowPtrS[s];
+        for (USI j = superPtr[s]; j < superPtr[s + 1]; ++j) rowIndS[pos[s]++] = j;
+    }
+    std::fill(mark.begin(), mark.end(), -1);
+    for (USI k = 0; k < n; ++k) {
+        mark[k] = k;
+        for (USI p = lowPtr[k]; p < lowPtr[k + 1]; ++p) {
+            for (INT j = lowInd[p]; mark[j] != (INT)k; j = parent[j]) {
+                const USI s = snode[j];
+                if (k >= superPtr[s + 1] && lastRow[s] != (INT)k) {
+                    rowIndS[pos[s]++] = k;
+                    lastRow[s]        = k;
+                }
+                mark[j] = k;
+            }
+        }
+    }
+    for (USI s = 0; s < numSuper; ++s)
+        if (pos[s] != rowPtrS[s + 1])
+            return FaspRetCode::ERROR_DSOLVER_SETUP; // inconsistent structure
+
+    // Static update lists: descendant d updates every supernode its rows hit
+    updPtr.assign(numSuper + 1, 0);
+    updSrc.clear();
+    updBeg.clear();
+    updEnd.clear();
+    for (USI pass = 0; pass < 2; ++pass) {
+        if (pass == 1) {
+            for (USI s = 0; s < numSuper; ++s) updPtr[s + 1] += updPtr[s];
+            updSrc.resize(updPtr[numSuper]);
+            updBeg.resize(updPtr[numSuper]);
+            updEnd.resize(updPtr[numSuper]);
+            for (USI s = 0; s < numSuper; ++s) pos[s] = updPtr[s];
+        }
+        for (USI d = 0; d < numSuper; ++d) {
+            const USI* rows = rowIndS.data() + rowPtrS[d];
+            const USI  nr   = rowPtrS[d + 1] - rowPtrS[d];
+            USI        i    = superPtr[d + 1] - superPtr[d];
+            while (i < nr) {
+                const USI s  = snode[rows[i]];
+                const USI p1 = i;
+                while (i < nr && snode[rows[i]] == s) ++i;
+                if (pass == 0) {
+                    updPtr[s + 1]++;
+                } else {
+                    updSrc[pos[s]]   = d;
+                    updBeg[pos[s]]   = p1;
+                    updEnd[pos[s]++] = i;
+                }
+            }
+        }
+    }
+
+    // Levels of the supernodal elimination tree; leaves are on level 0
+    std::vector<USI> level(numSuper, 0);
+    USI              numLevel = 0;
+    for (USI s = 0; s < numSuper; ++s) {
+        const INT p = parent[superPtr[s + 1] - 1];
+        if (p != -1) level[snode[p]] = std::max(level[snode[p]], level[s] + 1);
+        numLevel = std::max(numLevel, level[s] + 1);
+    }
+    levelPtr.assign(numLevel + 1, 0);
+    for (USI s = 0; s < numSuper; ++s) levelPtr[level[s] + 1]++;
+    for (USI l = 0; l < numLevel; ++l) levelPtr[l + 1] += levelPtr[l];
+    levelNode.resize(numSuper);
+    {
+        std::vector<USI> next(levelPtr.begin(), levelPtr.end() - 1);
+        for (USI s = 0; s < numSuper; ++s) levelNode[next[level[s]]++] = s;
+    }
+
+    // Map entries of A (lower part) to columns of the permuted matrix
+    asmPtr.assign(n + 1, 0);
+    for (USI r = 0; r < n; ++r)
+        for (USI k = rp[r]; k < rp[r + 1]; ++k)
+            if (ci[k] <= r) asmPtr[std::min(pinv[r], pinv[ci[k]]) + 1]++;
+    for (USI j = 0; j < n; ++j) asmPtr[j + 1] += asmPtr[j];
+    asmRow.resize(asmPtr[n]);
+    asmSrc.resize(asmPtr[n]);
+    {
+        std::vector<USI> next(asmPtr.begin(), asmPtr.end() - 1);
+        for (USI r = 0; r < n; ++r)
+            for (USI k = rp[r]; k < rp[r + 1]; ++k) {
+                const USI c = ci[k];
+                if (c > r) continue;
+                const USI j = std::min(pinv[r], pinv[c]);
+                asmRow[next[j]]   = std::max(pinv[r], pinv[c]);
+                asmSrc[next[j]++] = k;
+            }
+    }
+
+    Lx.resize(valPtr[numSuper]);
+    D.resize(n);
+    bk.resize(n);
+    xk.resize(n);
+    rk.resize(n);
+    ek.resize(n);
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Numeric factorization, level by level on the supernodal elimination tree.
+FaspRetCode LDLT::Factorize(const MAT& A)
+{
+    FaspRetCode retCode = FaspRetCode::SUCCESS;
+
+    const DBL* const val = A.values.data();
+    const USI        nnz = A.GetNNZ();
+
+    // Threshold for static pivoting
+    DBL normA = 0.0;
+    for (USI k = 0; k < nnz; ++k) normA = std::max(normA, std::fabs(val[k]));
+    const DBL pivTol = std::numeric_limits<DBL>::epsilon() * normA;
+
+    std::fill(Lx.begin(), Lx.end(), 0.0);
+    numPerturbed = 0;
+
+    // Size of the largest dense update block
+    size_t maxWork = 1;
+    for (USI u = 0; u < updSrc.size(); ++u) {
+        const USI d = updSrc[u];
+        maxWork     = std::max(maxWork, (size_t)(rowPtrS[d + 1] - rowPtrS[d] - updBeg[u]) *
+                                        (updEnd[u] - updBeg[u]));
+    }
+
+#ifdef _OPENMP
+    const int numThreads = omp_get_max_threads();
+#else
+    const int numThreads = 1;
+#endif
+    std::vector<std::vector<USI>> maps;
+    std::vector<std::vector<DBL>> works;
+    std::vector<DBL>              growths;
+    try {
+        maps.assign(numThreads, std::vector<USI>(n, 0));
+        works.assign(numThreads, std::vector<DBL>(maxWork, 0.0));
+        growths.assign(numThreads, 0.0);
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    for (USI l = 0; l + 1 < levelPtr.size(); ++l) {
+        const INT begin = levelPtr[l], end = levelPtr[l + 1];
+        INT       k;
+#pragma omp parallel for private(k) schedule(dynamic)
+        for (k = begin; k < end; ++k) {
+#ifdef _OPENMP
+            const int tid = omp_get_thread_num();
+#else
+            const int tid = 0;
+#endif
+            const FaspRetCode code = FactorSuper(levelNode[k], val, pivTol, maps[tid],
+                                                 works[tid], growths[tid]);
+            if (code != FaspRetCode::SUCCESS) {
+#pragma omp critical
+                retCode = code;
+            }
+        }
+        if (retCode != FaspRetCode::SUCCESS) break;
+    }
+
+    // Without pivoting, large growth means the factors are useless; the static
+    // pivots cannot be repaired by refinement then
+    growth = *std::max_element(growths.begin(), growths.end());
+    if (normA > 0.0) growth /= normA;
+    if (!spd && retCode == FaspRetCode::SUCCESS && growth > MAX_GROWTH)
+        retCode = FaspRetCode::ERROR_DSOLVER_SETUP;
+
+    return retCode;
+}
+
+/// Assemble, apply descendant updates, and factorize one supernode.
+FaspRetCode LDLT::FactorSuper(USI s, const DBL* val, DBL pivTol,
+                              std::vector<USI>& map, std::vector<DBL>& work,
+                              DBL& maxEntry)
+{
+    const USI  f    = superPtr[s];
+    const USI  nc   = superPtr[s + 1] - f;
+    const USI  nr   = rowPtrS[s + 1] - rowPtrS[s];
+    const USI* rows = rowIndS.data() + rowPtrS[s];
+    DBL*       Ls   = Lx.data() + valPtr[s];
+
+    // Relative positions of rows in this supernode
+    for (USI i = 0; i < nr; ++i) map[rows[i]] = i;
+
+    // Assemble entries of A
+    for (USI j = 0; j < nc; ++j) {
+        DBL* col = Ls + (size_t)j * nr;
+        for (USI k = asmPtr[f + j]; k < asmPtr[f + j + 1]; ++k)
+            col[map[asmRow[k]]] += val[asmSrc[k]];
+    }
+
+    // Left-looking updates from descendants: Ls -= L_d * D_d * L_d(p1:p2,:)^T
+    for (USI u = updPtr[s]; u < updPtr[s + 1]; ++u) {
+        const USI  d    = updSrc[u];
+        const USI  p1   = updBeg[u];
+        const USI  ncu  = updEnd[u] - p1;
+        const USI  fd   = superPtr[d];
+        const USI  ncd  = superPtr[d + 1] - fd;
+        const USI  nrd  = rowPtrS[d + 1] - rowPtrS[d];
+        const USI  m    = nrd - p1;
+        const USI* rowd = rowIndS.data() + rowPtrS[d] + p1;
+        const DBL* Ld   = Lx.data() + valPtr[d] + p1;
+        DBL*       W    = work.data();
+
+        // Dense product of the lower trapezoid W = L1 * D * L2^T
+        for (USI c = 0; c < ncu; ++c) {
+            DBL* wc = W + (size_t)c * m;
+            for (USI r = c; r < m; ++r) wc[r] = 0.0;
+            for (USI t = 0; t < ncd; ++t) {
+                const DBL* lt   = Ld + (size_t)t * nrd;
+                const DBL  coef = D[fd + t] * lt[c];
+                if (coef == 0.0) continue;
+                for (USI r = c; r < m; ++r) wc[r] += lt[r] * coef;
+            }
+        }
+
+        // Scatter into the current supernode
+        for (USI c = 0; c < ncu; ++c) {
+            const DBL* wc  = W + (size_t)c * m;
+            DBL*       col = Ls + (size_t)(rowd[c] - f) * nr;
+            for (USI r = c; r < m; ++r) col[map[rowd[r]]] -= wc[r];
+        }
+    }
+
+    // Dense LDL^T of the supernode panel
+    for (USI t = 0; t < nc; ++t) {
+        DBL* lt = Ls + (size_t)t * nr;
+        DBL  d  = lt[t];
+        for (USI r = t; r < nr; ++r) maxEntry = std::max(maxEntry, std::fabs(lt[r]));
+        if (spd) {
+            if (d <= 0.0) return FaspRetCode::ERROR_DSOLVER_SETUP; // not SPD
+        } else if (std::fabs(d) < pivTol) {
+            d = (d >= 0.0) ? pivTol : -pivTol; // static pivoting
+#pragma omp atomic
+            numPerturbed++;
+        }
+        D[f + t]        = d;
+        lt[t]           = 1.0;
+        const DBL dInv  = 1.0 / d;
+        for (USI r = t + 1; r < nr; ++r) lt[r] *= dInv;
+        for (USI c = t + 1; c < nc; ++c) {
+            DBL*      lc   = Ls + (size_t)c * nr;
+            const DBL coef = d * lt[c];
+            for (USI r = c; r < nr; ++r) lc[r] -= lt[r] * coef;
+        }
+    }
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Forward, diagonal and backward solves with the supernodal factors.
+void LDLT::SolveLDLT(const std::vector<DBL>& b, std::vector<DBL>& y) const
+{
+    y = b;
+
+    // Forward solve L z = y
+    for (USI s = 0; s < numSuper; ++s) {
+        const USI  f    = superPtr[s];
+        const USI  nc   = superPtr[s + 1] - f;
+        const USI  nr   = rowPtrS[s + 1] - rowPtrS[s];
+        const USI* rows = rowIndS.data() + rowPtrS[s];
+        const DBL* Ls   = Lx.data() + valPtr[s];
+        for (USI t = 0; t < nc; ++t) {
+            const DBL* lt = Ls + (size_t)t * nr;
+            const DBL  yt = y[f + t];
+            if (yt == 0.0) continue;
+            for (USI r = t + 1; r < nr; ++r) y[rows[r]] -= lt[r] * yt;
+        }
+    }
+
+    // Diagonal solve
+    for (USI i = 0; i < n; ++i) y[i] /= D[i];
+
+    // Backward solve L^T x = z
+    for (INT s = (INT)numSuper - 1; s >= 0; --s) { // To compare with 0. Need signed INT!
+        const USI  f    = superPtr[s];
+        const USI  nc   = superPtr[s + 1] - f;
+        const USI  nr   = rowPtrS[s + 1] - rowPtrS[s];
+        const USI* rows = rowIndS.data() + rowPtrS[s];
+        const DBL* Ls   = Lx.data() + valPtr[s];
+        for (INT t = (INT)nc - 1; t >= 0; --t) {
+            const DBL* lt  = Ls + (size_t)t * nr;
+            DBL        sum = y[f + t];
+            for (USI r = t + 1; r < nr; ++r) sum -= lt[r] * y[rows[r]];
+            y[f + t] = sum;
+        }
+    }
+}
+
+/// Residual r = b - Ax with the stored lower part, all in the permuted ordering.
+void LDLT::ResidualLDLT(const std::vector<DBL>& b, const std::vector<DBL>& x,
+                        std::vector<DBL>& r) const
+{
+    const DBL* const val = static_cast<const MAT*>(A)->values.data();
+
+    r = b;
+    for (USI j = 0; j < n; ++j) {
+        const DBL xj  = x[j];
+        DBL       sum = 0.0;
+        for (USI k = asmPtr[j]; k < asmPtr[j + 1]; ++k) {
+            const USI i = asmRow[k];
+            const DBL aij = val[asmSrc[k]];
+            r[i] -= aij * xj;
+            if (i != j) sum += aij * x[i];
+        }
+        r[j] -= sum;
+    }
+}
+
+/// Solve Ax=b; refine the solution if some pivots have been perturbed, and return
+/// ERROR_SOLVER_MAXIT if the refinement stops above the tolerance.
+FaspRetCode LDLT::Solve(const VEC& b, VEC& x)
+{
+    FaspRetCode errorCode = FaspRetCode::SUCCESS;
+
+    for (USI i = 0; i < n; ++i) bk[i] = b[perm[i]];
+    SolveLDLT(bk, xk);
+    numIter = 1;
+    norm2   = 0.0;
+    normInf = 0.0;
+
+    if (numPerturbed > 0) {
+        DBL normb = 0.0;
+        for (USI i = 0; i < n; ++i) normb += bk[i] * bk[i];
+        normb = std::sqrt(normb);
+
+        for (USI k = 0; k <= MAX_REFINE_NUM; ++k) {
+            ResidualLDLT(bk, xk, rk);
+            norm2   = 0.0;
+            normInf = 0.0;
+            for (USI i = 0; i < n; ++i) {
+                norm2 += rk[i] * rk[i];
+                normInf = std::max(normInf, std::fabs(rk[i]));
+            }
+            norm2 = std::sqrt(norm2);
+            if (norm2 <= params.relTol * normb || norm2 <= params.absTol) break;
+            if (k == MAX_REFINE_NUM) {
+                errorCode = FaspRetCode::ERROR_SOLVER_MAXIT;
+                break;
+            }
+            SolveLDLT(rk, ek);
+            for (USI i = 0; i < n; ++i) xk[i] += ek[i];
+            ++numIter;
+        }
+        if (params.verbose > PRINT_NONE) {
+            std::cout << "LDLT: " << numIter - 1 << " refinement steps, ||r|| = "
+                      << std::scientific << norm2 << std::endl;
+        }
+    }
+
+    for (USI i = 0; i < n; ++i) x[perm[i]] = xk[i];
+
+    return errorCode;
+}
+
+/// Clean up the factors.
+void LDLT::Clean()
+{
+    n        = 0;
+    numSuper = 0;
+    std::vector<DBL>().swap(Lx);
+    std::vector<DBL>().swap(D);
+    std::vector<DBL>().swap(bk);
+    std::vector<DBL>().swap(xk);
+    std::vector<DBL>().swap(rk);
+    std::vector<DBL>().swap(ek);
+    std::vector<USI>().swap(rowIndS);
+    std::vector<USI>().swap(asmRow);
+    std::vector<USI>().swap(asmSrc);
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Use friend access, report refinement */
+/*  Chensong Zhang      Oct/19/2026      Nested dissection, growth check      */
+/*----------------------------------------------------------------------------*/
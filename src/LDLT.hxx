@@ -0,0 +1,161 @@
+/*! \file    LDLT.hxx
+ *  \brief   Supernodal sparse LDL^T direct solver class declaration
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+/*! Important Note:
+ *-----------------------------------------------------------------------------------
+ *  The factorization only reads the lower triangular part (including the diagonal)
+ *  of the input MAT, so both symmetric storage (lower part only, like nos7.mtx) and
+ *  full storage are accepted. The steps are:
+ *
+ *  1. Nested dissection ordering followed by an elimination tree postorder;
+ *  2. Symbolic analysis: elimination tree, column counts from row subtrees,
+ *     relaxed supernodes and their row structures;
+ *  3. Numeric factorization: left-looking supernodal LDL^T with dense column-major
+ *     blocks. Supernodes on the same level of the supernodal elimination tree are
+ *     independent and factorized in parallel with OpenMP; the dissected subgraphs
+ *     give many independent subtrees.
+ *
+ *  There is no pivoting, neither 1x1 nor 2x2 (Bunch-Kaufman), so the solver is
+ *  not robust for general indefinite or saddle-point matrices. Tiny pivots are
+ *  replaced by +/- eps*||A|| (static pivoting) and the solution is improved by a
+ *  few steps of iterative refinement; Solve returns ERROR_SOLVER_MAXIT if they do
+ *  not reach the tolerance. If the entries of L D grow beyond max|A| / sqrt(eps),
+ *  Setup returns ERROR_DSOLVER_SETUP. In the SPD mode, a nonpositive pivot is an
+ *  error. Solve reads A in the refinement, so A has to outlive the solver.
+ */
+
+#ifndef __LDLT_HEADER__ /*-- allow multiple inclusions --*/
+#define __LDLT_HEADER__ /**< indicate LDLT.hxx has been included before */
+
+// Standard header files
+#include <vector>
+
+// FASPXX header files
+#include "ErrorLog.hxx"
+#include "MAT.hxx"
+#include "SOL.hxx"
+
+/*! \class LDLT
+ *  \brief Supernodal sparse LDL^T factorization for symmetric matrices.
+ */
+class LDLT : public SOL
+{
+private:
+    USI  n;            ///< dimension of the matrix
+    bool spd;          ///< whether the matrix is assumed to be SPD
+    USI  maxSuperSize; ///< maximal number of columns in one supernode
+    USI  numPerturbed; ///< number of perturbed pivots in the last factorization
+    DBL  growth;       ///< element growth max|L D| / max|A| in the last factorization
+
+    std::vector<USI> perm; ///< fill-reducing permutation: new index -> old index
+    std::vector<USI> pinv; ///< inverse permutation: old index -> new index
+
+    std::vector<USI> asmPtr; ///< entries of A in each column of the permuted matrix
+    std::vector<USI> asmRow; ///< permuted row index of each entry of A
+    std::vector<USI> asmSrc; ///< position of each entry in the values of A
+
+    USI                 numSuper; ///< number of supernodes
+    std::vector<USI>    superPtr; ///< first column of each supernode
+    std::vector<USI>    snode;    ///< supernode that each column belongs to
+    std::vector<USI>    rowPtrS;  ///< pointers to the row structure of each supernode
+    std::vector<USI>    rowIndS;  ///< row structures of all supernodes
+    std::vector<size_t> valPtr;   ///< pointers to the dense block of each supernode
+
+    std::vector<USI> updPtr; ///< pointers to descendant updates of each supernode
+    std::vector<USI> updSrc; ///< descendant supernode of each update
+    std::vector<USI> updBeg; ///< first row position of the update in the descendant
+    std::vector<USI> updEnd; ///< last row position (excluded) of the update
+
+    std::vector<USI> levelPtr;  ///< pointers to supernodes on each tree level
+    std::vector<USI> levelNode; ///< supernodes sorted by tree levels
+
+    std::vector<DBL> Lx; ///< dense blocks of L, column-major, unit diagonal implied
+    std::vector<DBL> D;  ///< diagonal matrix D
+    std::vector<DBL> bk; ///< right-hand side in the permuted ordering
+    std::vector<DBL> xk; ///< solution in the permuted ordering
+    std::vector<DBL> rk; ///< work vector for the residual in refinement
+    std::vector<DBL> ek; ///< work vector for the correction in refinement
+
+    /// Symbolic analysis: ordering, elimination tree and supernodes.
+    FaspRetCode Analyze(const MAT& A);
+
+    /// Numeric factorization reusing the symbolic analysis.
+    FaspRetCode Factorize(const MAT& A);
+
+    /// Factorize one supernode after all of its descendants are done.
+    FaspRetCode FactorSuper(USI s, const DBL* val, DBL pivTol, std::vector<USI>& map,
+                            std::vector<DBL>& work, DBL& maxEntry);
+
+    /// Solve with the factors only, in the permuted ordering.
+    void SolveLDLT(const std::vector<DBL>& b, std::vector<DBL>& x) const;
+
+    /// Residual of the permuted system using the lower part of A.
+    void ResidualLDLT(const std::vector<DBL>& b, const std::vector<DBL>& x,
+                      std::vector<DBL>& r) const;
+
+public:
+    /// Default constructor.
+    LDLT()
+        : n(0)
+        , spd(false)
+        , maxSuperSize(128)
+        , numPerturbed(0)
+        , growth(0.0)
+        , numSuper(0){};
+
+    /// Default destructor.
+    ~LDLT() = default;
+
+    /// Assume the matrix is SPD: pivots must be positive (Cholesky mode).
+    void SetSPD(bool flag);
+
+    /// Set maximal number of columns in one supernode.
+    void SetMaxSuperSize(USI size);
+
+    /// Get number of perturbed pivots in the last factorization.
+    USI GetNumPerturbed() const;
+
+    /// Get number of nonzeros of the factor L (including the diagonal).
+    size_t GetFactorNNZ() const;
+
+    /// Get number of supernodes.
+    USI GetNumSuper() const;
+
+    /// Get number of levels of the supernodal elimination tree.
+    USI GetNumLevels() const;
+
+    /// Get number of leaves of the supernodal elimination tree.
+    USI GetNumLeaves() const;
+
+    /// Setup the solver: symbolic analysis and numeric factorization.
+    FaspRetCode Setup(const MAT& A);
+
+    /// Setup the solver with a linear operator, which has to be a MAT.
+    FaspRetCode Setup(const LOP& A) override;
+
+    /// Solve Ax=b using the LDL^T factors.
+    FaspRetCode Solve(const VEC& b, VEC& x) override;
+
+    /// Clean up the factors.
+    void Clean() override;
+};
+
+#endif /* end if for __LDLT_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Report failed refinement             */
+/*  Chensong Zhang      Oct/19/2026      Nested dissection, growth check      */
+/*----------------------------------------------------------------------------*/
@@ -44,7 +44,7 @@ public:
     LOP& operator=(const LOP& lop);
 
     /// Default destructor.
-    ~LOP() = default;
+    virtual ~LOP() = default;
 
     /// Get row space dimension.
     USI GetRowSize() const;
@@ -91,4 +91,5 @@ public:
 /*----------------------------------------------------------------------------*/
 /*  Chensong Zhang      Sep/27/2019      Create file                          */
 /*  Chensong Zhang      Sep/16/2021      Restructure file                     */
+/*  Chensong Zhang      Oct/19/2026      Make destructor virtual              */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -13,6 +13,7 @@
 #include <cmath>
 #include <cstring>
 #include <fstream>
+#include <utility>
 
 // FASPXX header files
 #include "MAT.hxx"
@@ -249,6 +250,25 @@ void MAT::SetValues(const USI& nrow, const USI& mcol, const USI& nnz,
     this->FormDiagPtr();
 }
 
+/// Set values of nrow, mcol, nnz and move values, colInd, rowPtr, diagPtr in.
+void MAT::SetValues(const USI& nrow, const USI& mcol, const USI& nnz,
+                    std::vector<DBL>&& values, std::vector<USI>&& colInd,
+                    std::vector<USI>&& rowPtr, std::vector<USI>&& diagPtr)
+{
+    if (nrow == 0 || mcol == 0 || nnz == 0) {
+        this->Empty();
+        return;
+    }
+
+    this->nrow    = nrow;
+    this->mcol    = mcol;
+    this->nnz     = nnz;
+    this->values  = std::move(values);
+    this->rowPtr  = std::move(rowPtr);
+    this->colInd  = std::move(colInd);
+    this->diagPtr = std::move(diagPtr);
+}
+
 /// Return this->nnz.
 USI MAT::GetNNZ() const { return this->nnz; }
 
@@ -344,6 +364,17 @@ void MAT::GetUpperTri(MAT& uTri) const
     uTri.FormDiagPtr();
 }
 
+/// Get *this as a dense row-major array of size nrow * mcol.
+void MAT::GetDense(std::vector<DBL>& dense) const
+{
+    dense.assign((size_t)this->nrow * this->mcol, 0.0);
+    for (USI j = 0; j < this->nrow; ++j) {
+        DBL* row = dense.data() + (size_t)j * this->mcol;
+        for (USI k = this->rowPtr[j]; k < this->rowPtr[j + 1]; ++k)
+            row[this->colInd[k]] += this->values[k];
+    }
+}
+
 /// Copy *this to mat.
 void MAT::CopyTo(MAT& mat) const { mat = *this; }
 
@@ -817,100 +848,72 @@ void MAT::MultRight(const MAT& mat)
     Mult(mat, tmp);
 }
 
-/// Compute mat = Inverse(*this).
-void MAT::Inverse(MAT& inv_mat) const
+/// Recompute the values of *this = R * A * P, keeping the sparsity of *this, e.g.
+/// the Galerkin coarse operator after the values of A changed. Returns
+/// ERROR_MAT_DATA if the product has an entry outside the pattern of *this, in
+/// which case the values are incomplete and the product has to be formed again.
+FaspRetCode MAT::RAPNumeric(const MAT& R, const MAT& A, const MAT& P)
 {
+    if (R.mcol != A.nrow || A.mcol != P.nrow || R.nrow != nrow || P.mcol != mcol)
+        return FaspRetCode::ERROR_NONMATCH_SIZE;
 
-    MAT mat;
-
-    mat.nrow = this->nrow;
-    mat.mcol = this->mcol;
-    mat.nnz  = this->nrow * this->mcol;
-
-    USI count = 0;
-
-    mat.rowPtr.resize(this->nrow + 1);
-    for (USI j = 0; j < this->nrow + 1; ++j) mat.rowPtr[j] = j * this->mcol;
-
-    mat.colInd.resize(this->nrow * this->mcol);
-    for (USI k = 0; k < this->nrow; ++k) {
-        for (USI j = 0; j < this->mcol; ++j) {
-            mat.colInd[count] = j;
-            ++count;
-        }
+    // Position of each column in the current row of *this; -1 if not in there
+    std::vector<INT> marker;
+    try {
+        marker.assign(mcol, -1);
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
     }
 
-    mat.values.resize(this->nrow * this->mcol);
-
-    mat.FormDiagPtr();
-
-    inv_mat = mat;
-
-    count   = 0;
-    USI num = 0, numcount = 0, tmp = 0;
-    for (USI j = 0; j < this->nrow; ++j) {
-        num = this->rowPtr[j + 1] - this->rowPtr[j];
-        for (USI k = 0; k < this->colInd[this->rowPtr[j]]; ++k) {
-            mat.values[count] = 0;
-            ++count;
-            ++tmp;
+    FaspRetCode retCode = FaspRetCode::SUCCESS;
+    for (USI i = 0; i < nrow; ++i) {
+        for (USI m = rowPtr[i]; m < rowPtr[i + 1]; ++m) {
+            marker[colInd[m]] = m;
+            values[m]         = 0.0;
         }
-        for (USI k = this->colInd[this->rowPtr[j]]; k < mcol; ++k) {
-            if (this->colInd[this->rowPtr[j] + numcount] == k) {
-                mat.values[count] = this->values[this->rowPtr[j] + numcount];
-                ++numcount;
-                ++count;
-                ++tmp;
-            } else {
-                mat.values[count] = 0;
-                ++count;
-                ++tmp;
-            }
-            if (num == numcount) {
-                numcount = 0;
-                break;
+
+        // Row i of R * A * P, one entry of R and one row of A at a time
+        for (USI k = R.rowPtr[i]; k < R.rowPtr[i + 1]; ++k) {
+            const USI row = R.colInd[k];
+            for (USI j = A.rowPtr[row]; j < A.rowPtr[row + 1]; ++j) {
+                const DBL ra  = R.values[k] * A.values[j];
+                const USI col = A.colInd[j];
+                for (USI l = P.rowPtr[col]; l < P.rowPtr[col + 1]; ++l) {
+                    const INT pos = marker[P.colInd[l]];
+                    if (pos < 0)
+                        retCode = FaspRetCode::ERROR_MAT_DATA;
+                    else
+                        values[pos] += ra * P.values[l];
+                }
             }
         }
-        for (USI k = this->colInd[this->rowPtr[j]] + tmp; k < this->mcol; ++k) {
-            mat.values[count] = 0;
-            ++count;
-        }
-    }
-
-    LUPSolveInverse(mat.values, this->nrow, inv_mat.values);
-}
 
-/// Write data to a disk file in CSR format.
-void WriteCSR(char* filename, MAT mat)
-{
-    std::ofstream out;
-    out.open(filename);
-
-    out << mat.nrow << " " << mat.mcol << " " << mat.nnz << "\n";
-    for (USI j = 0; j < mat.nrow + 1; ++j) out << mat.rowPtr[j] << "\n";
-    for (USI j = 0; j < mat.nnz; ++j) out << mat.colInd[j] << "\n";
-    for (USI j = 0; j < mat.nnz; ++j) out << mat.values[j] << "\n";
+        for (USI m = rowPtr[i]; m < rowPtr[i + 1]; ++m) marker[colInd[m]] = -1;
+    }
 
-    out.close();
+    return retCode;
 }
 
-/// Write data to a disk file in MTX format.
-void WriteMTX(char* filename, MAT mat)
+/// Compute mat = Inverse(*this).
+void MAT::Inverse(MAT& inv_mat) const
 {
-    USI           begin, end, j, k;
-    std::ofstream out;
-    MAT           tmp = mat;
-    tmp.TransInPlace();
-
-    out.open(filename);
-    out << tmp.nrow << " " << tmp.mcol << " " << tmp.nnz << "\n";
-    for (j = 0; j < tmp.nrow; ++j) {
-        begin = tmp.rowPtr[j];
-        end   = tmp.rowPtr[j + 1];
-        for (k = begin; k < end; ++k)
-            out << j << " " << tmp.colInd[j] << " " << tmp.values[j] << std::endl;
-    }
-    out.close();
+    const USI N = this->nrow;
+
+    // Full sparsity pattern for the inverse
+    inv_mat.nrow = N;
+    inv_mat.mcol = this->mcol;
+    inv_mat.nnz  = N * this->mcol;
+    inv_mat.rowPtr.resize(N + 1);
+    for (USI j = 0; j < N + 1; ++j) inv_mat.rowPtr[j] = j * this->mcol;
+    inv_mat.colInd.resize(inv_mat.nnz);
+    for (USI k = 0; k < N; ++k)
+        for (USI j = 0; j < this->mcol; ++j) inv_mat.colInd[k * this->mcol + j] = j;
+    inv_mat.values.resize(inv_mat.nnz);
+    inv_mat.FormDiagPtr();
+
+    std::vector<DBL> dense;
+    GetDense(dense);
+    LUPSolveInverse(dense, N, inv_mat.values);
 }
 
 /// Form diagPtr by using colInd and rowPtr.
@@ -998,8 +1001,9 @@ void MAT::LUPDecomp(std::vector<DBL> A, std::vector<DBL>& L, std::vector<DBL>& U
 }
 
 /// LUP solver
-void MAT::LUPSolve(std::vector<DBL> L, std::vector<DBL> U, std::vector<USI> P,
-                   std::vector<DBL> b, USI N, std::vector<DBL>& x) const
+void MAT::LUPSolve(const std::vector<DBL>& L, const std::vector<DBL>& U,
+                   const std::vector<USI>& P, const std::vector<DBL>& b, USI N,
+                   std::vector<DBL>& x) const
 {
     std::vector<DBL> y(N);
 
@@ -1050,35 +1054,23 @@ void MAT::Rtranspose(std::vector<DBL>& mtx, USI m, USI n) const
 }
 
 /// LUP inversion (assemble each column x from each column B)
-void MAT::LUPSolveInverse(const std::vector<DBL> A, USI N,
+void MAT::LUPSolveInverse(const std::vector<DBL>& A, USI N,
                           std::vector<DBL>& inv_A) const
 {
-    std::vector<DBL> A_mirror(N * N);
+    std::vector<DBL> L(N * N);
+    std::vector<DBL> U(N * N);
+    std::vector<USI> P(N);
     std::vector<DBL> inv_A_each(N);
-    std::vector<DBL> b(N);
+    std::vector<DBL> b(N, 0.0);
 
-    USI count = 0;
+    // Factorize only once; each column of the inverse is a pair of triangular solves
+    LUPDecomp(A, L, U, P, N);
 
     for (USI i = 0; i < N; ++i) {
-        std::vector<DBL> L(N * N);
-        std::vector<DBL> U(N * N);
-        std::vector<USI> P(N);
-
-        // Construct each column of unit matrix
-        for (USI k = 0; k < N; ++k) b[k] = 0;
-        b[i] = 1;
-
-        // Need to make a new copy of a every time
-        for (USI k = 0; k < N * N; ++k) A_mirror[k] = A[k];
-
-        LUPDecomp(A_mirror, L, U, P, N);
-
+        b[i] = 1; // i-th column of unit matrix
         LUPSolve(L, U, P, b, N, inv_A_each);
-        while (count < N) {
-            inv_A[i * N + count] = inv_A_each[count];
-            ++count;
-        }
-        count = 0;
+        b[i] = 0;
+        for (USI k = 0; k < N; ++k) inv_A[i * N + k] = inv_A_each[k];
     }
 
     Rtranspose(inv_A, N, N);
@@ -1101,6 +1093,10 @@ void IdentityMatrix::Apply(const VEC& b, VEC& x) const { x = b; }
 /*----------------------------------------------------------------------------*/
 /*  Kailei Zhang        Sep/25/2019      Create file                          */
 /*  Chensong Zhang      Sep/16/2021      Restructure file                     */
+/*  Chensong Zhang      Oct/19/2026      Factorize only once in Inverse       */
+/*  Chensong Zhang      Oct/19/2026      Add SetValues taking over arrays     */
+/*  Chensong Zhang      Oct/19/2026      Move writers to WriteData            */
+/*  Chensong Zhang      Oct/19/2026      Add numeric Galerkin product         */
 /*----------------------------------------------------------------------------*/
 
 #if 0
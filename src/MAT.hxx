@@ -47,6 +47,14 @@ private:
     std::vector<USI> diagPtr; ///< pointers to diagonal entries in values.
 
 public:
+    friend class DeltaMAT;
+    friend class FloatMAT;
+    friend class LDLT;
+    friend class SymMAT;
+    friend class UMFPACK;
+    template <class TTT>
+    friend class MG;
+
     //------------------- Default Constructor Behavior -----------------------//
     // If "nrow == 0", "mcol ==0 " or "nnz == 0", set *this as empty matrix.  //
     // If these parameters can't form a CSRx data type, throw an exception.   //
@@ -109,6 +117,11 @@ public:
                    const std::vector<DBL>& values, const std::vector<USI>& colInd,
                    const std::vector<USI>& rowPtr);
 
+    /// Set values of the matrix with CSRx format, taking over the arrays.
+    void SetValues(const USI& nrow, const USI& mcol, const USI& nnz,
+                   std::vector<DBL>&& values, std::vector<USI>&& colInd,
+                   std::vector<USI>&& rowPtr, std::vector<USI>&& diagPtr);
+
     /// Get number of nonzeros of the matrix.
     USI GetNNZ() const;
 
@@ -124,6 +137,9 @@ public:
     /// Get the upper triangular matrix.
     void GetUpperTri(MAT& uTri) const;
 
+    /// Get the matrix as a dense row-major array.
+    void GetDense(std::vector<DBL>& dense) const;
+
     /// Copy the matrix to another MAT object.
     void CopyTo(MAT& mat) const;
 
@@ -172,14 +188,20 @@ public:
     /// Compute *this = mat * *this.
     void MultRight(const MAT& mat);
 
+    /// Recompute the values of *this = R * A * P, keeping the sparsity of *this.
+    FaspRetCode RAPNumeric(const MAT& R, const MAT& A, const MAT& P);
+
     /// Compute invmat = Inverse(*this).
     void Inverse(MAT& invmat) const;
 
     /// Write an MAT matrix to a disk file in CSR format.
-    friend void WriteCSR(char* filename, MAT mat);
+    friend FaspRetCode WriteCSR(const char* filename, const MAT& mat, bool compress);
 
     /// Write an MAT matrix to a disk file in MTX format.
-    friend void WriteMTX(char* filename, MAT mat);
+    friend FaspRetCode WriteMTX(const char* filename, const MAT& mat, bool compress);
+
+    /// Write an MAT matrix to a disk file in binary format.
+    friend FaspRetCode WriteBinMAT(const char* filename, const MAT& mat);
 
 private:
     /// Form diagPtr according to colInd and rowPtr.
@@ -193,8 +215,9 @@ private:
                    std::vector<USI>& P, USI N) const;
 
     /// LUP solver
-    void LUPSolve(std::vector<DBL> L, std::vector<DBL> U, std::vector<USI> P,
-                  std::vector<DBL> b, USI N, std::vector<DBL>& x) const;
+    void LUPSolve(const std::vector<DBL>& L, const std::vector<DBL>& U,
+                  const std::vector<USI>& P, const std::vector<DBL>& b, USI N,
+                  std::vector<DBL>& x) const;
 
     /// successor
     USI GetNext(USI i, USI m, USI n) const;
@@ -209,7 +232,8 @@ private:
     void Rtranspose(std::vector<DBL>& mtx, USI m, USI n) const;
 
     /// LUP inversion (assemble each column x from each column B)
-    void LUPSolveInverse(std::vector<DBL> A, USI N, std::vector<DBL>& inv_A) const;
+    void LUPSolveInverse(const std::vector<DBL>& A, USI N,
+                         std::vector<DBL>& inv_A) const;
 };
 
 /*! \class IdentityMatrix
@@ -240,4 +264,15 @@ public:
 /*----------------------------------------------------------------------------*/
 /*  Kailei Zhang        Sep/25/2019      Create file                          */
 /*  Chensong Zhang      Sep/16/2021      Restructure file, fix Doxygen        */
+/*  Chensong Zhang      Oct/19/2026      Add GetDense, pass LUP data by ref   */
+/*  Chensong Zhang      Oct/19/2026      Add binary writer as a friend        */
+/*  Chensong Zhang      Oct/19/2026      Add SetValues taking over arrays     */
+/*  Chensong Zhang      Oct/19/2026      Move writers to WriteData            */
+/*  Chensong Zhang      Oct/19/2026      Add DeltaMAT as a friend             */
+/*  Chensong Zhang      Oct/19/2026      Add SymMAT as a friend               */
+/*  Chensong Zhang      Oct/19/2026      Add numeric Galerkin product         */
+/*  Chensong Zhang      Oct/19/2026      Add FloatMAT as a friend             */
+/*  Chensong Zhang      Oct/19/2026      Add MG as a friend                   */
+/*  Chensong Zhang      Oct/19/2026      Add LDLT as a friend                 */
+/*  Chensong Zhang      Oct/19/2026      Add UMFPACK as a friend              */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
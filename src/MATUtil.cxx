@@ -451,16 +451,12 @@ FaspRetCode SortCSRRow(const USI& row, const USI& col, const USI& nnz,
         for (USI k = begin + 1; k < end; ++k) {
             index = colInd[k];
             data  = values[k];
-            for (l = k - 1; l >= begin; --l) {
-                if (index < colInd[l]) {
-                    colInd[l + 1] = colInd[l];
-                    values[l + 1] = values[l];
-                } else {
-                    break;
-                }
+            for (l = k; l > begin && index < colInd[l - 1]; --l) { // USI l >= 0!
+                colInd[l] = colInd[l - 1];
+                values[l] = values[l - 1];
             }
-            colInd[l + 1] = index;
-            values[l + 1] = data;
+            colInd[l] = index;
+            values[l] = data;
         }
     }
 
@@ -482,4 +478,5 @@ FaspRetCode SortCSRRow(const USI& row, const USI& col, const USI& nnz,
 /*----------------------------------------------------------------------------*/
 /*  Kailei Zhang        Sep/26/2019      Create file                          */
 /*  Chensong Zhang      Sep/16/2021      Restructure file                     */
+/*  Chensong Zhang      Oct/19/2026      Fix index underflow in SortCSRRow    */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -9,6 +9,10 @@
  *-----------------------------------------------------------------------------------
  */
 
+// Standard header files
+#include <algorithm>
+#include <cmath>
+
 // FASPXX header files
 #include "MG.hxx"
 
@@ -22,30 +26,70 @@ void MG<TTT>::SetNumCycles(USI ncycle)
     for (USI i = 0; i < numLevelsCoarse; ++i) numCycles[i] = ncycle;
 }
 
+/// Set type of the multigrid cycle
+template <class TTT>
+void MG<TTT>::SetCycleType(CycleType type)
+{
+    if (type != cycleType) workReady = false; // K-cycle and AMLI need more space
+    cycleType = type;
+}
+
+/// Start with a full multigrid pass, which replaces the initial guess
+template <class TTT>
+void MG<TTT>::SetFullMG(bool useFullMG)
+{
+    this->useFullMG = useFullMG;
+    SetSolType(useFullMG ? SOLType::SOLVER_FMG : SOLType::SOLVER_MG);
+}
+
+/// Set the residual reduction that makes the K-cycle skip its second step
+template <class TTT>
+void MG<TTT>::SetKCycleTol(DBL tol)
+{
+    kCycleTol = tol;
+}
+
+/// Set the lower eigenvalue bound used by the AMLI polynomial, in (0, 1)
+template <class TTT>
+void MG<TTT>::SetAMLIBound(DBL bound)
+{
+    amliBound = bound;
+}
+
 /// Setup multilevel solver level by level.
 template <class TTT>
 FaspRetCode MG<TTT>::SetupLevel(const TTT& A, const USI level, TTT* tranOpers,
                                 SOL* smoothers, SOL* coarseSolvers)
 {
-    if (level > numLevelsCoarse) FASPXX_ABORT("Too many levels specified!");
+    // Same operator for restriction and prolongation; keep the coefficient operator
+    return SetupLevel(level, tranOpers, tranOpers, nullptr, smoothers, smoothers,
+                      coarseSolvers);
+}
+
+/// Setup one level with its own transfers, coarse operator, and smoothers.
+template <class TTT>
+FaspRetCode MG<TTT>::SetupLevel(const USI level, TTT* restriction, TTT* prolongation,
+                                TTT* coarseOper, SOL* preSolver, SOL* postSolver,
+                                SOL* coarseSolver)
+{
+    if (level >= numLevelsCoarse) FASPXX_ABORT("Too many levels specified!");
 
-    // Step 1. Set problem sizes and work spaces for coarse levels
-    infoHL[level].fineSpaceSize = tranOpers->GetColSize();
-    infoHL[level].coarSpaceSize = tranOpers->GetRowSize();
-    infoHL[level].b.SetValues(infoHL[level].coarSpaceSize, 0.0);
-    infoHL[level].x.SetValues(infoHL[level].coarSpaceSize, 0.0);
-    infoHL[level].r.SetValues(infoHL[level].coarSpaceSize, 0.0);
+    // Step 1. Set problem sizes; work vectors are allocated by AllocWorkspace
+    infoHL[level].fineSpaceSize = restriction->GetColSize();
+    infoHL[level].coarSpaceSize = restriction->GetRowSize();
+    workReady                   = false;
 
     // Step 2. Set transfer operators and problems for all levels
-    infoHL[level].prolongation = tranOpers; // set prolongation as identity
-    infoHL[level].restriction  = tranOpers; // set restriction as identity'
+    infoHL[level].restriction  = restriction;  // fine to coarse
+    infoHL[level].prolongation = prolongation; // coarse to fine
+    infoHL[level].coarseOper   = coarseOper;   // nullptr: same as the finer level
 
     // Setp 3. Set smoothers for all levels
-    infoHL[level].preSolver = smoothers; // set presmoother
-    infoHL[level].postSolver = smoothers; // set postsmoother
+    infoHL[level].preSolver  = preSolver;  // set presmoother
+    infoHL[level].postSolver = postSolver; // set postsmoother
 
     // Setp 4. Set coarse solvers for all levels
-    infoHL[level].coarseSolver = coarseSolvers; // set coarse solver
+    infoHL[level].coarseSolver = coarseSolver; // set coarse solver
 
     return FaspRetCode::SUCCESS;
 }
@@ -59,12 +103,15 @@ FaspRetCode MG<TTT>::SetupALL(const TTT& A, const USI numLevels)
     numLevelsCoarse    = numLevels; // only one coarse level used
 
     // Set solver type
-    SetSolType(SOLType::SOLVER_MG);
+    SetSolType(useFullMG ? SOLType::SOLVER_FMG : SOLType::SOLVER_MG);
 
     // Step 0. Allocate memory for temporary vectors
     try {
+        infoHL.clear();
         infoHL.resize(numLevelsCoarse);
+        numCycles.assign(numLevelsCoarse, 1); // V-cycle unless set afterwards
         r.SetValues(probSize, 0.0);
+        workReady = false;
     } catch (std::bad_alloc& ex) {
         return FaspRetCode::ERROR_ALLOC_MEM;
     }
@@ -72,12 +119,140 @@ FaspRetCode MG<TTT>::SetupALL(const TTT& A, const USI numLevels)
     // Setup the coefficient matrix
     this->A = &A;
 
+    // Keep the pattern and the scaled values of A for UpdateValues
+    const MAT* mat = dynamic_cast<const MAT*>(&A);
+    try {
+        if (mat != nullptr) {
+            ScaleRows(*mat, setupValues);
+            setupRowPtr = mat->rowPtr;
+            setupColInd = mat->colInd;
+        } else {
+            setupValues.clear();
+            setupRowPtr.clear();
+            setupColInd.clear();
+        }
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+    needsSetup = false;
+
     // Print used parameters
     if (params.verbose > PRINT_MIN) PrintParam(std::cout);
 
     return FaspRetCode::SUCCESS;
 }
 
+/// Scale the values of each row of A by its max-norm and save them in val.
+template <class TTT>
+void MG<TTT>::ScaleRows(const MAT& A, vector<DBL>& val)
+{
+    const vector<DBL>& values = A.values;
+    const vector<USI>& rowPtr = A.rowPtr;
+
+    val.resize(A.GetNNZ());
+    for (USI i = 0; i < A.GetRowSize(); ++i) {
+        DBL rowMax = 0.0;
+        for (USI j = rowPtr[i]; j < rowPtr[i + 1]; ++j)
+            rowMax = std::max(rowMax, std::abs(values[j]));
+        rowMax = (rowMax > CLOSE_ZERO) ? rowMax : 1.0;
+        for (USI j = rowPtr[i]; j < rowPtr[i + 1]; ++j) val[j] = values[j] / rowMax;
+    }
+}
+
+/// Refresh the hierarchy after the values of A changed but not its sparsity: the
+/// transfers are kept, the Galerkin coarse operators R A P are recomputed in their
+/// patterns, and the smoothers and the coarse solver are set up again. Everything
+/// on each level has to be a MAT. The coarse operators are only replaced when all
+/// of them have been computed, so a failure leaves the hierarchy as it was before
+/// the smoothers are touched. After the update, NeedsSetup() tells whether the
+/// row-scaled values, on which a coarsening is based, drifted by more than
+/// updateTol since the last full setup; the updated hierarchy is usable either way.
+template <class TTT>
+FaspRetCode MG<TTT>::UpdateValues(const MAT& A)
+{
+    FaspRetCode retCode = FaspRetCode::SUCCESS;
+
+    // Same sparsity as the last setup, and matrices on all levels
+    if (A.rowPtr != setupRowPtr || A.colInd != setupColInd || setupRowPtr.empty())
+        return FaspRetCode::ERROR_MAT_DATA;
+    for (const auto& hl : infoHL) {
+        if (dynamic_cast<const MAT*>(hl.restriction) == nullptr ||
+            dynamic_cast<const MAT*>(hl.prolongation) == nullptr ||
+            (hl.coarseOper != nullptr && dynamic_cast<MAT*>(hl.coarseOper) == nullptr))
+            return FaspRetCode::ERROR_MAT_DATA;
+    }
+
+    // Step 1. Galerkin coarse operators from fine to coarse, in copies
+    vector<MAT> coarseNew;
+    try {
+        coarseNew.reserve(infoHL.size());
+        const MAT* fine = &A;
+        for (auto& hl : infoHL) {
+            const MAT* coarse = dynamic_cast<const MAT*>(hl.coarseOper);
+            if (coarse == nullptr) continue; // same operator as the finer level
+            coarseNew.push_back(*coarse);
+            retCode = coarseNew.back().RAPNumeric(
+                    *dynamic_cast<const MAT*>(hl.restriction), *fine,
+                    *dynamic_cast<const MAT*>(hl.prolongation));
+            if (retCode < 0) return retCode;
+            fine = &coarseNew.back();
+        }
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    // All levels succeeded: commit the new values
+    this->A = &A;
+    auto next = coarseNew.begin();
+    for (auto& hl : infoHL) {
+        MAT* coarse = dynamic_cast<MAT*>(hl.coarseOper);
+        if (coarse != nullptr) *coarse = std::move(*next++);
+    }
+
+    // Step 2. Smoothers on each level and the coarsest solver
+    for (USI l = 0; l < numLevelsCoarse; ++l) {
+        HL<TTT>& hl = infoHL[l];
+        retCode     = hl.preSolver->Setup(*LevelOper(l));
+        if (retCode < 0) return retCode;
+        if (hl.postSolver != hl.preSolver) {
+            retCode = hl.postSolver->Setup(*LevelOper(l));
+            if (retCode < 0) return retCode;
+        }
+        if (l + 1 == numLevelsCoarse) {
+            retCode = hl.coarseSolver->Setup(*LevelOper(l + 1));
+            if (retCode < 0) return retCode;
+        }
+    }
+
+    // Step 3. Drift of the row-scaled values since the last setup
+    vector<DBL> values;
+    try {
+        ScaleRows(A, values);
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+    DBL drift = 0.0;
+    for (size_t j = 0; j < values.size(); ++j)
+        drift = std::max(drift, std::abs(values[j] - setupValues[j]));
+    needsSetup = (drift > updateTol);
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Set the drift of the row-scaled values of A that calls for a full setup
+template <class TTT>
+void MG<TTT>::SetUpdateTol(DBL tol)
+{
+    updateTol = tol;
+}
+
+/// Whether the values drifted too far since the last setup
+template <class TTT>
+bool MG<TTT>::NeedsSetup() const
+{
+    return needsSetup;
+}
+
 /// Allocate memory, setup multigrid hierarical structure of the linear system.
 template <class TTT>
 FaspRetCode MG<TTT>::Setup(const TTT& A)
@@ -101,9 +276,19 @@ FaspRetCode MG<TTT>::Setup(const TTT& A)
     return FaspRetCode::SUCCESS;
 }
 
-/// One multigrid V or W or variable cycle.
+/// Coefficient operator at a level: the last coarse operator set above it, or A.
 template <class TTT>
-void MG<TTT>::MGCycle(const VEC& b, VEC& x)
+const LOP* MG<TTT>::LevelOper(INT lvl) const
+{
+    const LOP* oper = A;
+    for (INT l = 0; l < lvl; ++l)
+        if (infoHL[l].coarseOper != nullptr) oper = infoHL[l].coarseOper;
+    return oper;
+}
+
+/// One multigrid cycle of the given type (V or W or variable, F, K, AMLI).
+template <class TTT>
+void MG<TTT>::MGCycle(const VEC& b, VEC& x, CycleType type)
 {
     if (numLevelsCoarse > 0) {
 
@@ -112,14 +297,18 @@ void MG<TTT>::MGCycle(const VEC& b, VEC& x)
         // return if out of HL range
         if (level - numLevelsCoarse == 0) return;
 
+        // coefficient operator and residual vector at current level
+        const LOP* oper = LevelOper(level);
+        VEC&       res  = (level == 0) ? r : infoHL[level - 1].r;
+
         // pre-smoothing
         infoHL[level].preSolver->Solve(b, x);
 
         // form residual r = b - A x
-        A->Residual(b, x, r);
+        oper->Residual(b, x, res);
 
         // restrict residual to coarser level r1 = R*r0
-        infoHL[level].restriction->Apply(r, infoHL[level].b);
+        infoHL[level].restriction->Apply(res, infoHL[level].b);
 
         // prepare for coarser level
         infoHL[level].x.SetValues(infoHL[level].coarSpaceSize, 0.0);
@@ -127,17 +316,27 @@ void MG<TTT>::MGCycle(const VEC& b, VEC& x)
         if (level + 1 - numLevelsCoarse == 0) {
             // call coarsest space solver
             infoHL[level].coarseSolver->Solve(infoHL[level].b, infoHL[level].x);
+        } else if (type == CYCLE_F) {
+            // F-cycle on the coarser level, followed by a V-cycle
+            MGCycle(infoHL[level].b, infoHL[level].x, CYCLE_F);
+            MGCycle(infoHL[level].b, infoHL[level].x, CYCLE_V);
+        } else if (type == CYCLE_K) {
+            // Krylov-accelerated cycles on the coarser level
+            KCycle(infoHL[level].b, infoHL[level].x);
+        } else if (type == CYCLE_AMLI) {
+            // polynomial in the cycle on the coarser level
+            AMLICycle(infoHL[level].b, infoHL[level].x);
         } else {
             // call multigrid cycle recursivley
             for (USI i = 0; i < numCycles[level]; ++i)
-                MGCycle(infoHL[level].b, infoHL[level].x);
+                MGCycle(infoHL[level].b, infoHL[level].x, CYCLE_V);
         }
 
         // prolongation P*e1
-        infoHL[level].prolongation->Apply(infoHL[level].x, r);
+        infoHL[level].prolongation->Apply(infoHL[level].x, res);
 
         // correction x = x + P*e1
-        x.AXPY(1.0, r);
+        x.AXPY(1.0, res);
 
         // post-smoothing
         infoHL[level].postSolver->Solve(b, x);
@@ -151,6 +350,154 @@ void MG<TTT>::MGCycle(const VEC& b, VEC& x)
     }
 }
 
+/// Coarse correction of the K-cycle (Notay and Vassilevski): at most two steps of
+/// flexible CG on the coarser level, each preconditioned by a K-cycle there. The
+/// second step is skipped if the first one reduces the residual by kCycleTol. The
+/// result depends nonlinearly on b, so use a flexible method outside.
+template <class TTT>
+void MG<TTT>::KCycle(const VEC& b, VEC& x)
+{
+    const LOP* oper = LevelOper(level + 1);
+    VEC &      t = infoHL[level].t, &d = infoHL[level].d, &v = infoHL[level].v;
+
+    // first step: c = B b in x, v = A c
+    MGCycle(b, x, CYCLE_K);
+    oper->Apply(x, v);
+    const DBL rho1 = x.Dot(v), alpha1 = x.Dot(b);
+    if (rho1 < CLOSE_ZERO) return; // keep the plain cycle
+
+    // t = b - alpha1 / rho1 * v
+    t = b;
+    t.AXPY(-alpha1 / rho1, v);
+    if (t.Norm2() <= kCycleTol * b.Norm2()) {
+        x.Scale(alpha1 / rho1);
+        return;
+    }
+
+    // second step: d = B t, orthogonalized against c in the A-inner product
+    d.SetValues(d.GetSize(), 0.0);
+    MGCycle(t, d, CYCLE_K);
+    const DBL gamma = d.Dot(v), alpha2 = d.Dot(t);
+    oper->Apply(d, v);
+    const DBL rho2 = d.Dot(v) - gamma * gamma / rho1;
+    if (rho2 < CLOSE_ZERO) {
+        x.Scale(alpha1 / rho1);
+        return;
+    }
+
+    // x = (alpha1 / rho1 - gamma * alpha2 / (rho1 * rho2)) c + alpha2 / rho2 d
+    x.AXPBY(alpha1 / rho1 - gamma * alpha2 / (rho1 * rho2), alpha2 / rho2, d);
+}
+
+/// Coarse correction of the AMLI cycle: numCycles = k stationary steps on the
+/// coarser level, preconditioned by an AMLI cycle there. The step lengths are the
+/// reciprocal roots of 1 + T_k(s), with s = (1 + amliBound - 2 t) / (1 - amliBound)
+/// mapping t in [amliBound, 1] onto [-1, 1], so the error propagates by
+/// (1 + T_k(s)) / (1 + T_k(s0)), s0 = s(0). The roots come in double pairs (with
+/// s = -1 left over for odd k), e.g. k = 2 takes two equal steps at the midpoint of
+/// [amliBound, 1]; the polynomial is nonnegative there, not the minimax one.
+template <class TTT>
+void MG<TTT>::AMLICycle(const VEC& b, VEC& x)
+{
+    const LOP* oper = LevelOper(level + 1);
+    const USI  deg  = numCycles[level];
+    const DBL  pi   = 3.14159265358979323846;
+    VEC &      t = infoHL[level].t, &d = infoHL[level].d;
+
+    for (USI j = 0; j < deg; ++j) {
+        const DBL angle = (2 * j + 1) * pi / deg;
+        const DBL root  = 0.5 * (1.0 + amliBound - (1.0 - amliBound) * std::cos(angle));
+        oper->Residual(b, x, t);
+        d.SetValues(d.GetSize(), 0.0);
+        MGCycle(t, d, CYCLE_AMLI);
+        x.AXPY(1.0 / root, d);
+    }
+}
+
+/// One full multigrid pass: solve on the coarsest level, then interpolate the
+/// solution to each finer level and improve it by one cycle there.
+template <class TTT>
+void MG<TTT>::FMGCycle(const VEC& b, VEC& x)
+{
+    if (numLevelsCoarse == 0) {
+        MGCycle(b, x, cycleType); // warns and returns
+        return;
+    }
+
+    // restrict right-hand side to all coarse levels
+    infoHL[0].restriction->Apply(b, infoHL[0].b);
+    for (USI l = 1; l < numLevelsCoarse; ++l)
+        infoHL[l].restriction->Apply(infoHL[l - 1].b, infoHL[l].b);
+
+    // call coarsest space solver
+    const INT coarsest = numLevelsCoarse - 1;
+    infoHL[coarsest].x.SetValues(infoHL[coarsest].coarSpaceSize, 0.0);
+    infoHL[coarsest].coarseSolver->Solve(infoHL[coarsest].b, infoHL[coarsest].x);
+
+    // interpolate upward; the cycle on a finer level only uses coarser work spaces
+    for (INT l = coarsest; l >= 0; --l) {
+        const VEC& bf = (l == 0) ? b : infoHL[l - 1].b;
+        VEC&       xf = (l == 0) ? x : infoHL[l - 1].x;
+        infoHL[l].prolongation->Apply(infoHL[l].x, xf);
+
+        level = l - 1; // start the cycle on the finer level
+        MGCycle(bf, xf, cycleType);
+        level = -1;
+    }
+}
+
+/// Allocate the work vectors of all coarse levels in one contiguous arena, level
+/// by level, so that the vectors used together in a cycle are close in memory.
+template <class TTT>
+FaspRetCode MG<TTT>::AllocWorkspace()
+{
+    const bool krylov  = (cycleType == CYCLE_K || cycleType == CYCLE_AMLI);
+    const USI  numVecs = krylov ? 6 : 3; // b, x, r (, t, d, v)
+
+    size_t len = 0;
+    for (const auto& hl : infoHL) len += (size_t)numVecs * hl.coarSpaceSize;
+
+    try {
+        // New arena; later growth of a vector falls back to the heap
+        vector<DBL> newArena(len);
+        auto        newPool = std::make_unique<std::pmr::monotonic_buffer_resource>(
+                newArena.data(), len * sizeof(DBL), std::pmr::new_delete_resource());
+
+        // Rebuild the levels with work vectors in the new arena
+        vector<HL<TTT>> levels;
+        levels.reserve(infoHL.size());
+        for (const auto& old : infoHL) {
+            HL<TTT>& hl      = levels.emplace_back(newPool.get());
+            hl.restriction   = old.restriction;
+            hl.prolongation  = old.prolongation;
+            hl.coarseOper    = old.coarseOper;
+            hl.preSolver     = old.preSolver;
+            hl.coarseSolver  = old.coarseSolver;
+            hl.postSolver    = old.postSolver;
+            hl.fineSpaceSize = old.fineSpaceSize;
+            hl.coarSpaceSize = old.coarSpaceSize;
+            hl.b.SetValues(hl.coarSpaceSize, 0.0);
+            hl.x.SetValues(hl.coarSpaceSize, 0.0);
+            hl.r.SetValues(hl.coarSpaceSize, 0.0);
+            if (!krylov) continue;
+            hl.t.SetValues(hl.coarSpaceSize, 0.0);
+            hl.d.SetValues(hl.coarSpaceSize, 0.0);
+            hl.v.SetValues(hl.coarSpaceSize, 0.0);
+        }
+
+        // Release the old levels before the arena they live in
+        infoHL.swap(levels);
+        levels.clear();
+        pool.swap(newPool);
+        arena.swap(newArena);
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    workReady = true;
+    return FaspRetCode::SUCCESS;
+}
+
 /// Using the multigrid method. Don't check problem sizes.
 template <class TTT>
 FaspRetCode MG<TTT>::Solve(const VEC& b, VEC& x)
@@ -160,6 +507,12 @@ FaspRetCode MG<TTT>::Solve(const VEC& b, VEC& x)
     // Declaration and definition of local variables
     double resAbs = 1.0, resRel = 1.0, denAbs = 1.0, ratio = 0.0, resAbsOld = 1.0;
 
+    // Allocate work vectors of coarse levels after the hierarchy changed
+    if (!workReady) {
+        errorCode = AllocWorkspace();
+        if (errorCode < 0) return errorCode;
+    }
+
     PrintHead();
 
     // Initialize iterative method
@@ -188,8 +541,11 @@ FaspRetCode MG<TTT>::Solve(const VEC& b, VEC& x)
         // Multigrid iteration starts from here
         //---------------------------------------------
 
-        MGCycle(b, x); // MG cycle
-        ++numIter;     // iteration count
+        if (numIter == 0 && useFullMG)
+            FMGCycle(b, x); // full multigrid pass
+        else
+            MGCycle(b, x, cycleType); // MG cycle
+        ++numIter;                    // iteration count
 
         //---------------------------------------------
         // One step of Multigrid iteration ends here
@@ -213,7 +569,11 @@ FaspRetCode MG<TTT>::Solve(const VEC& b, VEC& x)
 template <class TTT>
 void MG<TTT>::Clean()
 {
-    // TODO: do something here
+    infoHL.clear(); // before the arena the work vectors live in
+    pool.reset();
+    arena.clear();
+    arena.shrink_to_fit();
+    workReady = false;
 }
 
 // Explicitly instantiate the MG template
@@ -227,4 +587,11 @@ template class MG<MAT>;
 /*----------------------------------------------------------------------------*/
 /*  Chensong Zhang      Sep/12/2021      Create file                          */
 /*  Chensong Zhang      Sep/29/2021      Restructure MG method                */
+/*  Chensong Zhang      Oct/19/2026      Use coarse operators in the cycle    */
+/*  Chensong Zhang      Oct/19/2026      Add F-cycle and full multigrid       */
+/*  Chensong Zhang      Oct/19/2026      Add K-cycle and AMLI cycle           */
+/*  Chensong Zhang      Oct/19/2026      Allocate work vectors in one arena   */
+/*  Chensong Zhang      Oct/19/2026      Add values-only update of hierarchy  */
+/*  Chensong Zhang      Oct/19/2026      Check sparsity and atomic update     */
+/*  Chensong Zhang      Oct/19/2026      Fix AMLI polynomial comment          */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
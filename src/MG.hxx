@@ -12,6 +12,10 @@
 #ifndef __MG_HEADER__ /*-- allow multiple inclusions --*/
 #define __MG_HEADER__ /**< indicate MG.hxx has been included before */
 
+// Standard header files
+#include <memory>
+#include <memory_resource>
+
 // FASPXX header files
 #include "ErrorLog.hxx"
 #include "Iter.hxx"
@@ -20,6 +24,14 @@
 
 using std::vector;
 
+/// Multigrid cycle types.
+enum CycleType {
+    CYCLE_V    = 0, ///< V-cycle, or W-cycle with SetNumCycles(2)
+    CYCLE_F    = 1, ///< F-cycle: an F-cycle and then a V-cycle on the coarser level
+    CYCLE_K    = 2, ///< K-cycle: two flexible CG steps on the coarser level
+    CYCLE_AMLI = 3  ///< AMLI: polynomial 1 + T_k(s), scaled, on the coarser level
+};
+
 /*! \struct HL
  *  \brief  Hierarchical level information for one level.
  */
@@ -27,6 +39,7 @@ template <class TTT>
 struct HL {
     TTT* restriction;  ///< restriction to a coarser level
     TTT* prolongation; ///< prolongation from a coarser level
+    TTT* coarseOper;   ///< coefficient operator at the coarser level
     SOL* preSolver;    ///< pre-smoother before CGC
     SOL* coarseSolver; ///< coarse solver for CGC
     SOL* postSolver;   ///< post-smoother after CGC
@@ -36,6 +49,26 @@ struct HL {
     VEC b;             ///< right-hand side vector b at coarser level
     VEC x;             ///< solution vector x at coarser level
     VEC r;             ///< residual vector r at coarser level
+    VEC t;             ///< K-cycle and AMLI work vector: residual at coarser level
+    VEC d;             ///< K-cycle and AMLI work vector: correction at coarser level
+    VEC v;             ///< K-cycle work vector: operator times correction
+
+    /// Work vectors take memory from the given resource, e.g. the MG arena.
+    explicit HL(std::pmr::memory_resource* mem = std::pmr::get_default_resource())
+        : restriction(nullptr)
+        , prolongation(nullptr)
+        , coarseOper(nullptr)
+        , preSolver(nullptr)
+        , coarseSolver(nullptr)
+        , postSolver(nullptr)
+        , fineSpaceSize(0)
+        , coarSpaceSize(0)
+        , b(mem)
+        , x(mem)
+        , r(mem)
+        , t(mem)
+        , d(mem)
+        , v(mem){};
 };
 
 /*! \class MG
@@ -49,24 +82,46 @@ private:
     USI         numLevelsMax;    ///< max number of levels
     USI         numLevelsCoarse; ///< number of coarse levels in use <= max_levels
     bool        useSymmOper;     ///< use symmetric operator
+    bool        useFullMG;       ///< start with a full multigrid pass
+    CycleType   cycleType;       ///< type of the multigrid cycle
+    DBL         kCycleTol;       ///< K-cycle skips the second step below this ratio
+    DBL         amliBound;       ///< AMLI lower eigenvalue bound of the coarse cycle
     vector<USI> numCycles;       ///< number of cycles for each coarse level
     VEC         r;               ///< work vector for current residual
+    bool        workReady;       ///< work vectors of coarse levels are allocated
+    bool        needsSetup;      ///< values drifted too far since the last setup
+    DBL         updateTol;       ///< drift of scaled values that needs a new setup
+    vector<DBL> setupValues;     ///< row-scaled values of A at the last setup
+    vector<USI> setupRowPtr;     ///< row pointers of A at the last setup
+    vector<USI> setupColInd;     ///< column indices of A at the last setup
+
+    vector<DBL> arena; ///< one block for the work vectors of all coarse levels
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> pool; ///< pieces of arena
 
 public:
     vector<HL<TTT>> infoHL; ///< hierarichal info at all coarse levels
 
 private:
-    /// One multigrid V or W or variable cycle.
-    void MGCycle(const VEC& b, VEC& x);
+    /// One multigrid cycle of the given type (V or W or variable, F).
+    void MGCycle(const VEC& b, VEC& x, CycleType type);
 
-    /// One multigrid F cycle.
-    // TODO: void FCycle(const VEC& b, VEC& x);
+    /// One full multigrid pass from the coarsest level up to the finest.
+    void FMGCycle(const VEC& b, VEC& x);
 
-    /// One multigrid AMLI cycle.
-    // TODO: void AMLICycle(const VEC& b, VEC& x);
+    /// One multigrid AMLI cycle: polynomial coarse correction at the level.
+    void AMLICycle(const VEC& b, VEC& x);
 
-    /// One multigrid K cycle.
-    // TODO: void KCycle(const VEC& b, VEC& x);
+    /// One multigrid K cycle: Krylov-accelerated coarse correction at the level.
+    void KCycle(const VEC& b, VEC& x);
+
+    /// Coefficient operator at a level; level 0 is the finest one.
+    const LOP* LevelOper(INT lvl) const;
+
+    /// Allocate the work vectors of all coarse levels in the arena.
+    FaspRetCode AllocWorkspace();
+
+    /// Scale the values of each row of A by its max-norm and save them in val.
+    static void ScaleRows(const MAT& A, vector<DBL>& val);
 
 public:
     /// Default constructor.
@@ -75,6 +130,13 @@ public:
         , numLevelsMax(20)
         , numLevelsCoarse(0)
         , useSymmOper(true)
+        , useFullMG(false)
+        , cycleType(CYCLE_V)
+        , kCycleTol(0.25)
+        , amliBound(0.5)
+        , workReady(false)
+        , needsSetup(false)
+        , updateTol(0.2)
     {
         SetNumCycles(1);
     };
@@ -85,6 +147,18 @@ public:
     /// Set number of cycles for each coarse level.
     void SetNumCycles(USI ncycle);
 
+    /// Set type of the multigrid cycle.
+    void SetCycleType(CycleType type);
+
+    /// Start with a full multigrid pass, which replaces the initial guess.
+    void SetFullMG(bool useFullMG);
+
+    /// Set the residual reduction that makes the K-cycle skip its second step.
+    void SetKCycleTol(DBL tol);
+
+    /// Set the lower eigenvalue bound used by the AMLI polynomial, in (0, 1).
+    void SetAMLIBound(DBL bound);
+
     /// Setup the MG method using coefficient matrix A.
     FaspRetCode Setup(const TTT& A);
 
@@ -92,9 +166,24 @@ public:
     FaspRetCode SetupLevel(const TTT& A, const USI level, TTT* tranOpers,
                            SOL* smoothers, SOL* coarseSolvers);
 
+    /// Setup one level with its own transfers, coarse operator, and smoothers.
+    FaspRetCode SetupLevel(const USI level, TTT* restriction, TTT* prolongation,
+                           TTT* coarseOper, SOL* preSolver, SOL* postSolver,
+                           SOL* coarseSolver);
+
     /// Setup multilevel solver by hand.
     FaspRetCode SetupALL(const TTT& A, const USI numLevels);
 
+    /// Refresh coarse operators and smoothers after the values of A changed.
+    FaspRetCode UpdateValues(const MAT& A);
+
+    /// Set the drift of the row-scaled values of A that calls for a full setup.
+    void SetUpdateTol(DBL tol);
+
+    /// Whether the values drifted so far since the last setup that the hierarchy
+    /// should be built again.
+    bool NeedsSetup() const;
+
     /// Setup classical AMG.
     // TODO: FaspRetCode SetupCAMG(const MAT& A);
 
@@ -114,4 +203,11 @@ public:
 /*----------------------------------------------------------------------------*/
 /*  Chensong Zhang      Sep/12/2021      Create file                          */
 /*  Chensong Zhang      Sep/29/2021      Add hierarical info struct           */
+/*  Chensong Zhang      Oct/19/2026      Add coarse operators and transfers   */
+/*  Chensong Zhang      Oct/19/2026      Add F-cycle and full multigrid       */
+/*  Chensong Zhang      Oct/19/2026      Add K-cycle and AMLI cycle           */
+/*  Chensong Zhang      Oct/19/2026      Allocate work vectors in one arena   */
+/*  Chensong Zhang      Oct/19/2026      Add values-only update of hierarchy  */
+/*  Chensong Zhang      Oct/19/2026      Check sparsity and atomic update     */
+/*  Chensong Zhang      Oct/19/2026      Fix AMLI polynomial comment          */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
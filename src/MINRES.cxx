@@ -0,0 +1,205 @@
+/*! \file    MINRES.cxx
+ *  \brief   Preconditioned MINRES class definition
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <cmath>
+
+// FASPXX header files
+#include "MINRES.hxx"
+
+/// Allocate memory, setup coefficient matrix of the linear system.
+FaspRetCode MINRES::Setup(const LOP& A)
+{
+    // Set solver type
+    SetSolType(SOLType::SOLVER_MINRES);
+
+    // Allocate memory for temporary vectors
+    try {
+        len = A.GetColSize();
+        r1.SetValues(len, 0.0);
+        r2.SetValues(len, 0.0);
+        yk.SetValues(len, 0.0);
+        vk.SetValues(len, 0.0);
+        w1.SetValues(len, 0.0);
+        w2.SetValues(len, 0.0);
+        safe.SetValues(len, 0.0);
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    // Setup the coefficient matrix
+    this->A = &A;
+
+    // Print used parameters
+    if (params.verbose > PRINT_MIN) PrintParam(std::cout);
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Clean up temp memory allocated for MINRES.
+void MINRES::Clean()
+{
+    r1.SetValues(len, 0.0);
+    r2.SetValues(len, 0.0);
+    yk.SetValues(len, 0.0);
+    vk.SetValues(len, 0.0);
+    w1.SetValues(len, 0.0);
+    w2.SetValues(len, 0.0);
+    safe.SetValues(len, 0.0);
+}
+
+/// Using the MINRES method of Paige and Saunders. Don't check problem sizes.
+FaspRetCode MINRES::Solve(const VEC& b, VEC& x)
+{
+    FaspRetCode errorCode = FaspRetCode::SUCCESS;
+
+    // Local variables
+    double resAbs = 1.0, resRel = 1.0, denAbs = 1.0, ratio = 0.0, resAbsOld = 1.0;
+    double alpha, beta, betaOld = 0.0, gamma, gbar, delta, eps = 0.0, epsOld;
+    double cs = -1.0, sn = 0.0, dbar = 0.0, phi, phibar;
+
+    // Buffers are rotated instead of copied between iterations
+    VEC *rOld = &r1, *rNew = &r2, *y = &yk, *wOld = &w1, *wNew = &w2, *tmp;
+
+    PrintHead();
+
+    // Initialize iterative method
+    numIter = 0;
+    safe    = x;
+    A->Apply(x, *rNew);  // A * x -> r
+    rNew->XPAY(-1.0, b); // b - r -> r
+    rOld->SetValues(len, 0.0);
+    wOld->SetValues(len, 0.0);
+    wNew->SetValues(len, 0.0);
+
+    // Preconditioned residual and its norm induced by the preconditioner
+    y->SetValues(len, 0.0);
+    pcd->Solve(*rNew, *y); // preconditioning: B(r) -> y
+    beta = rNew->Dot(*y);
+    if (beta < 0.0) {
+        FASPXX_WARNING("Preconditioner is not positive definite!");
+        return FaspRetCode::ERROR_SOLVER_PCD_TYPE;
+    }
+    beta   = sqrt(beta);
+    phibar = resAbs = beta;
+    denAbs          = (CLOSE_ZERO > resAbs) ? CLOSE_ZERO : resAbs;
+
+    // Main MINRES loop
+    while (numIter < params.maxIter) {
+
+        // Start checking from minIter instead of 0
+        if (numIter == params.minIter) {
+            resRel    = resAbs / denAbs;
+            resAbsOld = resAbs;
+            if (resRel < params.relTol || resAbs < params.absTol) break;
+        }
+
+        if (numIter >= params.minIter) PrintInfo(numIter, resRel, resAbs, ratio);
+
+        //---------------------------------------------
+        // MINRES iteration starts from here
+        //---------------------------------------------
+
+        ++numIter; // iteration count
+
+        // Lanczos step: v_k = y / beta_k and the next unpreconditioned residual
+        // y = A v_k - (beta_k / beta_{k-1}) r_{k-1} - (alpha_k / beta_k) r_k
+        vk = *y;
+        vk.Scale(1.0 / beta);
+        A->Apply(vk, *y); // main computational work
+        if (numIter > 1) y->AXPY(-beta / betaOld, *rOld);
+        alpha = vk.Dot(*y);
+        y->AXPY(-alpha / beta, *rNew);
+
+        // Shift the residuals, r_{k-1} <- r_k and r_k <- y, then precondition
+        tmp  = rOld;
+        rOld = rNew;
+        rNew = y;
+        y    = tmp;
+        y->SetValues(len, 0.0);
+        pcd->Solve(*rNew, *y);
+
+        betaOld = beta;
+        beta    = rNew->Dot(*y);
+        if (beta < 0.0) {
+            FASPXX_WARNING("Preconditioner is not positive definite!");
+            errorCode = FaspRetCode::ERROR_SOLVER_PCD_TYPE;
+            break;
+        }
+        beta = sqrt(beta);
+
+        // Apply the previous rotation to the new column and compute the next one
+        epsOld = eps;
+        delta  = cs * dbar + sn * alpha;
+        gbar   = sn * dbar - cs * alpha;
+        eps    = sn * beta;
+        dbar   = -cs * beta;
+        gamma  = sqrt(gbar * gbar + beta * beta);
+        gamma  = (gamma > CLOSE_ZERO) ? gamma : CLOSE_ZERO;
+        cs     = gbar / gamma;
+        sn     = beta / gamma;
+        phi    = cs * phibar;
+        phibar = sn * phibar;
+
+        // w_k = (v_k - eps_{k-1} w_{k-2} - delta_k w_{k-1}) / gamma_k over w_{k-2}
+        wOld->AXPBY(-epsOld / gamma, 1.0 / gamma, vk);
+        wOld->AXPY(-delta / gamma, *wNew);
+        tmp  = wOld;
+        wOld = wNew;
+        wNew = tmp;
+
+        // Update solution
+        x.AXPY(phi, *wNew);
+
+        //---------------------------------------------
+        // One step of MINRES iteration ends here
+        //---------------------------------------------
+
+        if (numIter >= params.minIter) {
+            // The residual norm is available from the rotations for free
+            resAbs = phibar;
+            resRel = resAbs / denAbs;
+            ratio  = resAbs / resAbsOld;
+
+            // Save the best solution so far
+            if (numIter >= params.savIter && resAbs < resAbsOld) safe = x;
+
+            resAbsOld = resAbs;
+            if (resRel < params.relTol || resAbs < params.absTol) break;
+        }
+
+        // Lanczos breaks down: the solution is in the current Krylov space
+        if (beta < CLOSE_ZERO) break;
+
+    } // End of main MINRES loop
+
+    // If minIter == numIter == maxIter (preconditioner only), skip this
+    if (!(numIter == params.minIter && numIter == params.maxIter)) {
+        A->Apply(x, vk); // true residual r = b - Ax
+        vk.XPAY(-1.0, b);
+        this->norm2   = vk.Norm2();
+        this->normInf = vk.NormInf();
+        PrintFinal(numIter, resRel, resAbs, ratio);
+    }
+
+    // Restore the saved best iteration if needed
+    if (numIter > params.savIter) x = safe;
+
+    return errorCode;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
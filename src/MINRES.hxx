@@ -0,0 +1,73 @@
+/*! \file    MINRES.hxx
+ *  \brief   Preconditioned MINRES class declaration
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#ifndef __MINRES_HEADER__ /*-- allow multiple inclusions --*/
+#define __MINRES_HEADER__ /**< indicate MINRES.hxx has been included before */
+
+// FASPXX header files
+#include "ErrorLog.hxx"
+#include "LOP.hxx"
+#include "SOL.hxx"
+
+/*! \class MINRES
+ *  \brief Preconditioned minimal residual method for symmetric indefinite systems.
+ *
+ *  A has to be symmetric and the preconditioner symmetric positive definite. The
+ *  iteration minimizes the residual in the norm induced by the inverse of the
+ *  preconditioner, using the Lanczos three-term recurrence and Givens rotations,
+ *  so the memory and the cost per iteration do not grow with the iterations.
+ */
+class MINRES : public SOL
+{
+private:
+    int len;  ///< dimension of the solution vector
+    VEC r1;   ///< Work vector for the previous Lanczos residual
+    VEC r2;   ///< Work vector for the current Lanczos residual
+    VEC yk;   ///< Work vector for the preconditioned residual
+    VEC vk;   ///< Work vector for the Lanczos vector
+    VEC w1;   ///< Work vector for the search direction of step k-2
+    VEC w2;   ///< Work vector for the search direction of step k-1
+    VEC safe; ///< Work vector for safe-guard
+
+public:
+    /// Default constructor.
+    MINRES()
+        : len(0)
+        , r1(0)
+        , r2(0)
+        , yk(0)
+        , vk(0)
+        , w1(0)
+        , w2(0)
+        , safe(0){};
+
+    /// Default destructor.
+    ~MINRES() = default;
+
+    /// Setup the MINRES method.
+    FaspRetCode Setup(const LOP& A) override;
+
+    /// Solve Ax=b using the MINRES method.
+    FaspRetCode Solve(const VEC& b, VEC& x) override;
+
+    /// Clean up MINRES data allocated during Setup.
+    void Clean() override;
+};
+
+#endif /* end if for __MINRES_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
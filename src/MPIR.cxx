@@ -0,0 +1,158 @@
+/*! \file    MPIR.cxx
+ *  \brief   Mixed-precision iterative refinement class definition
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// FASPXX header files
+#include "Krylov.hxx"
+#include "MPIR.hxx"
+
+/// Set the inner Krylov method and its relative tolerance, before Setup.
+void MPIR::SetInnerSolver(const SOLType type, const double relTol)
+{
+    this->innerType = type;
+    this->innerTol  = relTol;
+}
+
+/// Get number of refinement steps of the last solve.
+USI MPIR::GetNumRefine() const { return numRefine; }
+
+/// Make the single precision copy of A, create and setup the inner method.
+FaspRetCode MPIR::Setup(const LOP& A)
+{
+    // Set solver type
+    SetSolType(SOLType::SOLVER_MPIR);
+
+    const MAT* mat = dynamic_cast<const MAT*>(&A);
+    if (mat == nullptr) return FaspRetCode::ERROR_INPUT_PAR;
+
+    // Allocate memory for temporary vectors and the copy of A
+    try {
+        len = A.GetColSize();
+        rk.SetValues(len, 0.0);
+        dk.SetValues(len, 0.0);
+        safe.SetValues(len, 0.0);
+        inner = CreateKrylov(innerType);
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+    if (inner == nullptr) return FaspRetCode::ERROR_SOLVER_TYPE;
+
+    FaspRetCode retCode = fA.SetValues(*mat);
+    if (retCode < 0) return retCode;
+
+    // Setup the inner method on the single precision copy
+    inner->SetOutput(PRINT_NONE);
+    inner->SetMaxIter(params.maxIter); // GMRES sizes its basis with it
+    inner->SetRestart(params.restart);
+    inner->SetRelTol(innerTol);
+    inner->SetAbsTol(params.absTol);
+    retCode = inner->Setup(fA);
+    if (retCode < 0) return retCode;
+
+    // Setup the coefficient matrix
+    this->A = &A;
+
+    // Print used parameters
+    if (params.verbose > PRINT_MIN) PrintParam(std::cout);
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Clean up work data allocated during Setup.
+void MPIR::Clean()
+{
+    rk.SetValues(len, 0.0);
+    dk.SetValues(len, 0.0);
+    safe.SetValues(len, 0.0);
+    if (inner != nullptr) inner->Clean();
+}
+
+/// Mixed-precision iterative refinement. Don't check problem sizes.
+FaspRetCode MPIR::Solve(const VEC& b, VEC& x)
+{
+    FaspRetCode errorCode = FaspRetCode::SUCCESS;
+
+    // Local variables
+    double resAbs = 1.0, resRel = 1.0, denAbs = 1.0, ratio = 0.0, resAbsOld = 1.0;
+    bool   converged = false;
+
+    PrintHead();
+
+    // Initialize iterative method
+    numIter   = 0;
+    numRefine = 0;
+    inner->SetupPCD(*pcd);
+    A->Apply(x, rk);  // A * x -> rk
+    rk.XPAY(-1.0, b); // b - rk -> rk
+    resAbs = rk.Norm2();
+    denAbs = (CLOSE_ZERO > resAbs) ? CLOSE_ZERO : resAbs;
+    resRel = resAbs / denAbs;
+
+    // Main refinement loop
+    while (numIter < params.maxIter) {
+
+        converged = (resRel < params.relTol || resAbs < params.absTol) &&
+                    numIter >= params.minIter;
+        if (converged) break;
+
+        PrintInfo(numIter, resRel, resAbs, ratio);
+
+        // Correction from the single precision system; reaching maxIter is fine
+        inner->SetMaxIter(params.maxIter - numIter);
+        dk.SetValues(len, 0.0);
+        inner->Solve(rk, dk);
+        numIter += (inner->GetIterations() > 0) ? inner->GetIterations() : 1;
+        ++numRefine;
+
+        // Update x and the residual in double precision
+        safe = x;
+        x.AXPY(1.0, dk);
+        A->Apply(x, rk);
+        rk.XPAY(-1.0, b);
+
+        resAbsOld = resAbs;
+        resAbs    = rk.Norm2();
+        resRel    = resAbs / denAbs;
+        ratio     = resAbs / resAbsOld;
+
+        // Refinement does not converge; go back to the previous iterate
+        if (ratio >= 1.0) {
+            if (params.verbose > PRINT_MIN)
+                FASPXX_WARNING("Iteration stopped due to stagnation!");
+            x = safe;
+            A->Apply(x, rk);
+            rk.XPAY(-1.0, b);
+            resAbs    = resAbsOld;
+            resRel    = resAbs / denAbs;
+            errorCode = FaspRetCode::ERROR_SOLVER_STAG;
+            break;
+        }
+
+    } // End of main refinement loop
+
+    if (errorCode == FaspRetCode::SUCCESS && !converged) {
+        converged = (resRel < params.relTol || resAbs < params.absTol);
+        if (!converged) errorCode = FaspRetCode::ERROR_SOLVER_MAXIT;
+    }
+
+    this->norm2   = resAbs;
+    this->normInf = rk.NormInf();
+    PrintFinal(numIter, resRel, resAbs, ratio);
+
+    return errorCode;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,98 @@
+/*! \file    MPIR.hxx
+ *  \brief   Mixed-precision iterative refinement class declaration
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+/*! Important Note:
+ *-----------------------------------------------------------------------------------
+ *  Iterative refinement computes the residual r = b - Ax with the original MAT in
+ *  double precision, solves A d = r approximately with a Krylov method applied to
+ *  a FloatMAT copy of A, and updates x = x + d. Each refinement step reduces the
+ *  error by about max(innerTol, cond(A) * 6e-8), so a well-conditioned system
+ *  reaches full double precision accuracy in a few steps, while the expensive
+ *  inner iterations read the matrix entries in single precision.
+ *
+ *  Any method of CreateKrylov can be used inside, with the preconditioner given by
+ *  SetupPCD. The iteration number counts the inner iterations of all steps and
+ *  is bounded by maxIter; the number of refinement steps is reported separately.
+ *  If a step fails to reduce the residual, the previous iterate is returned with
+ *  ERROR_SOLVER_STAG: the system is too ill-conditioned for a float copy.
+ *
+ *  MPIR is not a Krylov method itself, so CreateKrylov and KrylovSolver do not
+ *  build it; it has to be created directly.
+ */
+
+#ifndef __MPIR_HEADER__ /*-- allow multiple inclusions --*/
+#define __MPIR_HEADER__ /**< indicate MPIR.hxx has been included before */
+
+// Standard header files
+#include <memory>
+
+// FASPXX header files
+#include "ErrorLog.hxx"
+#include "FloatMAT.hxx"
+#include "LOP.hxx"
+#include "SOL.hxx"
+
+/*! \class MPIR
+ *  \brief Iterative refinement with inner Krylov solves in single precision.
+ */
+class MPIR : public SOL
+{
+private:
+    USI                  len;       ///< dimension of the solution vector
+    SOLType              innerType; ///< Krylov method of the inner solves
+    double               innerTol;  ///< relative tolerance of the inner solves
+    USI                  numRefine; ///< number of refinement steps of the last solve
+    FloatMAT             fA;        ///< single precision copy of A
+    std::unique_ptr<SOL> inner;     ///< Krylov method for the correction
+    VEC                  rk;        ///< Work vector for residual
+    VEC                  dk;        ///< Work vector for correction
+    VEC                  safe;      ///< Work vector for safe-guard
+
+public:
+    /// Default constructor.
+    MPIR()
+        : len(0)
+        , innerType(SOLType::SOLVER_GMRES)
+        , innerTol(1e-4)
+        , numRefine(0)
+        , rk(0)
+        , dk(0)
+        , safe(0){};
+
+    /// Default destructor.
+    ~MPIR() = default;
+
+    /// Set the inner Krylov method and its relative tolerance, before Setup.
+    void SetInnerSolver(SOLType type, double relTol);
+
+    /// Get number of refinement steps of the last solve.
+    USI GetNumRefine() const;
+
+    /// Setup the single precision copy and the inner method; A has to be a MAT.
+    FaspRetCode Setup(const LOP& A) override;
+
+    /// Solve Ax=b by mixed-precision iterative refinement.
+    FaspRetCode Solve(const VEC& b, VEC& x) override;
+
+    /// Clean up work data allocated during Setup.
+    void Clean() override;
+};
+
+#endif /* end if for __MPIR_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Note that MPIR is created directly   */
+/*----------------------------------------------------------------------------*/
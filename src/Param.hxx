@@ -34,23 +34,32 @@ enum Output {
 
 /// Solver types avaiable.
 enum SOLType {
-    SOLVER_CG       = 1,  ///< Conjugate Gradient
-    SOLVER_BICGSTAB = 2,  ///< Bi-Conjugate Gradient Stabilized
-    SOLVER_MINRES   = 3,  ///< Minimal Residual
-    SOLVER_GMRES    = 4,  ///< Generalized Minimal Residual
-    SOLVER_FGMRES   = 5,  ///< Flexible GMRES
-    SOLVER_VFGMRES  = 6,  ///< Variable-restarting FGMRES
-    SOLVER_JACOBI   = 11, ///< Jacobi method
-    SOLVER_GS       = 12, ///< Gauss-Seidel method
-    SOLVER_SGS      = 13, ///< Symmetrized Gauss-Seidel method
-    SOLVER_SOR      = 14, ///< Successive over-relaxation method
-    SOLVER_SSOR     = 15, ///< Symmetrized successive over-relaxation method
-    SOLVER_MG       = 21, ///< Multigrid method
-    SOLVER_FMG      = 22, ///< Full multigrid method
-    SOLVER_UMFPACK  = 91, ///< Direct method from UMFPACK
-    SOLVER_MUMPS    = 92, ///< Direct method from MUMPS
-    SOLVER_SUPERLU  = 93, ///< Direct method from SUPERLU
-    SOLVER_PARDISO  = 94  ///< Direct method from PARDISO
+    SOLVER_CG        = 1,  ///< Conjugate Gradient
+    SOLVER_BICGSTAB  = 2,  ///< Bi-Conjugate Gradient Stabilized
+    SOLVER_MINRES    = 3,  ///< Minimal Residual
+    SOLVER_GMRES     = 4,  ///< Generalized Minimal Residual
+    SOLVER_FGMRES    = 5,  ///< Flexible GMRES
+    SOLVER_VFGMRES   = 6,  ///< Variable-restarting FGMRES
+    SOLVER_GMRESDR   = 7,  ///< GMRES with deflated restarting
+    SOLVER_GCRODR    = 8,  ///< GCRO with deflated restarting and recycling
+    SOLVER_DCG       = 9,  ///< Deflated CG with recycling
+    SOLVER_JACOBI    = 11, ///< Jacobi method
+    SOLVER_GS        = 12, ///< Gauss-Seidel method
+    SOLVER_SGS       = 13, ///< Symmetrized Gauss-Seidel method
+    SOLVER_SOR       = 14, ///< Successive over-relaxation method
+    SOLVER_SSOR      = 15, ///< Symmetrized successive over-relaxation method
+    SOLVER_MG        = 21, ///< Multigrid method
+    SOLVER_FMG       = 22, ///< Full multigrid method
+    SOLVER_IDRS      = 31, ///< Induced dimension reduction IDR(s)
+    SOLVER_BICGSTABL = 32, ///< BiCGStab with l-degree minimal residual polynomial
+    SOLVER_IBICGSTAB = 33, ///< BiCGStab with fused kernels and fewer reductions
+    SOLVER_MPIR      = 41, ///< Mixed-precision iterative refinement
+    SOLVER_DENSELU   = 81, ///< Built-in dense LU direct method
+    SOLVER_LDLT      = 82, ///< Built-in supernodal sparse LDL^T direct method
+    SOLVER_UMFPACK   = 91, ///< Direct method from UMFPACK
+    SOLVER_MUMPS     = 92, ///< Direct method from MUMPS
+    SOLVER_SUPERLU   = 93, ///< Direct method from SUPERLU
+    SOLVER_PARDISO   = 94  ///< Direct method from PARDISO
 };
 
 /// Iterative solver parameters.
@@ -231,4 +240,11 @@ public:
 /*----------------------------------------------------------------------------*/
 /*  Kailei Zhang        Nov/25/2019      Create file                          */
 /*  Chensong Zhang      Sep/26/2021      Restructure file                     */
+/*  Chensong Zhang      Oct/19/2026      Add dense LU solver type             */
+/*  Chensong Zhang      Oct/19/2026      Add sparse LDL^T solver type         */
+/*  Chensong Zhang      Oct/19/2026      Add GMRES-DR and GCRO-DR             */
+/*  Chensong Zhang      Oct/19/2026      Add deflated CG                      */
+/*  Chensong Zhang      Oct/19/2026      Add IDR(s) and BiCGStab(l)           */
+/*  Chensong Zhang      Oct/19/2026      Add improved BiCGStab                */
+/*  Chensong Zhang      Oct/19/2026      Add mixed-precision refinement       */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -10,84 +10,250 @@
  */
 
 // Standard header files
+#include <algorithm>
+#include <charconv>
 #include <cstring>
 #include <fstream>
+#include <string>
+#include <utility>
+
+#ifdef _MSC_VER
+#include <vector>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 // FASPXX header files
+#include "BinData.hxx"
+#include "Compress.hxx"
 #include "MATUtil.hxx"
 #include "ReadData.hxx"
 
-/// Read a VEC data file stored as val[i], i=0:end-1.
-FaspRetCode ReadVEC(const char* fileName, VEC& dst)
-{
-    FaspRetCode retCode = FaspRetCode::SUCCESS;
+/// Minimal number of bytes given to one parsing chunk.
+static const size_t MIN_CHUNK_SIZE = 1 << 20;
 
-    std::cout << "Reading from disk file " << fileName << std::endl;
-    std::ifstream in(fileName);
-    if (!in.is_open()) { // check whether file is opened successfully
-        retCode = FaspRetCode::ERROR_OPEN_FILE;
-        return retCode;
-    }
+/// A read-only view of a whole file, memory-mapped whenever possible.
+struct FileView {
+    const char*       data = nullptr; ///< beginning of the file content
+    size_t            size = 0;       ///< number of bytes of the file
+    void*             map  = nullptr; ///< address returned by mmap
+    std::vector<char> copy;           ///< file content if mmap is not available
+};
+
+/// Release the file view.
+static void CloseFileView(FileView& file)
+{
+#ifndef _MSC_VER
+    if (file.map != nullptr) munmap(file.map, file.size);
+#endif
+    file.map  = nullptr;
+    file.data = nullptr;
+    file.size = 0;
+    std::vector<char>().swap(file.copy);
+}
 
-    // Compute total number of bytes of file
+/// Map a file into memory; fall back to reading it when mmap is not available.
+static FaspRetCode OpenFileView(const char* fileName, FileView& file)
+{
+#ifdef _MSC_VER
+    std::ifstream in(fileName, std::ios::binary);
+    if (!in.is_open()) return FaspRetCode::ERROR_OPEN_FILE;
     in.seekg(0, std::ios::end);
-    const long long int length = in.tellg();
+    file.size = in.tellg();
     in.seekg(0, std::ios::beg);
+    try {
+        file.copy.resize(file.size);
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+    in.read(file.copy.data(), file.size);
+    file.data = file.copy.data();
+#else
+    const int fd = open(fileName, O_RDONLY);
+    if (fd < 0) return FaspRetCode::ERROR_OPEN_FILE;
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return FaspRetCode::ERROR_OPEN_FILE;
+    }
+    file.size = st.st_size;
+    if (file.size == 0) {
+        close(fd);
+        return FaspRetCode::ERROR_INPUT_FILE;
+    }
+    file.map = mmap(nullptr, file.size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // the mapping stays valid after closing the descriptor
+    if (file.map == MAP_FAILED) {
+        file.map = nullptr;
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+    madvise(file.map, file.size, MADV_SEQUENTIAL);
+    file.data = static_cast<const char*>(file.map);
+#endif
+
+    // Inflate compressed files written by WriteData
+    if (LZIsCompressed(file.data, file.size)) {
+        std::vector<char> text;
+        const FaspRetCode retCode = LZDecompress(file.data, file.size, text);
+        CloseFileView(file);
+        if (retCode < 0) return retCode;
+        file.copy.swap(text);
+        file.data = file.copy.data();
+        file.size = file.copy.size();
+        if (file.size == 0) return FaspRetCode::ERROR_INPUT_FILE;
+    }
+    return FaspRetCode::SUCCESS;
+}
 
-    char          decimal[128]; // temporary storage for data
-    long long int position = 0; // mark the position of file pointer
-    long int      count    = 0, len;
+/// Beginning of the next line after p.
+static const char* NextLine(const char* p, const char* end)
+{
+    const char* q = static_cast<const char*>(std::memchr(p, '\n', end - p));
+    return (q == nullptr) ? end : q + 1;
+}
 
-    char *buffer, *next;
-    try {                          // catch bad allocation error if it happens
-        buffer = new char[length]; // allocate memory for buffer
-    } catch (std::bad_alloc& ex) {
-        in.close();
-        retCode = FaspRetCode::ERROR_ALLOC_MEM;
-        return retCode;
+/// Check whether [p, end) contains only white spaces.
+static bool IsBlank(const char* p, const char* end)
+{
+    for (; p < end; ++p)
+        if (*p != ' ' && *p != '\t' && *p != '\r' && *p != '\n') return false;
+    return true;
+}
+
+/// Parse a number starting at p (leading spaces allowed) and move p behind it.
+template <typename T>
+static bool ParseNumber(const char*& p, const char* end, T& val)
+{
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) ++p;
+    if (p < end && *p == '+') ++p;
+    const auto res = std::from_chars(p, end, val);
+    if (res.ec != std::errc()) return false;
+    p = res.ptr;
+    return true;
+}
+
+/// Split [begin, end) into chunks starting at line boundaries.
+static void SplitChunks(const char* begin, const char* end,
+                        std::vector<const char*>& chunks)
+{
+#ifdef _OPENMP
+    const size_t numThreads = omp_get_max_threads();
+#else
+    const size_t numThreads = 1;
+#endif
+    const size_t length    = end - begin;
+    const size_t numChunks = std::max<size_t>(
+        1, std::min(4 * numThreads, length / MIN_CHUNK_SIZE));
+
+    chunks.assign(1, begin);
+    for (size_t c = 1; c < numChunks; ++c) {
+        const char* p = std::max(begin + c * (length / numChunks), chunks.back());
+        p             = (p == begin) ? begin : NextLine(p - 1, end);
+        if (p > chunks.back() && p < end) chunks.push_back(p);
     }
-    in.read(buffer, length); // read the total bytes of file
-    in.close();              // close the file pointer
+    chunks.push_back(end);
+}
 
-    // Read in the size of VEC object
-    while (true) {
-        if (buffer[position] != '\n') {
-            decimal[count] = buffer[position];
-            ++position;
-            ++count;
-        } else {
-            decimal[count] = '\0';
-            count          = 0;
-            ++position;
-            len = std::strtol(decimal, &next, 10);
-            break;
+/// Count nonempty lines of each chunk; first[c] is the global index of chunk c.
+static void CountLines(const std::vector<const char*>& chunks,
+                       std::vector<size_t>&            first)
+{
+    const INT numChunks = chunks.size() - 1;
+    first.assign(numChunks + 1, 0);
+
+    INT c;
+#pragma omp parallel for private(c) schedule(dynamic)
+    for (c = 0; c < numChunks; ++c) {
+        size_t count = 0;
+        for (const char* p = chunks[c]; p < chunks[c + 1];) {
+            const char* q = NextLine(p, chunks[c + 1]);
+            if (!IsBlank(p, q)) ++count;
+            p = q;
         }
+        first[c + 1] = count;
     }
 
-    // Allocate memory space and initialize
-    dst.SetValues(len, 0.0);
-
-    // Read in the VEC object's entries
-    long int locate = 0; // mark the element position
-    while (true) {
-        if (buffer[position] != '\n') {
-            decimal[count] = buffer[position];
-            ++position;
-            ++count;
-        } else {
-            decimal[count] = '\0';
-            count          = 0;
-            ++position;
-            dst[locate] = std::strtod(decimal, &next);
-            ++locate;
+    for (c = 0; c < numChunks; ++c) first[c + 1] += first[c]; // prefix sum
+}
+
+/// Call parse(index, lineBegin, lineEnd) for every nonempty line in parallel.
+template <typename Func>
+static bool ParseLines(const std::vector<const char*>& chunks,
+                       const std::vector<size_t>& first, Func parse)
+{
+    const INT numChunks = chunks.size() - 1;
+    bool      status    = true;
+
+    INT c;
+#pragma omp parallel for private(c) schedule(dynamic)
+    for (c = 0; c < numChunks; ++c) {
+        size_t index = first[c];
+        bool   ok    = true;
+        for (const char* p = chunks[c]; p < chunks[c + 1] && ok;) {
+            const char* q = NextLine(p, chunks[c + 1]);
+            if (!IsBlank(p, q)) ok = parse(index++, p, q);
+            p = q;
+        }
+        if (!ok) {
+#pragma omp critical
+            status = false;
         }
-        if (buffer[position] == '\0') break;
     }
 
-    if (locate != len) retCode = FaspRetCode::ERROR_INPUT_FILE;
+    return status;
+}
+
+/// Read a VEC data file stored as val[i], i=0:end-1.
+FaspRetCode ReadVEC(const char* fileName, VEC& dst)
+{
+    FaspRetCode retCode = FaspRetCode::SUCCESS;
+
+    std::cout << "Reading from disk file " << fileName << std::endl;
+    FileView file;
+    retCode = OpenFileView(fileName, file);
+    if (retCode < 0) return retCode;
+
+    const char* const end = file.data + file.size;
+    const char*       pos = file.data;
+
+    // Read in the size of VEC object
+    long long len = 0;
+    if (!ParseNumber(pos, end, len) || len < 0) {
+        CloseFileView(file);
+        return FaspRetCode::ERROR_INPUT_FILE;
+    }
+    pos = NextLine(pos, end);
 
-    delete[] buffer; // clean up memory space
+    // Allocate memory space and initialize
+    try {
+        dst.SetValues(len, 0.0);
+    } catch (std::bad_alloc& ex) {
+        CloseFileView(file);
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
 
+    // Read in the VEC object's entries in parallel
+    std::vector<const char*> chunks;
+    std::vector<size_t>      first;
+    SplitChunks(pos, end, chunks);
+    CountLines(chunks, first);
+    if (first.back() != (size_t)len) retCode = FaspRetCode::ERROR_INPUT_FILE;
+
+    DBL* val;
+    dst.GetArray(&val);
+    const bool ok = ParseLines(chunks, first, [&](size_t i, const char* p, const char* q) {
+        return i < (size_t)len && ParseNumber(p, q, val[i]);
+    });
+    if (!ok) retCode = FaspRetCode::ERROR_INPUT_FILE;
+
+    CloseFileView(file);
     return retCode;
 }
 
@@ -100,73 +266,24 @@ FaspRetCode ReadMTX(const char* fileName, USI& row, USI& col, USI& nnz,
 
     // Open the file to read
     std::cout << "Reading from disk file " << fileName << std::endl;
-    std::ifstream in(fileName);
-    if (!in.is_open()) { // check whether file is opened successfully
-        retCode = FaspRetCode::ERROR_OPEN_FILE;
-        return retCode;
-    }
-
-    // Read the file in to a buffer
-    in.seekg(0, std::ios::end);
-    const long long int length = in.tellg();
-    in.seekg(0, std::ios::beg);
-
-    char          decimal[128];
-    char *        buffer, *next;
-    long long int position = 0; // position of file pointer
-
-    // Allocate temp space for storing the whole file
-    try { // catch bad allocation if it happens
-        buffer = new char[length];
-    } catch (std::bad_alloc& ex) {
-        in.close();
-        retCode = FaspRetCode::ERROR_ALLOC_MEM;
-        return retCode;
-    }
-    in.read(buffer, length); // read the whole file in bytes
-    in.close();              // close the file stream
-
-    while (true) { // skip the comment in the begining
-        if (buffer[position] == '%' || buffer[position] == '\0') {
-            while (true) {
-                ++position;
-                if (buffer[position] == '\n' || buffer[position] == '\0') {
-                    ++position;
-                    break;
-                }
-            }
-        } else
-            break;
-    }
-
-    int count = 0; // number of bytes in the decimal
-    int mark  = 0; // which number of integer is reading
-    while (true) { // read matrix 's row, column, nnz
-        if (buffer[position] != ' ' && buffer[position] != '\n') {
-            decimal[count] = buffer[position];
-            ++count;
-            ++position;
-        } else {
-            decimal[count] = '\0';
-            count          = 0;
-            ++mark;
-            ++position;
-            switch (mark) {
-                case 1: // first, integer, number of rows
-                    row = std::strtol(decimal, &next, 10);
-                    break;
-                case 2: // second, integer, number of columns
-                    col = std::strtol(decimal, &next, 10);
-                    break;
-                case 3: // third, integer, number of nonzeros
-                    nnz = std::strtol(decimal, &next, 10);
-                    break;
-                default:
-                    FASPXX_WARNING("Unknown input value!");
-            }
-        }
-        if (mark == 3) break; // skip the rest
+    FileView file;
+    retCode = OpenFileView(fileName, file);
+    if (retCode < 0) return retCode;
+
+    const char* const end = file.data + file.size;
+    const char*       pos = file.data;
+
+    // Skip the comments and empty lines in the beginning
+    while (pos < end && (*pos == '%' || IsBlank(pos, NextLine(pos, end))))
+        pos = NextLine(pos, end);
+
+    // Read matrix's row, column, nnz
+    if (!ParseNumber(pos, end, row) || !ParseNumber(pos, end, col) ||
+        !ParseNumber(pos, end, nnz)) {
+        CloseFileView(file);
+        return FaspRetCode::ERROR_INPUT_FILE;
     }
+    pos = NextLine(pos, end);
 
     // Allocate memory space to store row indices, column indices and values
     try { // catch the bad allocation if it happens
@@ -174,46 +291,28 @@ FaspRetCode ReadMTX(const char* fileName, USI& row, USI& col, USI& nnz,
         colInd.resize(nnz);
         values.resize(nnz);
     } catch (std::bad_alloc& ex) {
-        delete[] buffer; // if bad allocation happens, free up the memory space
-        retCode = FaspRetCode::ERROR_ALLOC_MEM;
-        return retCode;
+        CloseFileView(file);
+        return FaspRetCode::ERROR_ALLOC_MEM;
     }
 
-    // Put MTX data into rowInd, colInd, and values
-    USI      locate = 0; // mark the position in rowInd, colInd and values
-    long int tmp    = 0;
-    while (true) {
-        if (buffer[position] != ' ' && buffer[position] != '\n' &&
-            buffer[position] != '\0') {
-            decimal[count] = buffer[position];
-            ++count;
-            ++position;
-        } else {
-            ++position;
-            if (buffer[position] == ' ') continue; // multiple consecutive spaces
-            decimal[count] = '\0';                 // mark the end of 'decimal' string
-            count          = 0;
-            ++tmp;
-            locate = tmp / 3;
-            switch (tmp % 3) {
-                case 1: // first: integer, row index
-                    rowInd[locate] = std::strtol(decimal, &next, 10) - 1;
-                    break;
-                case 2: // second: integer, column index
-                    colInd[locate] = std::strtol(decimal, &next, 10) - 1;
-                    break;
-                case 0: // third: double, value
-                    values[locate - 1] = std::strtod(decimal, &next);
-                    break;
-            }
-            if (buffer[position] == '\0') break;
-        }
-    }
-
-    if (locate != nnz) retCode = FaspRetCode::ERROR_INPUT_FILE;
-
-    delete[] buffer; // clean up memory space
-
+    // Put MTX data into rowInd, colInd, and values; one entry per line
+    std::vector<const char*> chunks;
+    std::vector<size_t>      first;
+    SplitChunks(pos, end, chunks);
+    CountLines(chunks, first);
+    if (first.back() != nnz) retCode = FaspRetCode::ERROR_INPUT_FILE;
+
+    const bool ok = ParseLines(chunks, first, [&](size_t k, const char* p, const char* q) {
+        if (k >= nnz) return false;
+        USI i, j;
+        if (!ParseNumber(p, q, i) || !ParseNumber(p, q, j)) return false;
+        rowInd[k] = i - 1;
+        colInd[k] = j - 1;
+        return ParseNumber(p, q, values[k]);
+    });
+    if (!ok) retCode = FaspRetCode::ERROR_INPUT_FILE;
+
+    CloseFileView(file);
     return retCode;
 }
 
@@ -226,133 +325,237 @@ FaspRetCode ReadCSR(const char* fileName, USI& row, USI& col, USI& nnz,
 
     // Open the file to read
     std::cout << "Reading from disk file " << fileName << std::endl;
-    std::ifstream in(fileName);
-    if (!in.is_open()) { // judge whether file is opened successfully
-        std::cout << "Reading from disk file " << fileName << std::endl;
-        retCode = FaspRetCode::ERROR_OPEN_FILE;
-        return retCode;
-    }
+    FileView file;
+    retCode = OpenFileView(fileName, file);
+    if (retCode < 0) return retCode;
 
-    // Read the file in to a buffer
-    in.seekg(0, std::ios::end);
-    long long int length = in.tellg(); // compute total bytes 's number
-    in.seekg(0, std::ios::beg);
+    const char* const end = file.data + file.size;
+    const char*       pos = file.data;
 
-    char  decimal[128];
-    char *buffer, *next;
+    // Read number of rows
+    long long numRow = 0;
+    if (!ParseNumber(pos, end, numRow) || numRow <= 0) {
+        CloseFileView(file);
+        return FaspRetCode::ERROR_INPUT_PAR;
+    }
+    pos = NextLine(pos, end);
+    row = col = numRow;
+
+    // The rest are row+1 row pointers, nnz column indices and nnz values
+    std::vector<const char*> chunks;
+    std::vector<size_t>      first;
+    SplitChunks(pos, end, chunks);
+    CountLines(chunks, first);
+    const size_t numLine = first.back();
+    if (numLine < row + 1 || (numLine - row - 1) % 2 != 0) {
+        CloseFileView(file);
+        return FaspRetCode::ERROR_INPUT_FILE;
+    }
+    nnz = (numLine - row - 1) / 2;
 
-    // Allocate memory space for storing the whole file
-    try { // catch the bad allocation if it happens
-        buffer = new char[length];
+    // Allocate memory for rowPtr, colInd and values
+    try { // catch bad allocation if it happens
+        rowPtr.resize(row + 1);
+        colInd.resize(nnz);
+        values.resize(nnz);
     } catch (std::bad_alloc& ex) {
-        in.close();
-        retCode = FaspRetCode::ERROR_ALLOC_MEM;
-        return retCode;
+        CloseFileView(file);
+        return FaspRetCode::ERROR_ALLOC_MEM;
     }
-    in.read(buffer, length); // read the whole file in bytes
-    in.close();              // close the file stream
 
-    // Read number of rows
-    USI           count    = 0;
-    long long int position = 0; // mark the position of file pointer
-    while (true) {
-        if (buffer[position] != '\n') {
-            decimal[count] = buffer[position];
-            ++count;
-            ++position;
-        } else {
-            decimal[count] = '\0'; // mark the end of 'decimal' string
-            ++position;
-            break;
+    // Each line goes to the array given by its global index
+    const size_t colStart = row + 1, valStart = colStart + nnz;
+    const bool   ok = ParseLines(chunks, first, [&](size_t k, const char* p, const char* q) {
+        if (k < colStart) return ParseNumber(p, q, rowPtr[k]);
+        if (k < valStart) return ParseNumber(p, q, colInd[k - colStart]);
+        return ParseNumber(p, q, values[k - valStart]);
+    });
+    if (!ok || rowPtr[row] - rowPtr[0] != nnz) retCode = FaspRetCode::ERROR_INPUT_FILE;
+
+    // If the indices start from 1, we shift them to start from 0
+    if (rowPtr[0] == 1) {
+        INT k;
+#pragma omp parallel for private(k)
+        for (k = 0; k <= (INT)row; ++k) rowPtr[k]--;
+#pragma omp parallel for private(k)
+        for (k = 0; k < (INT)nnz; ++k) colInd[k]--;
+    }
+
+    CloseFileView(file);
+    return retCode;
+}
+
+/// Read an MTX file and convert it to MAT directly, without the triplet arrays.
+FaspRetCode ReadMTXtoMAT(const char* fileName, MAT& dst)
+{
+    FaspRetCode retCode = FaspRetCode::SUCCESS;
+
+    // Open the file to read
+    std::cout << "Reading from disk file " << fileName << std::endl;
+    FileView file;
+    retCode = OpenFileView(fileName, file);
+    if (retCode < 0) return retCode;
+
+    const char* const end = file.data + file.size;
+    const char*       pos = file.data;
+
+    // Check the banner for symmetric storage and pattern-only matrices
+    bool symmetric = false, skew = false, pattern = false;
+    if (file.size > 14 && std::strncmp(pos, "%%MatrixMarket", 14) == 0) {
+        std::string banner(pos, NextLine(pos, end));
+        std::transform(banner.begin(), banner.end(), banner.begin(), ::tolower);
+        if (banner.find("complex") != std::string::npos ||
+            banner.find("hermitian") != std::string::npos ||
+            banner.find("array") != std::string::npos) {
+            CloseFileView(file);
+            return FaspRetCode::ERROR_INPUT_FILE; // only real coordinate format
         }
+        skew      = banner.find("skew-symmetric") != std::string::npos;
+        symmetric = skew || banner.find("symmetric") != std::string::npos;
+        pattern   = banner.find("pattern") != std::string::npos;
     }
 
-    row = std::strtol(decimal, &next, 10);
-    if (row <= 0) { // prevent memory leaks if error happens
-        retCode = FaspRetCode::ERROR_INPUT_PAR;
-        delete[] buffer;
-        return retCode;
+    // Skip the comments and empty lines in the beginning
+    while (pos < end && (*pos == '%' || IsBlank(pos, NextLine(pos, end))))
+        pos = NextLine(pos, end);
+
+    // Read matrix's row, column, nnz
+    USI row, col, nnz;
+    if (!ParseNumber(pos, end, row) || !ParseNumber(pos, end, col) ||
+        !ParseNumber(pos, end, nnz) || row == 0 || col == 0) {
+        CloseFileView(file);
+        return FaspRetCode::ERROR_INPUT_FILE;
+    }
+    pos = NextLine(pos, end);
+
+    std::vector<const char*> chunks;
+    std::vector<size_t>      first;
+    SplitChunks(pos, end, chunks);
+    CountLines(chunks, first);
+    if (first.back() != nnz) {
+        CloseFileView(file);
+        return FaspRetCode::ERROR_INPUT_FILE;
     }
-    col = row;
 
-    // Read row pointers
-    try { // catch bad allocation if it happens
-        rowPtr.resize(row + 1);
+    // Parse one entry; the value of a pattern matrix is one
+    auto parseEntry = [&](const char* p, const char* q, USI& i, USI& j, DBL& v) {
+        if (!ParseNumber(p, q, i) || !ParseNumber(p, q, j)) return false;
+        if (i == 0 || i > row || j == 0 || j > col) return false;
+        --i, --j;
+        v = 1.0;
+        return pattern || ParseNumber(p, q, v);
+    };
+
+    // Pass 1: count entries of each row, with one more spot for the diagonal
+    std::vector<USI> rowPtr, cursor;
+    try {
+        rowPtr.assign(row + 1, 0);
     } catch (std::bad_alloc& ex) {
-        retCode = FaspRetCode::ERROR_ALLOC_MEM;
-        return retCode;
+        CloseFileView(file);
+        return FaspRetCode::ERROR_ALLOC_MEM;
     }
-
-    // Read the rowPtr of CSRx matrix
-    USI locate = 0;
-    count      = 0;
-    while (true) {
-        if (buffer[position] != '\n') {
-            decimal[count] = buffer[position];
-            ++count;
-            ++position;
-        } else {
-            ++position;
-            decimal[count] = '\0';
-            count          = 0;
-            rowPtr[locate] = std::strtol(decimal, &next, 10);
-            ++locate;
-            if (locate == row + 1) break;
+    bool ok = ParseLines(chunks, first, [&](size_t, const char* p, const char* q) {
+        USI i, j;
+        DBL v;
+        if (!parseEntry(p, q, i, j, v)) return false;
+#pragma omp atomic
+        ++rowPtr[i + 1];
+        if (symmetric && i != j) {
+#pragma omp atomic
+            ++rowPtr[j + 1];
         }
+        return true;
+    });
+    if (!ok) {
+        CloseFileView(file);
+        return FaspRetCode::ERROR_INPUT_FILE;
     }
+    for (USI i = 0; i < row; ++i) rowPtr[i + 1] += rowPtr[i] + (i < col ? 1 : 0);
 
-    // Allocate memory for colInd and values
-    try { // catch bad allocation if it happens
-        nnz = rowPtr[row] - rowPtr[0];
-        colInd.resize(nnz);
-        values.resize(nnz);
+    // Pass 2: scatter entries directly into the final arrays
+    std::vector<USI> colInd, diagPtr;
+    std::vector<DBL> values;
+    try {
+        cursor.assign(rowPtr.begin(), rowPtr.end() - 1);
+        colInd.resize(rowPtr[row]);
+        values.resize(rowPtr[row]);
     } catch (std::bad_alloc& ex) {
-        retCode = FaspRetCode::ERROR_ALLOC_MEM;
-        return retCode;
+        CloseFileView(file);
+        return FaspRetCode::ERROR_ALLOC_MEM;
     }
-
-    // Read column indices
-    locate = 0;
-    while (true) {
-        if (buffer[position] != '\n') {
-            decimal[count] = buffer[position];
-            ++count;
-            ++position;
-        } else {
-            ++position;
-            decimal[count] = '\0';
-            count          = 0;
-            colInd[locate] = std::strtol(decimal, &next, 10);
-            ++locate;
-            if (locate == nnz) break;
+    ok = ParseLines(chunks, first, [&](size_t, const char* p, const char* q) {
+        USI i, j, k;
+        DBL v;
+        if (!parseEntry(p, q, i, j, v)) return false;
+#pragma omp atomic capture
+        k = cursor[i]++;
+        colInd[k] = j;
+        values[k] = v;
+        if (symmetric && i != j) {
+#pragma omp atomic capture
+            k = cursor[j]++;
+            colInd[k] = i;
+            values[k] = skew ? -v : v;
         }
+        return true;
+    });
+    CloseFileView(file);
+    if (!ok) return FaspRetCode::ERROR_INPUT_FILE;
+
+    // Sort each row, sum up duplicates, and add the diagonal entry if missing
+    try {
+        diagPtr.assign(row, 0); // as in FormDiagPtr for rows without a diagonal
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
     }
-
-    // Read values
-    locate = 0;
-    while (true) {
-        if (buffer[position] != '\n' && buffer[position] != '\0') {
-            decimal[count] = buffer[position];
-            ++count;
-            ++position;
-        } else {
-            if (buffer[position] == '\0') break;
-            ++position;
-            decimal[count] = '\0';
-            count          = 0;
-            values[locate] = std::strtod(decimal, &next);
-            ++locate;
+#pragma omp parallel
+    {
+        std::vector<std::pair<USI, DBL>> entry; // buffer of one row, per thread
+
+        INT i;
+#pragma omp for schedule(dynamic, 256)
+        for (i = 0; i < (INT)row; ++i) {
+            const USI begin = rowPtr[i], stop = cursor[i];
+            entry.clear();
+            for (USI k = begin; k < stop; ++k) entry.push_back({colInd[k], values[k]});
+            if ((USI)i < col) entry.push_back({(USI)i, 0.0}); // reserved diagonal spot
+            std::sort(entry.begin(), entry.end()); // ties by value: deterministic sums
+
+            USI k = begin;
+            for (const auto& e : entry) {
+                if (k > begin && colInd[k - 1] == e.first) {
+                    values[k - 1] += e.second;
+                    continue;
+                }
+                colInd[k] = e.first;
+                values[k] = e.second;
+                if (e.first == (USI)i) diagPtr[i] = k;
+                ++k;
+            }
+            cursor[i] = k; // end of the compressed row
         }
     }
-    if (locate != nnz) retCode = FaspRetCode::ERROR_INPUT_FILE;
 
-    // If the indices start from 1, we shift them to start from 0
-    if (rowPtr[0] == 1) {
-        for (count = 0; count <= row; ++count) rowPtr[count]--;
-        for (count = 0; count < nnz; ++count) colInd[count]--;
+    // Squeeze out the spots freed by duplicates
+    USI count = 0;
+    for (USI r = 0; r < row; ++r) {
+        const USI begin = rowPtr[r], len = cursor[r] - begin;
+        if (begin != count) {
+            std::copy(colInd.begin() + begin, colInd.begin() + begin + len,
+                      colInd.begin() + count);
+            std::copy(values.begin() + begin, values.begin() + begin + len,
+                      values.begin() + count);
+            if (r < col) diagPtr[r] -= begin - count; // no diagonal otherwise
+        }
+        rowPtr[r] = count;
+        count += len;
     }
+    rowPtr[row] = count;
+    colInd.resize(count);
+    values.resize(count);
 
-    delete[] buffer; // clean up memory space
+    dst.SetValues(row, col, count, std::move(values), std::move(colInd),
+                  std::move(rowPtr), std::move(diagPtr));
 
     return retCode;
 }
@@ -378,9 +581,11 @@ FaspRetCode ReadMat(const char* fileName, MAT& dst)
         flag = FILE_CSR; // CSR file
     else if (strcmp(fileExt, "mtx") == 0)
         flag = FILE_MTX; // MTX file
+    else if (strcmp(fileExt, "bin") == 0)
+        flag = FILE_BIN; // Binary file
 
     USI              row, col, nnz;
-    std::vector<USI> rowPtr, colInd, rowInd;
+    std::vector<USI> rowPtr, colInd;
     std::vector<DBL> values;
 
     switch (flag) {
@@ -417,17 +622,18 @@ FaspRetCode ReadMat(const char* fileName, MAT& dst)
 
         case FILE_MTX:
             try {
-                retCode = ReadMTX(fileName, row, col, nnz, rowInd, colInd, values);
+                retCode = ReadMTXtoMAT(fileName, dst);
                 if (retCode < 0)
                     throw(FaspRunTime(retCode, __FILE__, __FUNCTION__, __LINE__));
             } catch (FaspRunTime& ex) {
                 ex.LogExcep();
                 break;
             }
+            break;
 
-            // Sort each row in ascending order
+        case FILE_BIN:
             try {
-                retCode = MTXtoMAT(row, col, nnz, rowInd, colInd, values, dst);
+                retCode = ReadBinMAT(fileName, dst);
                 if (retCode < 0)
                     throw(FaspRunTime(retCode, __FILE__, __FUNCTION__, __LINE__));
             } catch (FaspRunTime& ex) {
@@ -452,4 +658,9 @@ FaspRetCode ReadMat(const char* fileName, MAT& dst)
 /*----------------------------------------------------------------------------*/
 /*  Kailei Zhang        Oct/11/2019      Create file                          */
 /*  Chensong Zhang      Sep/16/2021      Restructure file                     */
+/*  Chensong Zhang      Oct/19/2026      Parse mapped files in parallel       */
+/*  Chensong Zhang      Oct/19/2026      Read binary MAT files                */
+/*  Chensong Zhang      Oct/19/2026      Stream MTX files into MAT directly   */
+/*  Chensong Zhang      Oct/19/2026      Read compressed files transparently  */
+/*  Chensong Zhang      Oct/19/2026      Check entries in the second pass     */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
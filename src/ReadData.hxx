@@ -60,6 +60,7 @@
 // Definition of file format
 const unsigned FILE_CSR = 1; ///< CSR file format
 const unsigned FILE_MTX = 2; ///< MTX file format
+const unsigned FILE_BIN = 3; ///< Binary file format, see BinData.hxx
 
 /// Read a VEC data file and store it in dst
 FaspRetCode ReadVEC(const char* filename, VEC& dst);
@@ -69,12 +70,15 @@ FaspRetCode ReadMTX(const char* filename, USI& row, USI& col, USI& nnz,
                     std::vector<USI>& rowInd, std::vector<USI>& colInd,
                     std::vector<DBL>& values);
 
+/// Read an MTX data file and convert it to MAT without the triplet arrays
+FaspRetCode ReadMTXtoMAT(const char* filename, MAT& dst);
+
 /// Read a CSR data file and store it in (rowPtr, colInd, values)
 FaspRetCode ReadCSR(const char* filename, USI& row, USI& col, USI& nnz,
                     std::vector<USI>& rowPtr, std::vector<USI>& colInd,
                     std::vector<DBL>& values);
 
-/// Read a MAT data file and store it in MAT
+/// Read a MAT data file (CSR, MTX, or binary) and store it in MAT
 FaspRetCode ReadMat(const char* filename, MAT& dst);
 
 #endif /* end if for __READDATA__HEADER__ */
@@ -86,4 +90,6 @@ FaspRetCode ReadMat(const char* filename, MAT& dst);
 /*----------------------------------------------------------------------------*/
 /*  Kailei Zhang        Oct/11/2019      Create file                          */
 /*  Chensong Zhang      Sep/16/2021      Restructure file                     */
+/*  Chensong Zhang      Oct/19/2026      Add binary file format               */
+/*  Chensong Zhang      Oct/19/2026      Add streaming MTX to MAT reader      */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
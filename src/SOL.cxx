@@ -139,6 +139,20 @@ void SOL::SetSolTypeFromName(SOLParams& params)
         params.type = SOLType::SOLVER_FGMRES;
     else if (params.algName == "vfgmres")
         params.type = SOLType::SOLVER_VFGMRES;
+    else if (params.algName == "gmresdr")
+        params.type = SOLType::SOLVER_GMRESDR;
+    else if (params.algName == "gcrodr")
+        params.type = SOLType::SOLVER_GCRODR;
+    else if (params.algName == "dcg")
+        params.type = SOLType::SOLVER_DCG;
+    else if (params.algName == "idrs")
+        params.type = SOLType::SOLVER_IDRS;
+    else if (params.algName == "bicgstabl")
+        params.type = SOLType::SOLVER_BICGSTABL;
+    else if (params.algName == "ibicgstab")
+        params.type = SOLType::SOLVER_IBICGSTAB;
+    else if (params.algName == "mpir")
+        params.type = SOLType::SOLVER_MPIR;
     else if (params.algName == "jacobi")
         params.type = SOLType::SOLVER_JACOBI;
     else if (params.algName == "gs")
@@ -153,6 +167,12 @@ void SOL::SetSolTypeFromName(SOLParams& params)
         params.type = SOLType::SOLVER_MG;
     else if (params.algName == "fmg")
         params.type = SOLType::SOLVER_FMG;
+    else if (params.algName == "denselu")
+        params.type = SOLType::SOLVER_DENSELU;
+    else if (params.algName == "ldlt")
+        params.type = SOLType::SOLVER_LDLT;
+    else if (params.algName == "umfpack")
+        params.type = SOLType::SOLVER_UMFPACK;
     else {
         params.type = SOLType::SOLVER_CG; // default solver type
         if (params.verbose > PRINT_NONE)
@@ -176,6 +196,20 @@ const char* SOL::GetSolType(SOLType type) const
             return "FGMRES";
         case SOLVER_VFGMRES:
             return "VFGMRES";
+        case SOLVER_GMRESDR:
+            return "GMRES-DR";
+        case SOLVER_GCRODR:
+            return "GCRO-DR";
+        case SOLVER_DCG:
+            return "DCG";
+        case SOLVER_IDRS:
+            return "IDR(s)";
+        case SOLVER_BICGSTABL:
+            return "BiCGStab(l)";
+        case SOLVER_IBICGSTAB:
+            return "IBiCGStab";
+        case SOLVER_MPIR:
+            return "MPIR";
         case SOLVER_JACOBI:
             return "JACOBI";
         case SOLVER_GS:
@@ -190,6 +224,12 @@ const char* SOL::GetSolType(SOLType type) const
             return "MG";
         case SOLVER_FMG:
             return "FMG";
+        case SOLVER_DENSELU:
+            return "DenseLU";
+        case SOLVER_LDLT:
+            return "LDLT";
+        case SOLVER_UMFPACK:
+            return "UMFPACK";
         default:
             FASPXX_ABORT("Unknown solver type!");
     }
@@ -220,7 +260,8 @@ void SOL::PrintParam(std::ostream& out) const
         << "    Absolute tolerance:   " << params.absTol << "\n";
 
     // Parameters for Krylov solvers
-    if (0 < params.type && params.type < 10) {
+    if ((0 < params.type && params.type < 10) ||
+        (30 < params.type && params.type < 40)) {
         out << "    Restart number:       " << params.restart << "\n";
     }
 
@@ -255,4 +296,12 @@ void SOL::SetupPCD(SOL& precond) { this->pcd = &precond; }
 /*----------------------------------------------------------------------------*/
 /*  Kailei Zhang        Nov/25/2019      Create file                          */
 /*  Chensong Zhang      Sep/17/2021      Add more Krylov methods as choices   */
+/*  Chensong Zhang      Oct/19/2026      Add dense LU direct solver           */
+/*  Chensong Zhang      Oct/19/2026      Add sparse LDL^T direct solver       */
+/*  Chensong Zhang      Oct/19/2026      Add UMFPACK to solver names          */
+/*  Chensong Zhang      Oct/19/2026      Add GMRES-DR and GCRO-DR             */
+/*  Chensong Zhang      Oct/19/2026      Add deflated CG                      */
+/*  Chensong Zhang      Oct/19/2026      Add IDR(s) and BiCGStab(l)           */
+/*  Chensong Zhang      Oct/19/2026      Add improved BiCGStab                */
+/*  Chensong Zhang      Oct/19/2026      Add mixed-precision refinement       */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
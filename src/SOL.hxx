@@ -51,7 +51,7 @@ public:
         , numIter(0){};
 
     /// Default destructor.
-    ~SOL();
+    virtual ~SOL();
 
     /// Set output level.
     void SetOutput(Output verbose);
@@ -134,4 +134,5 @@ public:
 /*----------------------------------------------------------------------------*/
 /*  Kailei Zhang        Nov/25/2019      Create file                          */
 /*  Chensong Zhang      Sep/29/2021      Restructure file                     */
+/*  Chensong Zhang      Oct/19/2026      Make destructor virtual              */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
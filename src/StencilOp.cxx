@@ -0,0 +1,285 @@
+/*! \file    StencilOp.cxx
+ *  \brief   Matrix-free stencil operator on structured grids
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <utility>
+
+// FASPXX header files
+#include "StencilOp.hxx"
+
+/// Offsets of the stencil points of a shape, generated at compile time.
+template <StencilShape S>
+struct StencilPoints {
+    INT dx[S]; ///< offset in x of each point
+    INT dy[S]; ///< offset in y of each point
+    INT dz[S]; ///< offset in z of each point
+
+    constexpr StencilPoints()
+        : dx()
+        , dy()
+        , dz()
+    {
+        const bool is2D  = (S == STENCIL_5P2D || S == STENCIL_9P2D);
+        const INT  maxL1 = (S == STENCIL_5P2D || S == STENCIL_7P3D) ? 1
+                           : (S == STENCIL_19P3D)                   ? 2
+                                                                    : 3;
+        USI        p     = 0;
+        for (INT k = is2D ? 0 : -1; k <= (is2D ? 0 : 1); ++k) {
+            for (INT j = -1; j <= 1; ++j) {
+                for (INT i = -1; i <= 1; ++i) {
+                    const INT l1 = (i < 0 ? -i : i) + (j < 0 ? -j : j) + (k < 0 ? -k : k);
+                    if (l1 > maxL1) continue;
+                    dx[p] = i, dy[p] = j, dz[p] = k, ++p;
+                }
+            }
+        }
+    }
+};
+
+template <StencilShape S>
+static constexpr StencilPoints<S> POINTS{}; ///< stencil points of shape S
+
+/// Stencil sum at grid point idx whose neighbors all exist, fully unrolled.
+template <StencilShape S, bool VAR, size_t... P>
+static inline DBL InnerSum(const DBL* cf, USI n, const DBL* x, const INT* off, INT idx,
+                           std::index_sequence<P...>)
+{
+    return (... + ((VAR ? cf[P * n + idx] : cf[P]) * x[idx + off[P]]));
+}
+
+/// Build on an nx x ny x nz grid with constant or variable coefficients.
+template <StencilShape S>
+StencilOp<S>::StencilOp(USI nx, USI ny, USI nz, const std::vector<DBL>& coef)
+    : nx(0)
+    , ny(0)
+    , nz(0)
+    , variable(false)
+{
+    FaspRetCode retCode = SetValues(nx, ny, nz, coef);
+    if (retCode < 0) throw(FaspRunTime(retCode, __FILE__, __FUNCTION__, __LINE__));
+}
+
+/// Set the grid size and the constant (size S) or variable (size S*n) coef.
+template <StencilShape S>
+FaspRetCode StencilOp<S>::SetValues(USI nx, USI ny, USI nz,
+                                    const std::vector<DBL>& coef)
+{
+    const bool is2D = (S == STENCIL_5P2D || S == STENCIL_9P2D);
+    if (nx == 0 || ny == 0 || nz == 0 || (is2D && nz != 1))
+        return FaspRetCode::ERROR_INPUT_PAR;
+
+    const size_t n = (size_t)nx * ny * nz;
+    if (coef.size() != S && coef.size() != S * n) return FaspRetCode::ERROR_VEC_SIZE;
+
+    try {
+        this->coef = coef;
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    this->nx = nx;
+    this->ny = ny;
+    this->nz = nz;
+    variable = (coef.size() != S);
+    nrow = mcol = n;
+    for (USI p = 0; p < S; ++p)
+        offset[p] = POINTS<S>.dx[p] + (POINTS<S>.dy[p] + POINTS<S>.dz[p] * (INT)ny) * nx;
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Get the offset (dx, dy, dz) of stencil point p.
+template <StencilShape S>
+void StencilOp<S>::GetPoint(USI p, INT& dx, INT& dy, INT& dz)
+{
+    dx = POINTS<S>.dx[p];
+    dy = POINTS<S>.dy[p];
+    dz = POINTS<S>.dz[p];
+}
+
+/// Get the number of grid points in each direction.
+template <StencilShape S>
+void StencilOp<S>::GetGrid(USI& nx, USI& ny, USI& nz) const
+{
+    nx = this->nx;
+    ny = this->ny;
+    nz = this->nz;
+}
+
+/// Whether the coefficients vary in space.
+template <StencilShape S>
+bool StencilOp<S>::IsVariable() const
+{
+    return variable;
+}
+
+/// Get the coefficient of stencil point p at grid point i.
+template <StencilShape S>
+DBL StencilOp<S>::GetCoef(USI p, USI i) const
+{
+    return variable ? coef[(size_t)p * nrow + i] : coef[p];
+}
+
+/// Get the diagonal entries, i.e. the coefficients of the center point.
+template <StencilShape S>
+void StencilOp<S>::GetDiag(VEC& v) const
+{
+    v.SetValues(nrow, 0.0);
+    for (USI i = 0; i < nrow; ++i) v[i] = GetCoef(S / 2, i);
+}
+
+/// Assemble the operator as a sparse matrix; columns are sorted in each row.
+template <StencilShape S>
+void StencilOp<S>::ToMAT(MAT& mat) const
+{
+    std::vector<DBL> values;
+    std::vector<USI> colInd, rowPtr;
+    try {
+        values.reserve((size_t)S * nrow);
+        colInd.reserve((size_t)S * nrow);
+        rowPtr.reserve(nrow + 1);
+    } catch (std::bad_alloc& ex) {
+        throw(FaspBadAlloc(__FILE__, __FUNCTION__, __LINE__));
+    }
+
+    rowPtr.push_back(0);
+    for (USI k = 0; k < nz; ++k) {
+        for (USI j = 0; j < ny; ++j) {
+            for (USI i = 0; i < nx; ++i) {
+                const USI idx = (k * ny + j) * nx + i;
+                for (USI p = 0; p < S; ++p) {
+                    if (i + POINTS<S>.dx[p] >= nx || j + POINTS<S>.dy[p] >= ny ||
+                        k + POINTS<S>.dz[p] >= nz)
+                        continue; // unsigned wrap-around catches -1 as well
+                    values.push_back(GetCoef(p, idx));
+                    colInd.push_back(idx + offset[p]);
+                }
+                rowPtr.push_back(colInd.size());
+            }
+        }
+    }
+
+    mat = MAT(nrow, mcol, colInd.size(), values, colInd, rowPtr);
+}
+
+/// Apply the stencil to x and save (b - Ax) or Ax in y.
+template <StencilShape S>
+template <bool VAR, bool RES>
+void StencilOp<S>::ApplyLines(const DBL* b, const DBL* x, DBL* y) const
+{
+    const USI  n        = nrow;
+    const DBL* cf       = coef.data();
+    const INT  numLines = ny * nz;
+    const INT  mx       = nx;
+
+    INT line;
+#pragma omp parallel for private(line) schedule(static)
+    for (line = 0; line < numLines; ++line) {
+        const INT j = line % ny, k = line / ny, base = line * mx;
+
+        // Stencil points whose y and z neighbors exist for this line
+        bool valid[S], full = true;
+        for (USI p = 0; p < S; ++p) {
+            valid[p] = (USI)(j + POINTS<S>.dy[p]) < ny && (USI)(k + POINTS<S>.dz[p]) < nz;
+            full     = full && valid[p];
+        }
+
+        if (full) {
+            // Inner points: branch-free and fully unrolled
+#pragma omp simd
+            for (INT i = base + 1; i < base + mx - 1; ++i) {
+                const DBL sum = InnerSum<S, VAR>(cf, n, x, offset, i,
+                                                 std::make_index_sequence<S>());
+                y[i] = RES ? b[i] - sum : sum;
+            }
+
+            // The two ends of the line
+            for (INT i = 0; i < mx; i += (mx > 1 ? mx - 1 : 1)) {
+                DBL sum = 0.0;
+                for (USI p = 0; p < S; ++p) {
+                    if ((USI)(i + POINTS<S>.dx[p]) >= nx) continue;
+                    sum += (VAR ? cf[p * n + base + i] : cf[p]) * x[base + i + offset[p]];
+                }
+                y[base + i] = RES ? b[base + i] - sum : sum;
+            }
+        } else {
+            // Boundary lines: add up the existing points one by one
+            DBL* yl = y + base;
+            for (INT i = 0; i < mx; ++i) yl[i] = 0.0;
+            for (USI p = 0; p < S; ++p) {
+                if (!valid[p]) continue;
+                const INT  iBeg = POINTS<S>.dx[p] < 0 ? 1 : 0;
+                const INT  iEnd = POINTS<S>.dx[p] > 0 ? mx - 1 : mx;
+                const DBL* xl   = x + base + offset[p];
+                const DBL* cl   = VAR ? cf + p * n + base : cf + p;
+#pragma omp simd
+                for (INT i = iBeg; i < iEnd; ++i) yl[i] += (VAR ? cl[i] : cl[0]) * xl[i];
+            }
+            if (RES)
+                for (INT i = 0; i < mx; ++i) yl[i] = b[base + i] - yl[i];
+        }
+    }
+}
+
+/// Matrix-free stencil application y = Ax.
+template <StencilShape S>
+void StencilOp<S>::Apply(const VEC& x, VEC& y) const
+{
+    if (y.GetSize() != nrow) y.SetValues(nrow, 0.0);
+
+    const DBL* xv;
+    DBL*       yv;
+    x.GetArray(&xv);
+    y.GetArray(&yv);
+
+    if (variable)
+        ApplyLines<true, false>(nullptr, xv, yv);
+    else
+        ApplyLines<false, false>(nullptr, xv, yv);
+}
+
+/// Residual r = b - Ax.
+template <StencilShape S>
+void StencilOp<S>::Residual(const VEC& b, const VEC& x, VEC& r) const
+{
+    if (x.NormInf() < CLOSE_ZERO) {
+        r = b; // if x = 0, for preconditioning
+        return;
+    }
+
+    if (r.GetSize() != nrow) r.SetValues(nrow, 0.0);
+
+    const DBL *bv, *xv;
+    DBL*       rv;
+    b.GetArray(&bv);
+    x.GetArray(&xv);
+    r.GetArray(&rv);
+
+    if (variable)
+        ApplyLines<true, true>(bv, xv, rv);
+    else
+        ApplyLines<false, true>(bv, xv, rv);
+}
+
+// Explicit instantiation of the supported shapes
+template class StencilOp<STENCIL_5P2D>;
+template class StencilOp<STENCIL_9P2D>;
+template class StencilOp<STENCIL_7P3D>;
+template class StencilOp<STENCIL_19P3D>;
+template class StencilOp<STENCIL_27P3D>;
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
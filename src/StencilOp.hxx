@@ -0,0 +1,131 @@
+/*! \file    StencilOp.hxx
+ *  \brief   Matrix-free stencil operator on structured grids
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+/*! Important Note:
+ *-----------------------------------------------------------------------------------
+ *  The grid has nx x ny x nz points (nz = 1 in 2D), numbered lexicographically with
+ *  x running fastest. The stencil points are the offsets (dx, dy, dz) in {-1, 0, 1}^3
+ *  allowed by the shape, ordered lexicographically in (dz, dy, dx), so the center
+ *  point is always the middle one and the points of a row are sorted by column:
+ *
+ *      STENCIL_5P2D : |dx| + |dy| <= 1,         dz = 0
+ *      STENCIL_9P2D : all (dx, dy),             dz = 0
+ *      STENCIL_7P3D : |dx| + |dy| + |dz| <= 1
+ *      STENCIL_19P3D: |dx| + |dy| + |dz| <= 2
+ *      STENCIL_27P3D: all (dx, dy, dz)
+ *
+ *  Coefficients are either constant, one per stencil point, or variable, stored
+ *  point by point as coef[p * n + i] for grid point i, so that the inner loops run
+ *  with unit stride. Neighbors outside the grid are dropped, which corresponds to
+ *  eliminated Dirichlet boundary conditions.
+ *
+ *  Apply and Residual work line by line in x. Lines whose y and z neighbors all
+ *  exist run a branch-free SIMD loop over the inner points with the stencil fully
+ *  unrolled at compile time; the rest handle the missing neighbors point by point.
+ *  Lines are split among the OpenMP threads in contiguous blocks, so neighboring
+ *  lines and planes of x stay in cache.
+ */
+
+#ifndef __STENCILOP_HEADER__ /*-- allow multiple inclusions --*/
+#define __STENCILOP_HEADER__ /**< indicate StencilOp.hxx has been included before */
+
+// Standard header files
+#include <vector>
+
+// FASPXX header files
+#include "LOP.hxx"
+#include "MAT.hxx"
+
+/// Stencil shapes; the value is the number of stencil points.
+enum StencilShape {
+    STENCIL_5P2D  = 5,  ///< 5-point stencil in 2D
+    STENCIL_9P2D  = 9,  ///< 9-point stencil in 2D
+    STENCIL_7P3D  = 7,  ///< 7-point stencil in 3D
+    STENCIL_19P3D = 19, ///< 19-point stencil in 3D
+    STENCIL_27P3D = 27  ///< 27-point stencil in 3D
+};
+
+template <StencilShape S>
+class RBGS; // smoother working on the stencil directly
+
+/*! \class StencilOp
+ *  \brief Matrix-free linear operator of a stencil with compile-time shape.
+ */
+template <StencilShape S>
+class StencilOp : public LOP
+{
+private:
+    USI              nx, ny, nz;   ///< number of grid points in each direction
+    bool             variable;     ///< whether the coefficients vary in space
+    std::vector<DBL> coef;         ///< constant or variable coefficients
+    INT              offset[S];    ///< index offset of each stencil point
+
+    /// Apply the stencil to x and save (b - Ax) or Ax in y.
+    template <bool VAR, bool RES>
+    void ApplyLines(const DBL* b, const DBL* x, DBL* y) const;
+
+public:
+    template <StencilShape T>
+    friend class RBGS;
+
+    static const USI numPoints = S; ///< number of stencil points
+
+    /// Default constructor.
+    StencilOp()
+        : nx(0)
+        , ny(0)
+        , nz(0)
+        , variable(false){};
+
+    /// Build on an nx x ny x nz grid with constant or variable coefficients.
+    StencilOp(USI nx, USI ny, USI nz, const std::vector<DBL>& coef);
+
+    /// Default destructor.
+    ~StencilOp() = default;
+
+    /// Set the grid size and the constant (size S) or variable (size S*n) coef.
+    FaspRetCode SetValues(USI nx, USI ny, USI nz, const std::vector<DBL>& coef);
+
+    /// Get the offset (dx, dy, dz) of stencil point p.
+    static void GetPoint(USI p, INT& dx, INT& dy, INT& dz);
+
+    /// Get the number of grid points in each direction.
+    void GetGrid(USI& nx, USI& ny, USI& nz) const;
+
+    /// Whether the coefficients vary in space.
+    bool IsVariable() const;
+
+    /// Get the coefficient of stencil point p at grid point i.
+    DBL GetCoef(USI p, USI i) const;
+
+    /// Get the diagonal entries and save them in a VEC object.
+    void GetDiag(VEC& v) const;
+
+    /// Assemble the operator as a sparse matrix.
+    void ToMAT(MAT& mat) const;
+
+    /// Matrix-free stencil application.
+    void Apply(const VEC& x, VEC& y) const override;
+
+    /// Residual b - Ax.
+    void Residual(const VEC& b, const VEC& x, VEC& r) const override;
+};
+
+#endif /* end if for __STENCILOP_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Add RBGS as a friend                 */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,206 @@
+/*! \file    SymMAT.cxx
+ *  \brief   Symmetric sparse matrix with upper triangular storage
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <algorithm>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// FASPXX header files
+#include "SymMAT.hxx"
+
+/// Build from a MAT holding the upper, the lower, or both triangles.
+SymMAT::SymMAT(const MAT& mat)
+    : nnz(0)
+{
+    FaspRetCode retCode = SetValues(mat);
+    if (retCode < 0) throw(FaspRunTime(retCode, __FILE__, __FUNCTION__, __LINE__));
+}
+
+/// Keep the upper triangle of mat; if mat has only the lower one, transpose it.
+FaspRetCode SymMAT::SetValues(const MAT& mat)
+{
+    const USI n = mat.nrow;
+    if (n != mat.mcol) return FaspRetCode::ERROR_MAT_SIZE;
+    if (mat.values.size() != mat.nnz) return FaspRetCode::ERROR_MAT_DATA;
+
+    // Find out which triangle is given
+    USI numUpper = 0, numLower = 0;
+    for (USI i = 0; i < n; ++i) {
+        for (USI k = mat.rowPtr[i]; k < mat.rowPtr[i + 1]; ++k) {
+            if (mat.colInd[k] > i) ++numUpper;
+            if (mat.colInd[k] < i) ++numLower;
+        }
+    }
+    const bool useLower = (numUpper == 0);
+
+    try {
+        nnz = n + (useLower ? numLower : numUpper);
+        rowPtr.assign(n + 1, 0);
+        colInd.resize(nnz);
+        values.resize(nnz);
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    // Count entries of each row: the diagonal plus the upper part
+    for (USI i = 0; i < n; ++i) {
+        rowPtr[i + 1] += 1;
+        for (USI k = mat.rowPtr[i]; k < mat.rowPtr[i + 1]; ++k) {
+            const USI j = mat.colInd[k];
+            if (!useLower && j > i) ++rowPtr[i + 1];
+            if (useLower && j < i) ++rowPtr[j + 1];
+        }
+    }
+    for (USI i = 0; i < n; ++i) rowPtr[i + 1] += rowPtr[i];
+
+    // Put the diagonal first; rows of a transposed lower part come out sorted
+    std::vector<USI> pos(rowPtr.begin(), rowPtr.end() - 1);
+    for (USI i = 0; i < n; ++i) {
+        colInd[pos[i]]   = i;
+        values[pos[i]++] = mat.values[mat.diagPtr[i]];
+    }
+    for (USI i = 0; i < n; ++i) {
+        for (USI k = mat.rowPtr[i]; k < mat.rowPtr[i + 1]; ++k) {
+            const USI j = mat.colInd[k];
+            if (!useLower && j > i) {
+                colInd[pos[i]]   = j;
+                values[pos[i]++] = mat.values[k];
+            }
+            if (useLower && j < i) {
+                colInd[pos[j]]   = i;
+                values[pos[j]++] = mat.values[k];
+            }
+        }
+    }
+
+    nrow = mcol = n;
+    try {
+        Partition();
+    } catch (std::bad_alloc& ex) {
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Split the rows into one part per thread with balanced number of nonzeros, and
+/// allocate the buffers for the column updates beyond each part.
+void SymMAT::Partition()
+{
+#ifdef _OPENMP
+    const USI numParts = std::max(1, std::min(omp_get_max_threads(), (INT)nrow));
+#else
+    const USI numParts = 1;
+#endif
+
+    partRow.resize(numParts + 1);
+    partCol.resize(numParts);
+    partRow[0] = 0;
+    for (USI t = 1; t < numParts; ++t) {
+        const USI target = (size_t)nnz * t / numParts;
+        partRow[t] = std::upper_bound(rowPtr.begin(), rowPtr.end(), target) -
+                     rowPtr.begin() - 1;
+        partRow[t] = std::max(partRow[t], partRow[t - 1]);
+    }
+    partRow[numParts] = nrow;
+
+    // The largest column touched by each part
+    for (USI t = 0; t < numParts; ++t) {
+        partCol[t] = 0;
+        for (USI i = partRow[t]; i < partRow[t + 1]; ++i)
+            for (USI k = rowPtr[i]; k < rowPtr[i + 1]; ++k)
+                partCol[t] = std::max(partCol[t], colInd[k]);
+    }
+
+    // Buffers for the columns after each part up to the largest one it touches
+    bufPtr.assign(numParts + 1, 0);
+    for (USI t = 0; t < numParts; ++t) {
+        const USI last = partRow[t + 1];
+        bufPtr[t + 1]  = bufPtr[t] + (partCol[t] >= last ? partCol[t] + 1 - last : 0);
+    }
+    buf.assign(bufPtr[numParts], 0.0);
+}
+
+/// Return this->nnz.
+USI SymMAT::GetNNZ() const { return nnz; }
+
+/// Get the diagonal entries, which come first in each row.
+void SymMAT::GetDiag(VEC& v) const
+{
+    v.SetValues(nrow, 0.0);
+    for (USI i = 0; i < nrow; ++i) v[i] = values[rowPtr[i]];
+}
+
+/// Symmetric SpMV with the row and column updates done at once.
+void SymMAT::Apply(const VEC& v, VEC& w) const
+{
+    const DBL* x;
+    DBL*       y;
+    v.GetArray(&x);
+    w.GetArray(&y);
+
+    const INT numParts = partCol.size();
+
+    INT t;
+#pragma omp parallel for private(t) num_threads(numParts)
+    for (t = 0; t < numParts; ++t) {
+        const USI first = partRow[t], last = partRow[t + 1];
+        DBL*      bt    = buf.data() + bufPtr[t]; // column updates beyond own part
+        std::fill(bt, buf.data() + bufPtr[t + 1], 0.0);
+
+        for (USI i = first; i < last; ++i) y[i] = 0.0;
+        for (USI i = first; i < last; ++i) {
+            const DBL xi  = x[i];
+            DBL       sum = values[rowPtr[i]] * xi; // diagonal
+            for (USI k = rowPtr[i] + 1; k < rowPtr[i + 1]; ++k) {
+                const USI j = colInd[k];
+                sum += values[k] * x[j];
+                if (j < last)
+                    y[j] += values[k] * xi;
+                else
+                    bt[j - last] += values[k] * xi;
+            }
+            y[i] += sum;
+        }
+    }
+
+    // Add the column updates of the other parts
+    INT j;
+#pragma omp parallel for private(j)
+    for (j = 0; j < (INT)nrow; ++j) {
+        for (INT s = 0; s < numParts && partRow[s + 1] <= (USI)j; ++s)
+            if ((USI)j <= partCol[s]) y[j] += buf[bufPtr[s] + j - partRow[s + 1]];
+    }
+}
+
+/// Residual r = b - Ax.
+void SymMAT::Residual(const VEC& b, const VEC& x, VEC& r) const
+{
+    if (x.NormInf() < CLOSE_ZERO) {
+        r = b; // if x = 0, for preconditioning
+        return;
+    }
+
+    Apply(x, r);
+    r.XPAY(-1.0, b);
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Allocate thread buffers once         */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,92 @@
+/*! \file    SymMAT.hxx
+ *  \brief   Symmetric sparse matrix with upper triangular storage
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+/*! Important Note:
+ *-----------------------------------------------------------------------------------
+ *  Only the diagonal and the strict upper triangular part are stored, row by row,
+ *  with the diagonal entry first in each row. The matrix-vector product does the
+ *  row update y[i] += a_ij x[j] and the column update y[j] += a_ij x[i] at once.
+ *
+ *  For thread safety, the rows are split into one contiguous part per thread with
+ *  balanced number of nonzeros. Column updates inside the own part go to y
+ *  directly; those beyond it go to a per-thread buffer covering the columns up to
+ *  the largest one the part touches, which is short for banded matrices. The
+ *  buffers are added to y afterwards. They are allocated once with the partition
+ *  and only zeroed in Apply, so one SymMAT must not be applied by two threads at
+ *  the same time.
+ */
+
+#ifndef __SYMMAT_HEADER__ /*-- allow multiple inclusions --*/
+#define __SYMMAT_HEADER__ /**< indicate SymMAT.hxx has been included before */
+
+// Standard header files
+#include <vector>
+
+// FASPXX header files
+#include "LOP.hxx"
+#include "MAT.hxx"
+
+/*! \class SymMAT
+ *  \brief Symmetric sparse matrix storing the diagonal and upper triangle.
+ */
+class SymMAT : public LOP
+{
+private:
+    USI              nnz;     ///< number of stored nonzeros (upper part)
+    std::vector<DBL> values;  ///< stored entries, diagonal first in each row
+    std::vector<USI> colInd;  ///< column indices of the stored entries
+    std::vector<USI> rowPtr;  ///< pointers to the beginning of each row
+    std::vector<USI> partRow; ///< first row of each thread part
+    std::vector<USI> partCol; ///< largest column touched by each thread part
+    std::vector<USI> bufPtr;  ///< beginning of the buffer of each thread part
+
+    mutable std::vector<DBL> buf; ///< column updates beyond the own thread part
+
+    /// Split the rows into parts with balanced number of nonzeros.
+    void Partition();
+
+public:
+    /// Default constructor.
+    SymMAT()
+        : nnz(0){};
+
+    /// Build from a MAT holding the upper, the lower, or both triangles.
+    explicit SymMAT(const MAT& mat);
+
+    /// Default destructor.
+    ~SymMAT() = default;
+
+    /// Build from a MAT holding the upper, the lower, or both triangles.
+    FaspRetCode SetValues(const MAT& mat);
+
+    /// Get number of stored nonzeros.
+    USI GetNNZ() const;
+
+    /// Get the diagonal entries and save them in a VEC object.
+    void GetDiag(VEC& v) const;
+
+    /// Symmetric sparse matrix-vector multiplication.
+    void Apply(const VEC& v, VEC& w) const override;
+
+    /// Residual b - Ax.
+    void Residual(const VEC& b, const VEC& x, VEC& r) const override;
+};
+
+#endif /* end if for __SYMMAT_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Allocate thread buffers once         */
+/*----------------------------------------------------------------------------*/
@@ -19,27 +19,52 @@ FaspRetCode UMFPACK::Setup(const MAT& A)
     int status;
 
     // Set solver type
-    SetSolType(SOLType::UMFPACK);
+    SetSolType(SOLType::SOLVER_UMFPACK);
 
     // Setup the coefficient matrix
     this->A = &A;
 
     // Setup data for UMFPACK ordering (column-major)
-    MAT Atrans = A;
-    Atrans.TransInPlace();
-
-    n   = Atrans.GetColSize();
-    m   = Atrans.GetRowSize();
-    nnz = Atrans.GetNNZ();
+    n   = A.GetRowSize();
+    m   = A.GetColSize();
+    nnz = A.GetNNZ();
 
     if (Ap != nullptr) FASPXX_ABORT("Pointer Ap is not null!");
-    Ap = Atrans.GetRowPtr();
-
     if (Ai != nullptr) FASPXX_ABORT("Pointer Ai is not null!");
-    Ai = Atrans.GetColInd();
-
     if (Ax != nullptr) FASPXX_ABORT("Pointer Ax is not null!");
-    Ax = Atrans.GetValues();
+
+    const USI* rowPtr = A.rowPtr.data();
+    const USI* colInd = A.colInd.data();
+    try {
+        Ap = new int[m + 1];
+        Ai = new int[nnz];
+        Ax = new double[nnz];
+        valMap.resize(nnz);
+        Wi.resize(n);
+        W.resize(5 * n); // 5n is needed when iterative refinement is on
+    } catch (std::bad_alloc& ex) {
+        delete[] Ap; // new[] of the others may have failed: they are still null
+        delete[] Ai;
+        delete[] Ax;
+        Ap = nullptr;
+        Ai = nullptr;
+        Ax = nullptr;
+        return FaspRetCode::ERROR_ALLOC_MEM;
+    }
+
+    // Transpose the pattern once and remember where each value goes
+    for (int j = 0; j <= m; ++j) Ap[j] = 0;
+    for (int k = 0; k < nnz; ++k) Ap[colInd[k] + 1]++;
+    for (int j = 0; j < m; ++j) Ap[j + 1] += Ap[j];
+    std::vector<int> next(Ap, Ap + m);
+    for (int i = 0; i < n; ++i) {
+        for (int k = (int)rowPtr[i]; k < (int)rowPtr[i + 1]; ++k) {
+            const int pos = next[colInd[k]]++;
+            Ai[pos]       = i;
+            valMap[k]     = pos;
+        }
+    }
+    CopyValues(A);
 
     // Call factorizations; see 6.11 in UMFPACK manual for error code
     if (Symbolic != nullptr) FASPXX_ABORT("Pointer Symbolic is not null!");
@@ -50,24 +75,81 @@ FaspRetCode UMFPACK::Setup(const MAT& A)
     status = umfpack_di_numeric(Ap, Ai, Ax, Symbolic, &Numeric, NULL, NULL);
     if (status != 0) return FaspRetCode::ERROR_DSOLVER_SETUP;
 
-    umfpack_di_free_symbolic(&Symbolic);
+    // Keep Symbolic for later calls of Refactor
+    return FaspRetCode::SUCCESS;
+#else
+    FASPXX_ABORT("External package UMFPACK not found!");
+#endif
+}
+
+/// Redo the numeric factorization with new values and the old symbolic one.
+//! Note: The sparsity pattern of A must be the same as in Setup; otherwise
+//!       ERROR_NONMATCH_SIZE is returned and the old factorization is kept.
+FaspRetCode UMFPACK::Refactor(const MAT& A)
+{
+#if WITH_UMFPACK
+    int status;
+
+    if (Symbolic == nullptr) return Setup(A);
+    if ((int)A.GetRowSize() != n || (int)A.GetNNZ() != nnz)
+        return FaspRetCode::ERROR_NONMATCH_SIZE;
+
+    // Entry k has to be where Setup put it: same row, in the same column of Ap/Ai.
+    // Together this means rowPtr and colInd are the same as in Setup.
+    const USI* rowPtr = A.rowPtr.data();
+    const USI* colInd = A.colInd.data();
+    for (int i = 0; i < n; ++i) {
+        for (int k = (int)rowPtr[i]; k < (int)rowPtr[i + 1]; ++k) {
+            const int j = colInd[k], pos = valMap[k];
+            if (j >= m || Ai[pos] != i || pos < Ap[j] || pos >= Ap[j + 1])
+                return FaspRetCode::ERROR_NONMATCH_SIZE;
+        }
+    }
+
+    this->A = &A;
+    CopyValues(A);
+
+    umfpack_di_free_numeric(&Numeric);
+    status = umfpack_di_numeric(Ap, Ai, Ax, Symbolic, &Numeric, NULL, NULL);
+    if (status != 0) return FaspRetCode::ERROR_DSOLVER_SETUP;
+
     return FaspRetCode::SUCCESS;
 #else
     FASPXX_ABORT("External package UMFPACK not found!");
 #endif
 }
 
+/// Copy values of A into Ax following the column-major ordering.
+void UMFPACK::CopyValues(const MAT& A)
+{
+    const DBL* values = A.values.data();
+    for (int k = 0; k < nnz; ++k) Ax[valMap[k]] = values[k];
+}
+
 /// Using the UMFPACK direct solver. Don't check problem sizes.
 FaspRetCode UMFPACK::Solve(const VEC& b, VEC& x)
 {
 #if WITH_UMFPACK
     int status;
-    status = umfpack_di_solve(UMFPACK_A, Ap, Ai, Ax, &x[0], &b[0], Numeric, NULL, NULL);
+    status = umfpack_di_wsolve(UMFPACK_A, Ap, Ai, Ax, &x[0], &b[0], Numeric, NULL,
+                               NULL, Wi.data(), W.data());
     if (status == 0) return FaspRetCode::SUCCESS;
 #else
     FASPXX_ABORT("External package UMFPACK not found!");
 #endif
-    return FaspRetCode::ERROR_SOLVER_TYPE;
+    return FaspRetCode::ERROR_DSOLVER_SOLVE;
+}
+
+/// Solve for a block of right-hand sides, reusing Numeric and the workspace.
+FaspRetCode UMFPACK::Solve(const std::vector<VEC>& b, std::vector<VEC>& x)
+{
+    if (x.size() != b.size()) return FaspRetCode::ERROR_NONMATCH_SIZE;
+
+    for (size_t k = 0; k < b.size(); ++k) {
+        const FaspRetCode retCode = Solve(b[k], x[k]);
+        if (retCode != FaspRetCode::SUCCESS) return retCode;
+    }
+    return FaspRetCode::SUCCESS;
 }
 
 /// Clean up temp memory allocated for UMFPACK.
@@ -82,8 +164,11 @@ void UMFPACK::Clean()
     Ax = nullptr;
 
 #if WITH_UMFPACK
-    umfpack_di_free_numeric(&Numeric);
+    if (Symbolic != nullptr) umfpack_di_free_symbolic(&Symbolic);
+    if (Numeric != nullptr) umfpack_di_free_numeric(&Numeric);
 #endif
+    Symbolic = nullptr;
+    Numeric  = nullptr;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -92,4 +177,6 @@ void UMFPACK::Clean()
 /*  Author              Date             Actions                              */
 /*----------------------------------------------------------------------------*/
 /*  Chensong Zhang      Sep/17/2021      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Add Refactor and multi-RHS Solve     */
+/*  Chensong Zhang      Oct/19/2026      Check pattern, read values directly  */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
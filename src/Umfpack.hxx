@@ -12,6 +12,9 @@
 #ifndef __UMFPACK_HEADER__ /*-- allow multiple inclusions --*/
 #define __UMFPACK_HEADER__ /**< indicate UMFPACK.hxx has been included before */
 
+// Standard header files
+#include <vector>
+
 // FASPXX header files
 #include "ErrorLog.hxx"
 #include "MAT.hxx"
@@ -24,6 +27,10 @@
 
 /*! \class UMFPACK
  *  \brief Interface to external direct solver: Umfpack.
+ *
+ *  Setup computes the symbolic and numeric factorizations. If only the values of
+ *  the matrix change, Refactor reuses the symbolic factorization and redoes the
+ *  numeric one. The symbolic and numeric objects are freed in Clean.
  */
 class UMFPACK : public SOL
 {
@@ -37,6 +44,13 @@ private:
     void*   Symbolic; ///< symbolic factorization from UMFPACK
     void*   Numeric;  ///< numeric factorization from UMFPACK
 
+    std::vector<int>    valMap; ///< position in Ax of each nonzero of the MAT
+    std::vector<int>    Wi;     ///< integer workspace for umfpack_di_wsolve
+    std::vector<double> W;      ///< real workspace for umfpack_di_wsolve
+
+    /// Copy values of A into Ax following the column-major ordering.
+    void CopyValues(const MAT& A);
+
 public:
     /// Default constructor.
     UMFPACK()
@@ -55,9 +69,15 @@ public:
     /// Setup the UMFPACK direct solver.
     FaspRetCode Setup(const MAT& A);
 
+    /// Numeric factorization only, for a matrix with the same sparsity pattern.
+    FaspRetCode Refactor(const MAT& A);
+
     /// Solve Ax=b using the the UMFPACK direct solver.
     FaspRetCode Solve(const VEC& b, VEC& x) override;
 
+    /// Solve AX=B for a block of right-hand sides with one numeric factorization.
+    FaspRetCode Solve(const std::vector<VEC>& b, std::vector<VEC>& x);
+
     /// Clean up UMFPACK data allocated during Setup.
     void Clean() override;
 };
@@ -70,4 +90,5 @@ public:
 /*  Author              Date             Actions                              */
 /*----------------------------------------------------------------------------*/
 /*  Chensong Zhang      Sep/17/2021      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Add Refactor and multi-RHS Solve     */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -15,6 +15,9 @@
 // FASPXX header files
 #include "VEC.hxx"
 
+/// Number of blocks of the dot product; at most this many threads are used.
+static const INT DOT_BLOCKS = 64;
+
 /// Assign the size and the same value to a VEC object.
 VEC::VEC(const USI& size, const DBL& value)
 {
@@ -25,7 +28,7 @@ VEC::VEC(const USI& size, const DBL& value)
 /// Assign a vector object to a VEC object.
 VEC::VEC(const std::vector<DBL>& src)
 {
-    this->values = src;
+    this->values.assign(src.begin(), src.end());
     this->size   = (USI)src.size();
 }
 
@@ -105,7 +108,7 @@ void VEC::SetValues(const USI& size, const DBL& value)
 /// Assign vector values to a VEC object.
 void VEC::SetValues(const std::vector<DBL>& src)
 {
-    this->values = src;
+    this->values.assign(src.begin(), src.end());
     this->size   = (USI)src.size();
 }
 
@@ -120,6 +123,7 @@ void VEC::SetValues(const USI& size, const DBL* array)
 
     INT i; // OpenMP only allows INT, but not unsigned integers 
     this->size = size;
+    this->values.resize(size);
 
     // Easy way is to use this->values.assign(array, array + size);
 #pragma omp parallel for private(i) shared(array)
@@ -464,24 +468,34 @@ DBL VEC::NormInf() const
     return (tmpNorm1 > tmpNorm3 ? tmpNorm1 : tmpNorm3);
 }
 
-/// Dot product with v, unroll long for loops.
+/// Dot product with v, unroll long for loops. The vector is cut into DOT_BLOCKS
+/// blocks whose sums are added in order, so the result does not depend on the
+/// number of threads or on the order in which they finish.
 DBL VEC::Dot(const VEC& v) const
 {
-    const INT len = this->size - this->size % 4;
-    INT       i;
-    DBL       dot1 = 0.0, dot2 = 0.0, dot3 = 0.0, dot4 = 0.0;
-
-#pragma omp parallel private(i)
-#pragma omp for reduction(+ : dot1, dot2, dot3, dot4)
-    for (i = 0; i < len; i += 4) {
-        dot1 += this->values[i] * v.values[i];
-        dot2 += this->values[i + 1] * v.values[i + 1];
-        dot3 += this->values[i + 2] * v.values[i + 2];
-        dot4 += this->values[i + 3] * v.values[i + 3];
+    const INT blockSize = ((this->size + DOT_BLOCKS - 1) / DOT_BLOCKS + 3) / 4 * 4;
+    DBL       dots[DOT_BLOCKS];
+
+#pragma omp parallel for
+    for (INT k = 0; k < DOT_BLOCKS; ++k) {
+        const INT begin = k * blockSize < (INT)size ? k * blockSize : (INT)size;
+        const INT end   = begin + blockSize < (INT)size ? begin + blockSize : (INT)size;
+        const INT len   = end - (end - begin) % 4;
+        INT       i;
+        DBL       dot1 = 0.0, dot2 = 0.0, dot3 = 0.0, dot4 = 0.0;
+        for (i = begin; i < len; i += 4) {
+            dot1 += this->values[i] * v.values[i];
+            dot2 += this->values[i + 1] * v.values[i + 1];
+            dot3 += this->values[i + 2] * v.values[i + 2];
+            dot4 += this->values[i + 3] * v.values[i + 3];
+        }
+        for (i = len; i < end; ++i) dot1 += this->values[i] * v.values[i];
+        dots[k] = dot1 + dot2 + dot3 + dot4;
     } /*-- End of omp for --*/
 
-    for (i = len; i < this->size; ++i) dot1 += this->values[i] * v.values[i];
-    return (dot1 + dot2 + dot3 + dot4);
+    DBL dot = 0.0;
+    for (INT k = 0; k < DOT_BLOCKS; ++k) dot += dots[k];
+    return dot;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -492,4 +506,7 @@ DBL VEC::Dot(const VEC& v) const
 /*  Chensong Zhang      Oct/13/2019      Create file                          */
 /*  Chensong Zhang      Sep/16/2021      Restructure file                     */
 /*  Chensong Zhang      Jan/24/2022      Test some OMP parallelization        */
+/*  Chensong Zhang      Oct/19/2026      Resize in SetValues from an array    */
+/*  Chensong Zhang      Oct/19/2026      Allow memory from a given resource   */
+/*  Chensong Zhang      Oct/19/2026      Dot independent of thread count      */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
@@ -9,10 +9,29 @@
  *-----------------------------------------------------------------------------------
  */
 
+/*! Important Note:
+ *-----------------------------------------------------------------------------------
+ *  The values are kept in a std::pmr::vector so that MG can put the work vectors of
+ *  all coarse levels in one arena. Every VEC therefore carries a polymorphic
+ *  allocator, one pointer to its memory resource; unless a resource is given to the
+ *  constructor, it is the default one, i.e., new and delete.
+ *
+ *  The resource stays with the VEC it was given to and is never passed on:
+ *
+ *  1. The copy constructor and, since VEC has no move constructor, also a "move"
+ *     (e.g., returning a VEC or growing a std::vector<VEC>) put the copy on the
+ *     heap, even if the source lives in an arena;
+ *  2. Assignment keeps the resource of the target; if the target has to grow
+ *     beyond its arena, the monotonic resource takes the memory from the heap.
+ *
+ *  So arena VECs have to be built in place, as MG::AllocWorkspace does.
+ */
+
 #ifndef __VEC_HEADER__ /*-- allow multiple inclusions --*/
 #define __VEC_HEADER__ /**< indicate VEC.hxx has been included before */
 
 // Standard header files
+#include <memory_resource>
 #include <vector>
 
 // FASPXX header files
@@ -26,8 +45,8 @@ class VEC
 {
 
 private:
-    USI              size;   ///< Book-keeping size of VEC. NOT values.size!
-    std::vector<DBL> values; ///< Actual values of vector in DBL.
+    USI                   size;   ///< Book-keeping size of VEC. NOT values.size!
+    std::pmr::vector<DBL> values; ///< Actual values of vector in DBL.
 
 public:
     friend class MAT;
@@ -38,6 +57,13 @@ public:
     {
     }
 
+    /// Construct an empty VEC taking memory from a resource, e.g. an arena.
+    explicit VEC(const std::pmr::polymorphic_allocator<DBL>& alloc)
+        : size(0)
+        , values(alloc)
+    {
+    }
+
     /// Construct a VEC with the given size and a constant value.
     explicit VEC(const USI& size, const DBL& value = 0.0);
 
@@ -154,4 +180,6 @@ public:
 /*----------------------------------------------------------------------------*/
 /*  Kailei Zhang        Sep/01/2019      Create file                          */
 /*  Chensong Zhang      Sep/16/2021      Restructure file                     */
+/*  Chensong Zhang      Oct/19/2026      Allow memory from a given resource   */
+/*  Chensong Zhang      Oct/19/2026      Note on the memory resource          */
 /*----------------------------------------------------------------------------*/
\ No newline at end of file
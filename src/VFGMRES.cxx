@@ -0,0 +1,43 @@
+/*! \file    VFGMRES.cxx
+ *  \brief   Variable-restarting flexible GMRES class definition
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// FASPXX header files
+#include "VFGMRES.hxx"
+
+/// Set up the VFGMRES method.
+FaspRetCode VFGMRES::Setup(const LOP& A)
+{
+    // Set solver type
+    SetSolType(SOLType::SOLVER_VFGMRES);
+
+    return SetupWork(A);
+}
+
+/// Choose the next restart number from the ratio of two restart residuals.
+void VFGMRES::UpdateRestart(double rate)
+{
+    if (rate > max_cr) // stagnation: use the largest subspace
+        restart = maxRestart;
+    else if (rate >= min_cr) { // moderate: shrink, cycle back to max at the bottom
+        if (restart > minRestart + decrease)
+            restart -= decrease;
+        else
+            restart = maxRestart;
+    } // fast convergence: keep the current restart number
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
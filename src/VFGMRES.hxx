@@ -0,0 +1,52 @@
+/*! \file    VFGMRES.hxx
+ *  \brief   Variable-restarting flexible GMRES class declaration
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#ifndef __VFGMRES_HEADER__ /*-- allow multiple inclusions --*/
+#define __VFGMRES_HEADER__ /**< indicate VFGMRES.hxx has been included before */
+
+// FASPXX header files
+#include "FGMRES.hxx"
+
+/*! \class VFGMRES
+ *  \brief Flexible GMRES with the restart number adapted between cycles.
+ *
+ *  The restart number stays between minRestart and maxRestart. After each cycle
+ *  the residual reduction rate decides the next one: a stagnating cycle jumps to
+ *  maxRestart, a moderate one shrinks it by a few vectors, and a fast one keeps it.
+ *  The basis is allocated for maxRestart vectors once, in Setup.
+ */
+class VFGMRES : public FGMRES
+{
+protected:
+    /// Choose the next restart number from the convergence rate.
+    void UpdateRestart(double rate) override;
+
+public:
+    /// Default constructor.
+    VFGMRES() = default;
+
+    /// Default destructor.
+    ~VFGMRES() = default;
+
+    /// Setup the VFGMRES method.
+    FaspRetCode Setup(const LOP& A) override;
+};
+
+#endif /* end if for __VFGMRES_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Fix header guard name                */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,283 @@
+/** \file    WriteData.cxx
+ *  \brief   Writing data to disk files
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+// Standard header files
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#ifndef _MSC_VER
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// FASPXX header files
+#include "Compress.hxx"
+#include "WriteData.hxx"
+
+/// Number of lines formatted as one block.
+static const size_t WRITE_BLOCK_LINES = 1 << 16;
+
+/// An output file written at explicit offsets.
+struct TextFile {
+#ifdef _MSC_VER
+    std::FILE* fp = nullptr; ///< file handle
+#else
+    int fd = -1; ///< file descriptor
+#endif
+    uint64_t offset   = 0;     ///< current end of the file
+    bool     compress = false; ///< whether to compress the blocks
+};
+
+/// Write a buffer at a given offset of the file.
+static bool WriteAt(TextFile& file, const std::vector<char>& buf, uint64_t offset)
+{
+#ifdef _MSC_VER
+    bool ok;
+#pragma omp critical(WriteAt)
+    ok = _fseeki64(file.fp, offset, SEEK_SET) == 0 &&
+         std::fwrite(buf.data(), 1, buf.size(), file.fp) == buf.size();
+    return ok;
+#else
+    for (size_t done = 0; done < buf.size();) {
+        const ssize_t n = pwrite(file.fd, buf.data() + done, buf.size() - done,
+                                 offset + done);
+        if (n <= 0) return false;
+        done += n;
+    }
+    return true;
+#endif
+}
+
+/// Close the output file.
+static FaspRetCode CloseTextFile(TextFile& file)
+{
+#ifdef _MSC_VER
+    if (file.fp == nullptr || std::fclose(file.fp) != 0)
+        return FaspRetCode::ERROR_OPEN_FILE;
+    file.fp = nullptr;
+#else
+    if (file.fd < 0 || close(file.fd) != 0) return FaspRetCode::ERROR_OPEN_FILE;
+    file.fd = -1;
+#endif
+    return FaspRetCode::SUCCESS;
+}
+
+/// Create a file; a compressed file starts with its signature.
+static FaspRetCode OpenTextFile(const char* filename, bool compress, TextFile& file)
+{
+    std::cout << "Writing to disk file " << filename << std::endl;
+#ifdef _MSC_VER
+    file.fp = std::fopen(filename, "wb");
+    if (file.fp == nullptr) return FaspRetCode::ERROR_OPEN_FILE;
+#else
+    file.fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (file.fd < 0) return FaspRetCode::ERROR_OPEN_FILE;
+#endif
+    file.compress = compress;
+    file.offset   = 0;
+    if (compress) {
+        std::vector<char> magic;
+        LZWriteMagic(magic);
+        if (!WriteAt(file, magic, 0)) {
+            CloseTextFile(file);
+            return FaspRetCode::ERROR_OPEN_FILE;
+        }
+        file.offset = magic.size();
+    }
+    return FaspRetCode::SUCCESS;
+}
+
+/// Append an unsigned integer and a separator.
+static void PutUSI(std::vector<char>& buf, uint64_t val, char sep)
+{
+    char       str[24];
+    const auto res = std::to_chars(str, str + sizeof(str), val);
+    buf.insert(buf.end(), str, res.ptr);
+    buf.push_back(sep);
+}
+
+/// Append a double in the shortest round-trip form and a separator.
+static void PutDBL(std::vector<char>& buf, DBL val, char sep)
+{
+    char       str[32];
+    const auto res = std::to_chars(str, str + sizeof(str), val);
+    buf.insert(buf.end(), str, res.ptr);
+    buf.push_back(sep);
+}
+
+/// Append a string.
+static void PutStr(std::vector<char>& buf, const char* str)
+{
+    buf.insert(buf.end(), str, str + std::strlen(str));
+}
+
+/// Format items in parallel blocks of size blockSize and write them in order.
+/// format(k, buf) appends the text of item k to buf.
+template <typename Func>
+static FaspRetCode WriteItems(TextFile& file, size_t numItems, size_t blockSize,
+                              Func format)
+{
+#ifdef _OPENMP
+    const size_t numThreads = omp_get_max_threads();
+#else
+    const size_t numThreads = 1;
+#endif
+    const size_t perRound = 4 * numThreads; // blocks kept in memory at once
+
+    std::vector<std::vector<char>> text(perRound), comp(perRound);
+    std::vector<uint64_t>          pos(perRound + 1, 0);
+
+    blockSize = std::max<size_t>(blockSize, 1);
+    for (size_t start = 0; start < numItems; start += perRound * blockSize) {
+        const INT numBlocks =
+            std::min(perRound, (numItems - start + blockSize - 1) / blockSize);
+        std::vector<std::vector<char>>& out = file.compress ? comp : text;
+
+        // Format (and compress) the blocks
+        INT b;
+#pragma omp parallel for private(b) schedule(dynamic)
+        for (b = 0; b < numBlocks; ++b) {
+            const size_t begin = start + b * blockSize;
+            const size_t end   = std::min(begin + blockSize, numItems);
+            text[b].clear();
+            for (size_t k = begin; k < end; ++k) format(k, text[b]);
+            if (file.compress) {
+                comp[b].clear();
+                LZCompressBlock(text[b].data(), text[b].size(), comp[b]);
+            }
+        }
+
+        // Each block goes to its own offset
+        for (b = 0; b < numBlocks; ++b) pos[b + 1] = pos[b] + out[b].size();
+
+        bool ok = true;
+#pragma omp parallel for private(b) schedule(dynamic)
+        for (b = 0; b < numBlocks; ++b) {
+            if (!WriteAt(file, out[b], file.offset + pos[b])) {
+#pragma omp critical
+                ok = false;
+            }
+        }
+        if (!ok) return FaspRetCode::ERROR_OPEN_FILE;
+        file.offset += pos[numBlocks];
+    }
+
+    return FaspRetCode::SUCCESS;
+}
+
+/// Write a VEC to a disk file: size in the first line, then one entry per line.
+FaspRetCode WriteVEC(const char* filename, const VEC& vec, bool compress)
+{
+    TextFile    file;
+    FaspRetCode retCode = OpenTextFile(filename, compress, file);
+    if (retCode < 0) return retCode;
+
+    const DBL* val;
+    vec.GetArray(&val);
+    const size_t len = vec.GetSize();
+
+    // The header is item 0 and entry k is item k+1
+    retCode = WriteItems(file, len + 1, WRITE_BLOCK_LINES,
+                         [&](size_t k, std::vector<char>& buf) {
+                             if (k == 0)
+                                 PutUSI(buf, len, '\n');
+                             else
+                                 PutDBL(buf, val[k - 1], '\n');
+                         });
+
+    const FaspRetCode closeCode = CloseTextFile(file);
+    return (retCode < 0) ? retCode : closeCode;
+}
+
+/// Write a MAT to a disk file in CSR format: sizes, rowPtr, colInd, and values.
+FaspRetCode WriteCSR(const char* filename, const MAT& mat, bool compress)
+{
+    TextFile    file;
+    FaspRetCode retCode = OpenTextFile(filename, compress, file);
+    if (retCode < 0) return retCode;
+
+    const size_t numPtr = mat.rowPtr.size(), nnz = mat.colInd.size();
+    const size_t numVal = mat.values.size(); // zero for a sparsity structure
+
+    // Item 0 is the header, followed by rowPtr, colInd, and values
+    retCode = WriteItems(file, 1 + numPtr + nnz + numVal, WRITE_BLOCK_LINES,
+                         [&](size_t k, std::vector<char>& buf) {
+                             if (k == 0) {
+                                 PutUSI(buf, mat.nrow, ' ');
+                                 PutUSI(buf, mat.mcol, ' ');
+                                 PutUSI(buf, mat.nnz, '\n');
+                             } else if (k <= numPtr) {
+                                 PutUSI(buf, mat.rowPtr[k - 1], '\n');
+                             } else if (k <= numPtr + nnz) {
+                                 PutUSI(buf, mat.colInd[k - 1 - numPtr], '\n');
+                             } else {
+                                 PutDBL(buf, mat.values[k - 1 - numPtr - nnz], '\n');
+                             }
+                         });
+
+    const FaspRetCode closeCode = CloseTextFile(file);
+    return (retCode < 0) ? retCode : closeCode;
+}
+
+/// Write a MAT to a disk file in MTX format with 1-based indices.
+FaspRetCode WriteMTX(const char* filename, const MAT& mat, bool compress)
+{
+    TextFile    file;
+    FaspRetCode retCode = OpenTextFile(filename, compress, file);
+    if (retCode < 0) return retCode;
+
+    const size_t nrow = mat.rowPtr.empty() ? 0 : mat.nrow;
+    const bool   pattern = mat.values.empty(); // sparsity structure only
+
+    // Item 0 is the header and item i+1 holds all entries of row i
+    const size_t rowsPerBlock =
+        std::max<size_t>(1, WRITE_BLOCK_LINES * nrow / std::max<size_t>(1, mat.nnz));
+    retCode = WriteItems(
+        file, nrow + 1, rowsPerBlock, [&](size_t k, std::vector<char>& buf) {
+            if (k == 0) {
+                PutStr(buf, pattern ? "%%MatrixMarket matrix coordinate pattern general\n"
+                                    : "%%MatrixMarket matrix coordinate real general\n");
+                PutUSI(buf, mat.nrow, ' ');
+                PutUSI(buf, mat.mcol, ' ');
+                PutUSI(buf, mat.nnz, '\n');
+                return;
+            }
+            const size_t i = k - 1;
+            for (USI j = mat.rowPtr[i]; j < mat.rowPtr[i + 1]; ++j) {
+                PutUSI(buf, i + 1, ' ');
+                if (pattern) {
+                    PutUSI(buf, mat.colInd[j] + 1, '\n');
+                } else {
+                    PutUSI(buf, mat.colInd[j] + 1, ' ');
+                    PutDBL(buf, mat.values[j], '\n');
+                }
+            }
+        });
+
+    const FaspRetCode closeCode = CloseTextFile(file);
+    return (retCode < 0) ? retCode : closeCode;
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,45 @@
+/** \file    WriteData.hxx
+ *  \brief   Writing data to disk files
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2019--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+/*! Important Note:
+ *-----------------------------------------------------------------------------------
+ *  The writers produce the same text formats as ReadData reads. Numbers are
+ *  formatted with std::to_chars in the shortest form which reads back to the same
+ *  value. The output is cut into blocks that are formatted (and compressed if asked)
+ *  in parallel, and each block is written at its own offset with pwrite. Compressed
+ *  files, see Compress.hxx, are recognized and decompressed by ReadData.
+ */
+
+#ifndef __WRITEDATA__HEADER__ /*-- allow multiple inclusions --*/
+#define __WRITEDATA__HEADER__ /**< indicate WriteData.hxx has been included before */
+
+// FASPXX header files
+#include "Faspxx.hxx"
+#include "MAT.hxx"
+
+/// Write a VEC to a disk file: size in the first line, then one entry per line
+FaspRetCode WriteVEC(const char* filename, const VEC& vec, bool compress = false);
+
+/// Write a MAT to a disk file in CSR format
+FaspRetCode WriteCSR(const char* filename, const MAT& mat, bool compress = false);
+
+/// Write a MAT to a disk file in MTX format
+FaspRetCode WriteMTX(const char* filename, const MAT& mat, bool compress = false);
+
+#endif /* end if for __WRITEDATA__HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,88 @@
+/*! \file    AllocTestsKrylov.cxx
+ *  \brief   Allocation tests for the reusable Krylov solver interface
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+/*! Important Note:
+ *-----------------------------------------------------------------------------------
+ *  The global operator new is replaced here to count allocations. This affects
+ *  every allocation of the program, so this file is built into its own executable
+ *  'AllocTests' and must not be added to 'UnitTests'.
+ */
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+
+#include "../catch.hxx"
+#include "Krylov.hxx"
+#include "TestMatrices.hxx"
+
+/// Number of calls to the global operator new, to check for allocations in Solve.
+static std::atomic<size_t> numAllocs(0);
+
+void* operator new(size_t size)
+{
+    ++numAllocs;
+    void* p = std::malloc(size > 0 ? size : 1);
+    if (p == nullptr) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+TEST_CASE("KrylovAlloc")
+{
+    std::cout << "TEST allocations of reusable Krylov solver" << std::endl;
+
+    // 5-point Laplacian on a 32 x 32 grid
+    const USI N = 32, n = N * N;
+    MAT       A = ConvDiff2D(N, 0.0);
+    Identity  pcd;
+
+    VEC b1(n), b2(n), x(n);
+    for (USI i = 0; i < n; i++) {
+        b1[i] = 1.0;
+        b2[i] = std::sin(0.1 * i);
+    }
+
+    SOLParams params;
+    params.maxIter = 1000;
+    params.relTol  = 1e-10;
+    params.absTol  = 0.0;
+
+    SECTION("Repeated solves allocate nothing")
+    {
+        for (const char* name : {"cg", "bicgstab", "gmres"}) {
+            params.algName = name;
+            KrylovSolver solver;
+            REQUIRE(solver.Setup(A, pcd, params) == FaspRetCode::SUCCESS);
+
+            for (const VEC* b : {&b1, &b2, &b1}) {
+                x.SetValues(n, 0.0);
+                const size_t numAllocsOld = numAllocs;
+                const auto   retCode      = solver.Solve(*b, x);
+                const size_t numAllocsNew = numAllocs;
+                REQUIRE(retCode == FaspRetCode::SUCCESS);
+                REQUIRE(numAllocsNew == numAllocsOld);
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,60 @@
+/*! \file    TestMatrices.hxx
+ *  \brief   Model problems shared by the unit tests
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#ifndef __TESTMATRICES_HEADER__ /*-- allow multiple inclusions --*/
+#define __TESTMATRICES_HEADER__ /**< indicate TestMatrices.hxx has been included */
+
+// Standard header files
+#include <vector>
+
+// FASPXX header files
+#include "MAT.hxx"
+#include "StencilOp.hxx"
+
+/// Central difference convection-diffusion on an N x N grid with cell Peclet
+/// number pe and diagonal entry diag; pe = 0 gives the 5-point Laplacian.
+inline MAT ConvDiff2D(USI N, DBL pe, DBL diag = 4.0)
+{
+    const DBL               west = -1.0 - 0.5 * pe, east = -1.0 + 0.5 * pe;
+    StencilOp<STENCIL_5P2D> op(N, N, 1, {west, west, diag, east, east});
+    MAT                     mat;
+    op.ToMAT(mat);
+    return mat;
+}
+
+/// The same with diagonal entry diag[i] in row i.
+inline MAT ConvDiff2D(USI N, DBL pe, const std::vector<DBL>& diag)
+{
+    const USI        n    = N * N;
+    const DBL        west = -1.0 - 0.5 * pe, east = -1.0 + 0.5 * pe;
+    std::vector<DBL> coef(STENCIL_5P2D * n);
+    for (USI i = 0; i < n; i++) {
+        coef[i]         = west;
+        coef[n + i]     = west;
+        coef[2 * n + i] = diag[i];
+        coef[3 * n + i] = east;
+        coef[4 * n + i] = east;
+    }
+    StencilOp<STENCIL_5P2D> op(N, N, 1, coef);
+    MAT                     mat;
+    op.ToMAT(mat);
+    return mat;
+}
+
+#endif /* end if for __TESTMATRICES_HEADER__ */
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
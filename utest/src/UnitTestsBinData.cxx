@@ -0,0 +1,93 @@
+/*! \file    UnitTestsBinData.cxx
+ *  \brief   Unit tests for binary data files
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include "../catch.hxx"
+#include "BinData.hxx"
+#include "TestMatrices.hxx"
+
+TEST_CASE("BinData")
+{
+    std::cout << "TEST binary data files" << std::endl;
+
+    const USI        m = 30, n = m * m;
+    std::vector<DBL> diag(n);
+    for (USI k = 0; k < n; k++) diag[k] = 4.0 + 0.01 * k;
+    const MAT mat = ConvDiff2D(m, 0.0, diag);
+
+    VEC x(n), y(n), z(n);
+    for (USI i = 0; i < n; i++) x[i] = std::sin(0.1 * i);
+
+    SECTION("MAT round trip and zero-copy map")
+    {
+        REQUIRE(WriteBinMAT("utest_mat.bin", mat) == FaspRetCode::SUCCESS);
+
+        MATMap map;
+        REQUIRE(map.Open("utest_mat.bin") == FaspRetCode::SUCCESS);
+        REQUIRE(map.GetRowSize() == n);
+        REQUIRE(map.GetNNZ() == mat.GetNNZ());
+        REQUIRE((size_t)map.GetValuesArray() % BIN_ALIGN == 0);
+
+        mat.Apply(x, y);
+        map.Apply(x, z);
+        for (USI i = 0; i < n; i++) REQUIRE(y[i] == z[i]);
+
+        MAT copy;
+        REQUIRE(ReadBinMAT("utest_mat.bin", copy) == FaspRetCode::SUCCESS);
+        REQUIRE(copy.GetNNZ() == mat.GetNNZ());
+        for (USI i = 0; i < n; i++) REQUIRE(copy.GetValue(i, i) == mat.GetValue(i, i));
+
+        map.Close();
+        std::remove("utest_mat.bin");
+    }
+
+    SECTION("VEC round trip")
+    {
+        REQUIRE(WriteBinVEC("utest_vec.bin", x) == FaspRetCode::SUCCESS);
+        VEC v;
+        REQUIRE(ReadBinVEC("utest_vec.bin", v) == FaspRetCode::SUCCESS);
+        REQUIRE(v.GetSize() == n);
+        for (USI i = 0; i < n; i++) REQUIRE(v[i] == x[i]);
+        MAT wrong;
+        REQUIRE(ReadBinMAT("utest_vec.bin", wrong) == FaspRetCode::ERROR_INPUT_FILE);
+        std::remove("utest_vec.bin");
+    }
+
+    SECTION("Corrupted data is detected")
+    {
+        REQUIRE(WriteBinMAT("utest_bad.bin", mat) == FaspRetCode::SUCCESS);
+        {
+            std::fstream f("utest_bad.bin", std::ios::in | std::ios::out | std::ios::binary);
+            f.seekp(sizeof(BinHeader) + BIN_ALIGN + 8); // inside rowPtr
+            const char junk = 0x5a;
+            f.write(&junk, 1);
+        }
+
+        MATMap map;
+        REQUIRE(map.Open("utest_bad.bin") == FaspRetCode::ERROR_INPUT_FILE);
+        REQUIRE(map.Open("utest_bad.bin", false) == FaspRetCode::SUCCESS);
+        std::remove("utest_bad.bin");
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Use shared test matrices             */
+/*----------------------------------------------------------------------------*/
+
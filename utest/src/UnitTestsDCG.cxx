@@ -0,0 +1,72 @@
+/*! \file    UnitTestsDCG.cxx
+ *  \brief   Unit tests for the deflated CG method
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#include <cmath>
+#include <vector>
+
+#include "../catch.hxx"
+#include "CG.hxx"
+#include "DCG.hxx"
+#include "Iter.hxx"
+#include "TestMatrices.hxx"
+
+TEST_CASE("DCG")
+{
+    std::cout << "TEST deflated CG" << std::endl;
+
+    const USI N = 32, n = N * N;
+    VEC       b(n), x(n), r(n);
+    Identity  pcd;
+
+    CG cg;
+    cg.SetMaxIter(1000);
+    cg.SetRelTol(1e-8);
+    cg.SetupPCD(pcd);
+
+    DCG dcg;
+    dcg.SetMaxIter(1000);
+    dcg.SetRelTol(1e-8);
+    dcg.SetNumDeflate(8, 40);
+    dcg.SetupPCD(pcd);
+
+    // A sequence of slowly changing systems, as from implicit time stepping
+    USI iterCG = 0, iterDCG = 0;
+    for (USI step = 0; step < 5; step++) {
+        MAT A = ConvDiff2D(N, 0.0, 4.0 + 1e-4 * step);
+        for (USI i = 0; i < n; i++) b[i] = 1.0 + std::sin(0.01 * i * (step + 1));
+
+        REQUIRE(cg.Setup(A) == FaspRetCode::SUCCESS);
+        x.SetValues(n, 0.0);
+        REQUIRE(cg.Solve(b, x) == FaspRetCode::SUCCESS);
+        iterCG = cg.GetIterations();
+
+        REQUIRE(dcg.Setup(A) == FaspRetCode::SUCCESS);
+        x.SetValues(n, 0.0);
+        REQUIRE(dcg.Solve(b, x) == FaspRetCode::SUCCESS);
+        iterDCG = dcg.GetIterations();
+        A.Residual(b, x, r);
+        REQUIRE(r.Norm2() < 1e-7 * b.Norm2());
+        REQUIRE(dcg.GetNumDeflated() == 8);
+
+        // Without a deflation space the first solve is plain PCG
+        if (step == 0) REQUIRE(iterDCG == iterCG);
+    }
+    REQUIRE(iterDCG < 0.8 * iterCG);
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Use shared test matrices             */
+/*----------------------------------------------------------------------------*/
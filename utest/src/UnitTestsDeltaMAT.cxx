@@ -0,0 +1,88 @@
+/*! \file    UnitTestsDeltaMAT.cxx
+ *  \brief   Unit tests for DeltaMAT class
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#include <cmath>
+#include <vector>
+
+#include "../catch.hxx"
+#include "DeltaMAT.hxx"
+
+/// 7-point finite difference matrix on an m x m x m grid.
+static MAT Laplace3D(USI m)
+{
+    std::vector<DBL> values;
+    std::vector<USI> colInd, rowPtr(1, 0);
+    const USI        mm = m * m;
+    for (USI k = 0; k < m; k++) {
+        for (USI j = 0; j < m; j++) {
+            for (USI i = 0; i < m; i++) {
+                const USI p = k * mm + j * m + i;
+                if (k > 0) values.push_back(-1.0), colInd.push_back(p - mm);
+                if (j > 0) values.push_back(-1.0), colInd.push_back(p - m);
+                if (i > 0) values.push_back(-1.0), colInd.push_back(p - 1);
+                values.push_back(6.0 + 1e-3 * p), colInd.push_back(p);
+                if (i + 1 < m) values.push_back(-1.0), colInd.push_back(p + 1);
+                if (j + 1 < m) values.push_back(-1.0), colInd.push_back(p + m);
+                if (k + 1 < m) values.push_back(-1.0), colInd.push_back(p + mm);
+                rowPtr.push_back(colInd.size());
+            }
+        }
+    }
+    return MAT(m * mm, m * mm, colInd.size(), values, colInd, rowPtr);
+}
+
+TEST_CASE("DeltaMAT")
+{
+    std::cout << "TEST DeltaMAT compressed column indices" << std::endl;
+
+    SECTION("7-point stencil with 8- and 16-bit differences")
+    {
+        const USI m = 24, n = m * m * m;
+        const MAT mat = Laplace3D(m);
+        DeltaMAT  dmat(mat);
+
+        VEC x(n), b(n), y(n), z(n);
+        for (USI i = 0; i < n; i++) x[i] = std::sin(0.37 * i), b[i] = std::cos(0.1 * i);
+
+        mat.Apply(x, y);
+        dmat.Apply(x, z);
+        for (USI i = 0; i < n; i++) REQUIRE(y[i] == z[i]);
+
+        mat.Residual(b, x, y);
+        dmat.Residual(b, x, z);
+        for (USI i = 0; i < n; i++) REQUIRE(y[i] == z[i]);
+
+        REQUIRE(dmat.GetNNZ() == mat.GetNNZ());
+        REQUIRE(dmat.GetBytes() < 9 * (size_t)mat.GetNNZ());
+    }
+
+    SECTION("Far columns use the absolute escape")
+    {
+        const USI        n = 70000;
+        std::vector<DBL> values;
+        std::vector<USI> colInd, rowPtr(1, 0);
+        for (USI i = 0; i < n; i++) {
+            const USI far = (i * 7919u + 40000u) % n;
+            if (far < i) values.push_back(0.5), colInd.push_back(far);
+            values.push_back(2.0), colInd.push_back(i);
+            if (far > i) values.push_back(-0.25), colInd.push_back(far);
+            rowPtr.push_back(colInd.size());
+        }
+        const MAT mat(n, n, colInd.size(), values, colInd, rowPtr);
+        DeltaMAT  dmat(mat);
+
+        VEC x(n), y(n), z(n);
+        for (USI i = 0; i < n; i++) x[i] = 1.0 / (1.0 + i);
+        mat.Apply(x, y);
+        dmat.Apply(x, z);
+        for (USI i = 0; i < n; i++) REQUIRE(y[i] == z[i]);
+    }
+}
@@ -0,0 +1,79 @@
+/*! \file    UnitTestsDenseLU.cxx
+ *  \brief   Unit tests for DenseLU class
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#include <cmath>
+#include <vector>
+
+#include "../catch.hxx"
+#include "DenseLU.hxx"
+
+TEST_CASE("DenseLU")
+{
+    std::cout << "TEST DenseLU direct solver" << std::endl;
+
+    using std::vector;
+
+    SECTION("Pivoting required")
+    {
+        // zero (0,0) entry forces a row exchange
+        const vector<DBL> values  = {0, 1, 2, 3, 4, 5, 2, 1, 2, 1};
+        const vector<USI> colInd  = {0, 2, 0, 1, 3, 0, 2, 3, 2, 3};
+        const vector<USI> rowPtr  = {0, 2, 5, 8, 10};
+        const vector<USI> diagPtr = {0, 3, 6, 9};
+        const MAT         mat(4, 4, 10, values, colInd, rowPtr, diagPtr);
+
+        const VEC xstar(vector<DBL>({1.0, -2.0, 3.0, -4.0}));
+        VEC       b(4), x(4, 0.0);
+        mat.Apply(xstar, b);
+
+        DenseLU solver;
+        REQUIRE(solver.Setup(mat) == FaspRetCode::SUCCESS);
+        REQUIRE(solver.Solve(b, x) == FaspRetCode::SUCCESS);
+        for (USI i = 0; i < 4; i++) REQUIRE(std::abs(x[i] - xstar[i]) < 1e-12);
+    }
+
+    SECTION("Blocked factorization")
+    {
+        // 1D Laplacian plus a nonsymmetric coupling; several panels of width 4
+        const USI   n = 37;
+        vector<DBL> values;
+        vector<USI> colInd, rowPtr(1, 0);
+        for (USI i = 0; i < n; i++) {
+            if (i > 0) values.push_back(-1.0), colInd.push_back(i - 1);
+            values.push_back(2.5), colInd.push_back(i);
+            if (i + 1 < n) values.push_back(-1.2), colInd.push_back(i + 1);
+            rowPtr.push_back(colInd.size());
+        }
+        const MAT mat(n, n, colInd.size(), values, colInd, rowPtr);
+
+        VEC xstar(n), b(n), x(n, 0.0);
+        for (USI i = 0; i < n; i++) xstar[i] = std::sin(1.0 + i);
+        mat.Apply(xstar, b);
+
+        DenseLU solver;
+        solver.SetBlockSize(4);
+        REQUIRE(solver.Setup(mat) == FaspRetCode::SUCCESS);
+
+        // factors are reused for several right-hand sides
+        for (USI k = 0; k < 2; k++) {
+            REQUIRE(solver.Solve(b, x) == FaspRetCode::SUCCESS);
+            for (USI i = 0; i < n; i++) REQUIRE(std::abs(x[i] - xstar[i]) < 1e-12);
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
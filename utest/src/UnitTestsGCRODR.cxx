@@ -0,0 +1,178 @@
+/*! \file    UnitTestsGCRODR.cxx
+ *  \brief   Unit tests for GMRES-DR and GCRO-DR
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "../catch.hxx"
+#include "DenseUtil.hxx"
+#include "GCRODR.hxx"
+#include "GMRES.hxx"
+#include "Iter.hxx"
+
+/// 1D convection-diffusion with a shift: a mildly nonsymmetric tridiagonal matrix.
+static MAT ConvDiff(USI m, DBL shift)
+{
+    std::vector<DBL> values;
+    std::vector<USI> colInd, rowPtr(1, 0);
+    for (USI i = 0; i < m; i++) {
+        if (i > 0) values.push_back(-1.02), colInd.push_back(i - 1);
+        values.push_back(2.0 + shift), colInd.push_back(i);
+        if (i + 1 < m) values.push_back(-0.98), colInd.push_back(i + 1);
+        rowPtr.push_back(colInd.size());
+    }
+    return MAT(m, m, values.size(), values, colInd, rowPtr);
+}
+
+TEST_CASE("GCRODR")
+{
+    std::cout << "TEST GMRES-DR and GCRO-DR" << std::endl;
+
+    const USI m = 400;
+    VEC       b(m), x(m), r(m);
+    Identity  pcd;
+    for (USI i = 0; i < m; i++) b[i] = 1.0 + std::sin(0.1 * i);
+
+    SECTION("Dense eigenvalues of a small nonsymmetric matrix")
+    {
+        // Companion-like matrix with eigenvalues 1, 2 and +-i
+        const USI        n = 4;
+        std::vector<DBL> A(n * n, 0.0), wr, wi;
+        const DBL        c[4] = {-2.0, 3.0, -3.0, 3.0}; // (t-1)(t-2)(t^2+1)
+        for (USI i = 1; i < n; i++) A[i + (i - 1) * n] = 1.0;
+        for (USI i = 0; i < n; i++) A[i + (n - 1) * n] = c[i];
+        REQUIRE(DenseEigValues(n, A, wr, wi) == FaspRetCode::SUCCESS);
+        USI numReal = 0;
+        for (USI i = 0; i < n; i++) {
+            if (wi[i] == 0.0) {
+                numReal++;
+                REQUIRE(std::min(std::fabs(wr[i] - 1.0), std::fabs(wr[i] - 2.0)) <
+                        1e-10);
+            } else {
+                REQUIRE(std::fabs(wr[i]) < 1e-10);
+                REQUIRE(std::fabs(std::fabs(wi[i]) - 1.0) < 1e-10);
+            }
+        }
+        REQUIRE(numReal == 2);
+        REQUIRE(std::fabs(wr[0] + wr[1] + wr[2] + wr[3] - 3.0) < 1e-10);
+    }
+
+    SECTION("Dense eigenvalues keep trace and conjugate pairs")
+    {
+        // Nonsymmetric 30 x 30 matrix with a cluster: sum of eigenvalues and of their
+        // squares are the traces of A and A^2
+        const USI        n = 30;
+        std::vector<DBL> A(n * n), wr, wi;
+        for (USI j = 0; j < n; j++)
+            for (USI i = 0; i < n; i++)
+                A[i + j * n] = (i == j) ? 1.0 + (i % 3) : 0.01 * std::sin(i + 2.0 * j);
+        DBL trace = 0.0, trace2 = 0.0;
+        for (USI i = 0; i < n; i++) {
+            trace += A[i + i * n];
+            for (USI l = 0; l < n; l++) trace2 += A[i + l * n] * A[l + i * n];
+        }
+
+        REQUIRE(DenseEigValues(n, A, wr, wi) == FaspRetCode::SUCCESS);
+        DBL sum = 0.0, sum2 = 0.0;
+        for (USI i = 0; i < n; i++) {
+            sum += wr[i];
+            sum2 += wr[i] * wr[i] - wi[i] * wi[i];
+            if (wi[i] > 0.0) {
+                REQUIRE(wr[i + 1] == wr[i]);
+                REQUIRE(wi[i + 1] == -wi[i]);
+            }
+        }
+        REQUIRE(std::fabs(sum - trace) < 1e-12 * n);
+        REQUIRE(std::fabs(sum2 - trace2) < 1e-12 * n);
+    }
+
+    SECTION("Dense solve with several right-hand sides")
+    {
+        const USI        n = 5, nrhs = 2;
+        std::vector<DBL> A(n * n), LU, X(n * nrhs), B(n * nrhs, 0.0);
+        for (USI j = 0; j < n; j++)
+            for (USI i = 0; i < n; i++)
+                A[i + j * n] = (i == j) ? 0.1 : 1.0 / (1.0 + i + 2.0 * j);
+        for (USI k = 0; k < n * nrhs; k++) X[k] = std::cos(1.0 + k);
+        for (USI r = 0; r < nrhs; r++)
+            for (USI j = 0; j < n; j++)
+                for (USI i = 0; i < n; i++) B[i + r * n] += A[i + j * n] * X[j + r * n];
+
+        LU = A;
+        REQUIRE(DenseSolve(n, LU.data(), nrhs, B.data()) == FaspRetCode::SUCCESS);
+        for (USI k = 0; k < n * nrhs; k++) REQUIRE(std::fabs(B[k] - X[k]) < 1e-12);
+
+        std::vector<DBL> Z(n * n, 0.0);
+        const auto       retCode = DenseSolve(n, Z.data(), nrhs, B.data());
+        REQUIRE(retCode == FaspRetCode::ERROR_DIVIDE_ZERO);
+    }
+
+    SECTION("Deflated restarting beats plain restarting")
+    {
+        MAT A = ConvDiff(m, 0.0);
+
+        GMRES gmres;
+        gmres.SetMaxIter(3000);
+        gmres.SetRelTol(1e-8);
+        gmres.SetRestart(20);
+        gmres.SetupPCD(pcd);
+        REQUIRE(gmres.Setup(A) == FaspRetCode::SUCCESS);
+        x.SetValues(m, 0.0);
+        gmres.Solve(b, x);
+
+        GMRESDR gmresdr;
+        gmresdr.SetMaxIter(3000);
+        gmresdr.SetRelTol(1e-8);
+        gmresdr.SetRestart(20);
+        gmresdr.SetNumDeflate(8);
+        gmresdr.SetupPCD(pcd);
+        REQUIRE(gmresdr.Setup(A) == FaspRetCode::SUCCESS);
+        x.SetValues(m, 0.0);
+        REQUIRE(gmresdr.Solve(b, x) == FaspRetCode::SUCCESS);
+        A.Residual(b, x, r);
+        REQUIRE(r.Norm2() < 1e-7 * b.Norm2());
+        REQUIRE(gmresdr.GetIterations() < gmres.GetIterations());
+    }
+
+    SECTION("Recycled space speeds up the next system")
+    {
+        MAT A1 = ConvDiff(m, 0.0), A2 = ConvDiff(m, 1e-3);
+
+        GCRODR gcrodr;
+        gcrodr.SetMaxIter(3000);
+        gcrodr.SetRelTol(1e-8);
+        gcrodr.SetRestart(20);
+        gcrodr.SetNumDeflate(8);
+        gcrodr.SetupPCD(pcd);
+        REQUIRE(gcrodr.Setup(A1) == FaspRetCode::SUCCESS);
+        x.SetValues(m, 0.0);
+        REQUIRE(gcrodr.Solve(b, x) == FaspRetCode::SUCCESS);
+        const USI first = gcrodr.GetIterations();
+        REQUIRE(gcrodr.GetNumRecycled() > 0);
+
+        REQUIRE(gcrodr.Setup(A2) == FaspRetCode::SUCCESS);
+        x.SetValues(m, 0.0);
+        REQUIRE(gcrodr.Solve(b, x) == FaspRetCode::SUCCESS);
+        A2.Residual(b, x, r);
+        REQUIRE(r.Norm2() < 1e-7 * b.Norm2());
+        REQUIRE(gcrodr.GetIterations() < first);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Check eigenvalues and dense solve    */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,163 @@
+/*! \file    UnitTestsGMG.cxx
+ *  \brief   Unit tests for geometric multigrid
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#include <cmath>
+#include <vector>
+
+#include "../catch.hxx"
+#include "GMG.hxx"
+
+/// Number of cycles needed to reduce the residual of Ax = 1 by 1e-8.
+template <StencilShape S>
+static USI NumCycles(const StencilOp<S>& A, GMGCoarse type,
+                     CycleType cycle = CYCLE_V, USI numCycles = 1)
+{
+    GMG gmg;
+    gmg.SetCoarseType(type);
+    gmg.SetMaxIter(50);
+    gmg.SetRelTol(1e-8);
+    REQUIRE(gmg.Setup(A) == FaspRetCode::SUCCESS);
+    REQUIRE(gmg.GetNumLevels() > 2);
+    gmg.SetCycleType(cycle);
+    gmg.SetNumCycles(numCycles);
+
+    VEC b(A.GetRowSize(), 1.0), x(A.GetRowSize(), 0.0);
+    gmg.Solve(b, x);
+    return gmg.GetIterations();
+}
+
+TEST_CASE("GMG")
+{
+    std::cout << "TEST geometric multigrid on stencils" << std::endl;
+
+    SECTION("Full weighting is the adjoint of bilinear prolongation")
+    {
+        for (bool is3D : {false, true}) {
+            const USI     nx = 9, ny = 7, nz = is3D ? 5 : 1;
+            FullWeighting R(nx, ny, nz, is3D);
+            Bilinear      P(nx, ny, nz, is3D);
+            REQUIRE(R.GetRowSize() == P.GetColSize());
+            REQUIRE(R.GetColSize() == P.GetRowSize());
+
+            VEC u(R.GetColSize()), v(R.GetRowSize()), Ru, Pv;
+            for (USI i = 0; i < u.GetSize(); i++) u[i] = std::sin(1.3 * i);
+            for (USI i = 0; i < v.GetSize(); i++) v[i] = std::cos(0.7 * i);
+            R.Apply(u, Ru);
+            P.Apply(v, Pv);
+            REQUIRE(std::abs(Ru.Dot(v) * (is3D ? 8 : 4) - u.Dot(Pv)) < 1e-12);
+        }
+    }
+
+    SECTION("Red-black Gauss-Seidel reduces the error")
+    {
+        StencilOp<STENCIL_5P2D> A(15, 15, 1, {-1.0, -1.0, 4.0, -1.0, -1.0});
+        RBGS<STENCIL_5P2D>      gs;
+        gs.SetMaxIter(20);
+        REQUIRE(gs.Setup(A) == FaspRetCode::SUCCESS);
+
+        VEC b(A.GetRowSize(), 0.0), x(A.GetRowSize(), 1.0), r;
+        gs.Solve(b, x);
+        A.Residual(b, x, r);
+        REQUIRE(r.Norm2() < 0.5 * std::sqrt(A.GetRowSize()));
+    }
+
+    SECTION("Mesh-independent convergence in 2D")
+    {
+        StencilOp<STENCIL_5P2D> A(63, 63, 1, {-1.0, -1.0, 4.0, -1.0, -1.0});
+        StencilOp<STENCIL_5P2D> B(127, 127, 1, {-1.0, -1.0, 4.0, -1.0, -1.0});
+        REQUIRE(NumCycles(A, GMG_REDISCRETIZE) <= 10);
+        REQUIRE(NumCycles(B, GMG_REDISCRETIZE) <= 10);
+        REQUIRE(NumCycles(B, GMG_GALERKIN) <= 10);
+    }
+
+    SECTION("Variable coefficients and 3D stencils")
+    {
+        const USI        n = 63 * 63;
+        std::vector<DBL> coef(5 * n);
+        for (USI i = 0; i < n; i++) {
+            const DBL a = 1.0 + 0.5 * std::sin(0.01 * i);
+            coef[i] = coef[n + i] = coef[3 * n + i] = coef[4 * n + i] = -a;
+            coef[2 * n + i]                                           = 4.0 * a;
+        }
+        StencilOp<STENCIL_5P2D> A(63, 63, 1, coef);
+        REQUIRE(NumCycles(A, GMG_GALERKIN) <= 15);
+
+        StencilOp<STENCIL_7P3D> B(31, 31, 31, {-1.0, -1.0, -1.0, 6.0, -1.0, -1.0, -1.0});
+        REQUIRE(NumCycles(B, GMG_REDISCRETIZE) <= 15);
+        REQUIRE(NumCycles(B, GMG_GALERKIN) <= 15);
+    }
+
+    SECTION("F-cycle and full multigrid")
+    {
+        const USI               m = 127, n = m * m;
+        const DBL               h = 1.0 / (m + 1), pi = 3.14159265358979323846;
+        StencilOp<STENCIL_5P2D> A(m, m, 1, {-1.0, -1.0, 4.0, -1.0, -1.0});
+
+        // -Laplace(u) = f with u = sin(pi x) sin(pi y), scaled by h^2
+        VEC b(n), u(n), x(n, 0.0), e;
+        for (USI j = 0; j < m; j++) {
+            for (USI i = 0; i < m; i++) {
+                u[j * m + i] = std::sin(pi * (i + 1) * h) * std::sin(pi * (j + 1) * h);
+                b[j * m + i] = 2.0 * pi * pi * h * h * u[j * m + i];
+            }
+        }
+
+        GMG gmg;
+        gmg.SetCycleType(CYCLE_F);
+        gmg.SetRelTol(1e-10);
+        gmg.SetMaxIter(50);
+        REQUIRE(gmg.Setup(A) == FaspRetCode::SUCCESS);
+        gmg.Solve(b, x);
+        REQUIRE(gmg.GetIterations() <= 10);
+
+        e = x;
+        e.XPAY(-1.0, u);
+        const DBL discErr = e.NormInf(); // discretization error
+
+        // One full multigrid pass reaches the discretization error
+        gmg.SetCycleType(CYCLE_V);
+        gmg.SetFullMG(true);
+        gmg.SetMaxIter(1);
+        gmg.SetMinIter(1);
+        x.SetValues(n, 0.0);
+        gmg.Solve(b, x);
+        e = x;
+        e.XPAY(-1.0, u);
+        REQUIRE(e.NormInf() < 1.5 * discErr);
+    }
+
+    SECTION("K-cycle and AMLI cycle")
+    {
+        // Checkerboard coefficient with jump 10 and harmonic means on the edges
+        const INT        m = 127, n = m * m;
+        std::vector<DBL> coef(5 * n, 0.0);
+        const INT        dx[4] = {0, -1, 1, 0}, dy[4] = {-1, 0, 0, 1};
+        const USI        pt[4] = {0, 1, 3, 4}; // south, west, east, north
+        auto kappa = [](INT i, INT j) { return (i / 16 + j / 16) % 2 ? 10.0 : 1.0; };
+        for (INT j = 0; j < m; j++) {
+            for (INT i = 0; i < m; i++) {
+                const DBL a = kappa(i, j);
+                for (USI p = 0; p < 4; p++) {
+                    const INT I = i + dx[p], J = j + dy[p];
+                    const bool out = (I < 0 || J < 0 || I >= m || J >= m);
+                    const DBL  b   = out ? a : kappa(I, J);
+                    const DBL h = 2.0 * a * b / (a + b);
+                    coef[pt[p] * n + j * m + i] = -h;
+                    coef[2 * n + j * m + i] += h;
+                }
+            }
+        }
+        StencilOp<STENCIL_5P2D> A(m, m, 1, coef);
+        const USI               numV = NumCycles(A, GMG_GALERKIN);
+        REQUIRE(NumCycles(A, GMG_GALERKIN, CYCLE_K) < numV);
+        REQUIRE(NumCycles(A, GMG_GALERKIN, CYCLE_AMLI, 2) < numV);
+    }
+}
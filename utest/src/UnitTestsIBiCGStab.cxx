@@ -0,0 +1,81 @@
+/*! \file    UnitTestsIBiCGStab.cxx
+ *  \brief   Unit tests for the improved BiCGStab method
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#include <vector>
+
+#include "../catch.hxx"
+#include "BiCGStab.hxx"
+#include "IBiCGStab.hxx"
+#include "Iter.hxx"
+#include "TestMatrices.hxx"
+
+TEST_CASE("IBiCGStab")
+{
+    std::cout << "TEST improved BiCGStab" << std::endl;
+
+    const USI        N = 32, n = N * N;
+    std::vector<DBL> diag(n);
+    for (USI i = 0; i < n; i++) diag[i] = 4.0 + 0.01 * (i % 7);
+    MAT A = ConvDiff2D(N, 1.0, diag);
+    VEC b(n, 1.0), x(n), r(n);
+
+    SECTION("Same convergence as BiCGStab")
+    {
+        Identity pcd;
+
+        BiCGStab bicgstab;
+        bicgstab.SetMaxIter(1000);
+        bicgstab.SetRelTol(1e-8);
+        bicgstab.SetupPCD(pcd);
+        REQUIRE(bicgstab.Setup(A) == FaspRetCode::SUCCESS);
+        x.SetValues(n, 0.0);
+        REQUIRE(bicgstab.Solve(b, x) == FaspRetCode::SUCCESS);
+
+        IBiCGStab solver;
+        solver.SetMaxIter(1000);
+        solver.SetRelTol(1e-8);
+        solver.SetupPCD(pcd);
+        REQUIRE(solver.Setup(A) == FaspRetCode::SUCCESS);
+        x.SetValues(n, 0.0);
+        REQUIRE(solver.Solve(b, x) == FaspRetCode::SUCCESS);
+        A.Residual(b, x, r);
+        REQUIRE(r.Norm2() < 1e-7 * b.Norm2());
+        REQUIRE(solver.GetIterations() <= 1.1 * bicgstab.GetIterations());
+    }
+
+    SECTION("Jacobi preconditioner")
+    {
+        Jacobi pcd;
+        pcd.SetMaxIter(1);
+        pcd.SetMinIter(1);
+        REQUIRE(pcd.Setup(A) == FaspRetCode::SUCCESS);
+
+        IBiCGStab solver;
+        solver.SetMaxIter(1000);
+        solver.SetRelTol(1e-10);
+        solver.SetupPCD(pcd);
+        REQUIRE(solver.Setup(A) == FaspRetCode::SUCCESS);
+        x.SetValues(n, 0.0);
+        REQUIRE(solver.Solve(b, x) == FaspRetCode::SUCCESS);
+        A.Residual(b, x, r);
+        REQUIRE(r.Norm2() < 1e-9 * b.Norm2());
+        REQUIRE(std::fabs(solver.GetNorm2() - r.Norm2()) < 1e-12);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Use shared test matrices             */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,74 @@
+/*! \file    UnitTestsIDRS.cxx
+ *  \brief   Unit tests for the IDR(s) and BiCGStab(l) methods
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#include <vector>
+
+#include "../catch.hxx"
+#include "BiCGStab.hxx"
+#include "BiCGStabL.hxx"
+#include "IDRS.hxx"
+#include "Iter.hxx"
+#include "TestMatrices.hxx"
+
+TEST_CASE("IDRS")
+{
+    std::cout << "TEST IDR(s) and BiCGStab(l)" << std::endl;
+
+    const USI N = 32, n = N * N;
+    MAT       A = ConvDiff2D(N, 6.0);
+    VEC       b(n, 1.0), x(n), r(n);
+    Identity  pcd;
+
+    // BiCGStab takes two matrix-vector products per iteration
+    BiCGStab bicgstab;
+    bicgstab.SetMaxIter(2000);
+    bicgstab.SetRelTol(1e-8);
+    bicgstab.SetupPCD(pcd);
+    REQUIRE(bicgstab.Setup(A) == FaspRetCode::SUCCESS);
+    x.SetValues(n, 0.0);
+    REQUIRE(bicgstab.Solve(b, x) == FaspRetCode::SUCCESS);
+    const USI mvBiCGStab = 2 * bicgstab.GetIterations();
+
+    // IDR(4) counts matrix-vector products
+    IDRS idrs;
+    idrs.SetMaxIter(2000);
+    idrs.SetRelTol(1e-8);
+    idrs.SetShadowDim(4);
+    idrs.SetupPCD(pcd);
+    REQUIRE(idrs.Setup(A) == FaspRetCode::SUCCESS);
+    x.SetValues(n, 0.0);
+    REQUIRE(idrs.Solve(b, x) == FaspRetCode::SUCCESS);
+    A.Residual(b, x, r);
+    REQUIRE(r.Norm2() < 1e-7 * b.Norm2());
+    REQUIRE(idrs.GetIterations() < 0.5 * mvBiCGStab);
+
+    // BiCGStab(2) counts BiCG steps, two matrix-vector products each
+    BiCGStabL bicgstabl;
+    bicgstabl.SetMaxIter(2000);
+    bicgstabl.SetRelTol(1e-8);
+    bicgstabl.SetDegree(2);
+    bicgstabl.SetupPCD(pcd);
+    REQUIRE(bicgstabl.Setup(A) == FaspRetCode::SUCCESS);
+    x.SetValues(n, 0.0);
+    REQUIRE(bicgstabl.Solve(b, x) == FaspRetCode::SUCCESS);
+    A.Residual(b, x, r);
+    REQUIRE(r.Norm2() < 1e-7 * b.Norm2());
+    REQUIRE(2 * bicgstabl.GetIterations() < 0.5 * mvBiCGStab);
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Use shared test matrices             */
+/*----------------------------------------------------------------------------*/
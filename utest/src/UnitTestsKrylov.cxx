@@ -0,0 +1,113 @@
+/*! \file    UnitTestsKrylov.cxx
+ *  \brief   Unit tests for the reusable Krylov solver interface
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#include <cmath>
+
+#include "../catch.hxx"
+#include "Krylov.hxx"
+#include "TestMatrices.hxx"
+
+TEST_CASE("Krylov")
+{
+    std::cout << "TEST reusable Krylov solver" << std::endl;
+
+    // 5-point Laplacian on a 32 x 32 grid
+    const USI N = 32, n = N * N;
+    MAT       A = ConvDiff2D(N, 0.0);
+    Identity  pcd;
+
+    VEC b1(n), b2(n), x(n), y(n);
+    for (USI i = 0; i < n; i++) {
+        b1[i] = 1.0;
+        b2[i] = std::sin(0.1 * i);
+    }
+
+    SOLParams params;
+    params.maxIter = 1000;
+    params.relTol  = 1e-10;
+    params.absTol  = 0.0;
+
+    SECTION("Repeated solves match single solves")
+    {
+        for (const char* name : {"cg", "bicgstab", "gmres"}) {
+            params.algName = name;
+            KrylovSolver solver;
+            REQUIRE(solver.Setup(A, pcd, params) == FaspRetCode::SUCCESS);
+
+            for (const VEC* b : {&b1, &b2, &b1}) {
+                x.SetValues(n, 0.0);
+                REQUIRE(solver.Solve(*b, x) == FaspRetCode::SUCCESS);
+
+                // The same answer as a fresh solver for this right-hand side, up to
+                // round-off from reductions other than VEC::Dot
+                KrylovSolver fresh;
+                REQUIRE(fresh.Setup(A, pcd, params) == FaspRetCode::SUCCESS);
+                y.SetValues(n, 0.0);
+                REQUIRE(fresh.Solve(*b, y) == FaspRetCode::SUCCESS);
+                REQUIRE(fresh.GetIterations() == solver.GetIterations());
+                y -= x;
+                REQUIRE(y.NormInf() <= params.relTol * x.NormInf());
+            }
+        }
+    }
+
+    SECTION("Clean releases the method, Setup makes it usable again")
+    {
+        KrylovSolver solver;
+        REQUIRE(solver.Solve(b1, x) == FaspRetCode::ERROR_SOLVER_TYPE);
+
+        params.algName = "gmres";
+        REQUIRE(solver.Setup(A, pcd, params) == FaspRetCode::SUCCESS);
+        x.SetValues(n, 0.0);
+        REQUIRE(solver.Solve(b1, x) == FaspRetCode::SUCCESS);
+        const USI numIter = solver.GetIterations();
+        REQUIRE(numIter > 0);
+
+        solver.Clean();
+        REQUIRE(solver.GetIterations() == 0);
+        REQUIRE(solver.Solve(b1, x) == FaspRetCode::ERROR_SOLVER_TYPE);
+
+        REQUIRE(solver.Setup(A, pcd, params) == FaspRetCode::SUCCESS);
+        x.SetValues(n, 0.0);
+        REQUIRE(solver.Solve(b1, x) == FaspRetCode::SUCCESS);
+        REQUIRE(solver.GetIterations() == numIter);
+    }
+
+    SECTION("Unknown and non-Krylov types fall back to CG")
+    {
+        KrylovSolver solver;
+        params.algName = "cg";
+        REQUIRE(solver.Setup(A, pcd, params) == FaspRetCode::SUCCESS);
+        x.SetValues(n, 0.0);
+        REQUIRE(solver.Solve(b2, x) == FaspRetCode::SUCCESS);
+        const USI numIter = solver.GetIterations();
+
+        for (const char* name : {"jacobi", "mpir", "unknown"}) {
+            params.algName = name;
+            REQUIRE(solver.Setup(A, pcd, params) == FaspRetCode::SUCCESS);
+            y.SetValues(n, 0.0);
+            REQUIRE(solver.Solve(b2, y) == FaspRetCode::SUCCESS);
+            REQUIRE(solver.GetIterations() == numIter);
+            y -= x;
+            REQUIRE(y.NormInf() <= params.relTol * x.NormInf());
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Use shared test matrices             */
+/*  Chensong Zhang      Oct/19/2026      Move allocation test to AllocTests   */
+/*----------------------------------------------------------------------------*/
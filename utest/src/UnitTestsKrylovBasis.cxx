@@ -0,0 +1,302 @@
+/*! \file    UnitTestsKrylovBasis.cxx
+ *  \brief   Unit tests for the contiguous Krylov basis and GMRES built on it
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "../catch.hxx"
+#include "FGMRES.hxx"
+#include "GMRES.hxx"
+#include "Iter.hxx"
+#include "KrylovBasis.hxx"
+#include "VFGMRES.hxx"
+
+/// Largest entry of |V_k^T V_k - I|.
+static DBL OrthError(const KrylovBasis& V, USI k, VEC& w)
+{
+    std::vector<DBL> h(k);
+    DBL              err = 0.0;
+    for (USI j = 0; j < k; j++) {
+        V.CopyCol(j, w);
+        V.MultiDot(k, w, h.data());
+        for (USI i = 0; i < k; i++)
+            err = std::max(err, std::fabs(h[i] - (i == j ? 1.0 : 0.0)));
+    }
+    return err;
+}
+
+/// 1D convection-diffusion, upwind: nonsymmetric tridiagonal.
+static MAT ConvDiff1D(USI m)
+{
+    std::vector<DBL> values;
+    std::vector<USI> colInd, rowPtr(1, 0);
+    for (USI i = 0; i < m; i++) {
+        if (i > 0) values.push_back(-1.5), colInd.push_back(i - 1);
+        values.push_back(2.5), colInd.push_back(i);
+        if (i + 1 < m) values.push_back(-1.0), colInd.push_back(i + 1);
+        rowPtr.push_back(colInd.size());
+    }
+    return MAT(m, m, values.size(), values, colInd, rowPtr);
+}
+
+/// VFGMRES that records the restart number chosen after each cycle.
+class VFGMRESTrace : public VFGMRES
+{
+protected:
+    void UpdateRestart(double rate) override
+    {
+        VFGMRES::UpdateRestart(rate);
+        restarts.push_back(restart);
+    }
+
+public:
+    std::vector<USI> restarts; ///< restart numbers of the cycles after the first
+};
+
+TEST_CASE("KrylovBasis")
+{
+    std::cout << "TEST Krylov basis and GMRES" << std::endl;
+
+    const USI n = 1000, k = 12;
+
+    SECTION("Block kernels agree with VEC operations")
+    {
+        KrylovBasis V;
+        REQUIRE(V.Allocate(n, k) == FaspRetCode::SUCCESS);
+        VEC              w(n), u(n), y(n, 0.0);
+        std::vector<DBL> h(k), c(k);
+        for (USI i = 0; i < n; i++) w[i] = std::sin(0.7 * i);
+        for (USI j = 0; j < k; j++) {
+            for (USI i = 0; i < n; i++) u[i] = std::cos(0.01 * (j + 1) * i);
+            V.SetCol(j, u);
+            c[j] = 1.0 / (j + 1);
+            y.AXPY(c[j], u);
+        }
+
+        DBL norm = V.MultiDotNorm(k, w, h.data());
+        REQUIRE(std::fabs(norm - w.Dot(w)) < 1e-10);
+        for (USI j = 0; j < k; j++) {
+            V.CopyCol(j, u);
+            REQUIRE(std::fabs(h[j] - u.Dot(w)) < 1e-10);
+        }
+
+        V.Combine(k, c.data(), u);
+        u -= y;
+        REQUIRE(u.NormInf() < 1e-12);
+
+        V.MultiAXPY(k, c.data(), y);
+        REQUIRE(y.NormInf() < 1e-12);
+    }
+
+    SECTION("Kernels on the first k = 0 columns leave w alone")
+    {
+        VEC w(n);
+        for (USI i = 0; i < n; i++) w[i] = std::sin(0.7 * i);
+        const DBL norm = w.Norm2();
+
+        for (BasisPrec prec : {BASIS_DOUBLE, BASIS_FLOAT, BASIS_BF16}) {
+            KrylovBasis      V;
+            std::vector<DBL> h(1, -1.0), y(1, 1.0);
+            REQUIRE(V.Allocate(n, k, prec) == FaspRetCode::SUCCESS);
+            V.MultiDot(0, w, h.data());
+            REQUIRE(h[0] == -1.0);
+            REQUIRE(std::fabs(V.MultiDotNorm(0, w, h.data()) - norm * norm) < 1e-10);
+            V.MultiAXPY(0, y.data(), w);
+            V.AddCombine(0, y.data(), w);
+            REQUIRE(std::fabs(w.Norm2() - norm) < 1e-14);
+            for (OrthType type : {ORTH_MGS, ORTH_CGS2, ORTH_CGS2_LOW})
+                REQUIRE(std::fabs(V.Orthogonalize(0, type, w, h.data()) - norm) <
+                        1e-12);
+        }
+    }
+
+    SECTION("All schemes keep an ill-conditioned basis orthogonal")
+    {
+        for (OrthType type : {ORTH_MGS, ORTH_CGS2, ORTH_CGS2_LOW}) {
+            // Monomials on [0,1] are nearly dependent; CGS2 and MGS cope with them
+            KrylovBasis      V;
+            VEC              w(n);
+            std::vector<DBL> h(k);
+            REQUIRE(V.Allocate(n, k) == FaspRetCode::SUCCESS);
+            for (USI j = 0; j < k; j++) {
+                for (USI i = 0; i < n; i++) w[i] = std::pow((i + 1.0) / n, j);
+                const DBL t = V.Orthogonalize(j, type, w, h.data());
+                REQUIRE(std::fabs(t - w.Norm2()) < 1e-8 * t);
+                w.Scale(1.0 / t);
+                V.SetCol(j, w);
+            }
+            const DBL tol = (type == ORTH_MGS) ? 1e-6 : 1e-13;
+            REQUIRE(OrthError(V, k, w) < tol);
+        }
+    }
+
+    SECTION("GMRES, FGMRES and VFGMRES converge with all schemes")
+    {
+        const USI m = 200;
+        MAT       A = ConvDiff1D(m);
+        VEC      b(m, 1.0), x(m), r(m);
+        Identity pcd;
+
+        for (OrthType type : {ORTH_MGS, ORTH_CGS2, ORTH_CGS2_LOW}) {
+            GMRES gmres;
+            gmres.SetMaxIter(500);
+            gmres.SetRelTol(1e-10);
+            gmres.SetRestart(20);
+            gmres.SetOrthType(type);
+            gmres.SetupPCD(pcd);
+            REQUIRE(gmres.Setup(A) == FaspRetCode::SUCCESS);
+            x.SetValues(m, 0.0);
+            REQUIRE(gmres.Solve(b, x) == FaspRetCode::SUCCESS);
+            A.Residual(b, x, r);
+            REQUIRE(r.Norm2() < 1e-8 * std::sqrt(m));
+
+            FGMRES fgmres;
+            fgmres.SetMaxIter(500);
+            fgmres.SetRelTol(1e-10);
+            fgmres.SetRestart(20);
+            fgmres.SetOrthType(type);
+            fgmres.SetupPCD(pcd);
+            REQUIRE(fgmres.Setup(A) == FaspRetCode::SUCCESS);
+            x.SetValues(m, 0.0);
+            REQUIRE(fgmres.Solve(b, x) == FaspRetCode::SUCCESS);
+            A.Residual(b, x, r);
+            REQUIRE(r.Norm2() < 1e-8 * std::sqrt(m));
+
+            VFGMRES vfgmres;
+            vfgmres.SetMaxIter(500);
+            vfgmres.SetRelTol(1e-10);
+            vfgmres.SetRestart(20);
+            vfgmres.SetOrthType(type);
+            vfgmres.SetupPCD(pcd);
+            REQUIRE(vfgmres.Setup(A) == FaspRetCode::SUCCESS);
+            x.SetValues(m, 0.0);
+            REQUIRE(vfgmres.Solve(b, x) == FaspRetCode::SUCCESS);
+            A.Residual(b, x, r);
+            REQUIRE(r.Norm2() < 1e-8 * std::sqrt(m));
+        }
+    }
+
+    SECTION("VFGMRES adapts the restart number between its bounds")
+    {
+        const USI m = 400;
+        MAT       A = ConvDiff1D(m);
+        VEC      b(m, 1.0), x(m, 0.0), r(m);
+        Identity pcd;
+
+        VFGMRESTrace vfgmres;
+        vfgmres.SetMaxIter(2000);
+        vfgmres.SetRelTol(1e-10);
+        vfgmres.SetRestart(20);
+        vfgmres.SetMaxMinRestart(30, 10);
+        vfgmres.SetupPCD(pcd);
+        REQUIRE(vfgmres.Setup(A) == FaspRetCode::SUCCESS);
+        REQUIRE(vfgmres.Solve(b, x) == FaspRetCode::SUCCESS);
+        A.Residual(b, x, r);
+        REQUIRE(r.Norm2() < 1e-8 * std::sqrt(m));
+
+        // Moderate cycles shrink the restart number from 20, and it comes back to
+        // maxRestart near minRestart; it never leaves the bounds
+        const auto& restarts = vfgmres.restarts;
+        REQUIRE(restarts.size() > 2);
+        const USI minUsed = *std::min_element(restarts.begin(), restarts.end());
+        const USI maxUsed = *std::max_element(restarts.begin(), restarts.end());
+        REQUIRE(minUsed >= 10);
+        REQUIRE(minUsed < 20);
+        REQUIRE(maxUsed == 30);
+    }
+
+    SECTION("Kernels in float and bf16 agree with double up to rounding")
+    {
+        VEC              w(n), u(n), y(n), z(n);
+        std::vector<DBL> c(k), h(k), g(k);
+        for (USI i = 0; i < n; i++) w[i] = std::sin(0.7 * i);
+        for (USI j = 0; j < k; j++) c[j] = 1.0 / (j + 1);
+
+        KrylovBasis V;
+        REQUIRE(V.Allocate(n, k) == FaspRetCode::SUCCESS);
+        for (USI j = 0; j < k; j++) {
+            for (USI i = 0; i < n; i++) u[i] = std::cos(0.01 * (j + 1) * i);
+            V.SetCol(j, u);
+        }
+        V.MultiDot(k, w, h.data());
+        V.Combine(k, c.data(), y);
+
+        for (BasisPrec prec : {BASIS_FLOAT, BASIS_BF16}) {
+            const DBL   eps = (prec == BASIS_FLOAT) ? 6e-8 : 4e-3; // unit roundoff
+            KrylovBasis W;
+            REQUIRE(W.Allocate(n, k, prec) == FaspRetCode::SUCCESS);
+            REQUIRE(W.GetPrec() == prec);
+            for (USI j = 0; j < k; j++) {
+                V.CopyCol(j, u);
+                W.SetCol(j, u);
+                W.CopyCol(j, z);
+                z -= u;
+                REQUIRE(z.NormInf() <= eps * u.NormInf());
+                REQUIRE(z.NormInf() > 0.0);
+            }
+
+            const DBL norm = W.MultiDotNorm(k, w, g.data());
+            REQUIRE(std::fabs(norm - w.Dot(w)) < 1e-10); // w itself is not rounded
+            for (USI j = 0; j < k; j++)
+                REQUIRE(std::fabs(g[j] - h[j]) < eps * std::sqrt(DBL(n)) * n);
+
+            W.Combine(k, c.data(), z);
+            z -= y;
+            REQUIRE(z.NormInf() < 4 * eps);
+        }
+    }
+
+    SECTION("GMRES and FGMRES reach full accuracy with a reduced-precision basis")
+    {
+        const USI m = 200;
+        MAT       A = ConvDiff1D(m);
+        VEC       b(m, 1.0), x(m), r(m);
+        Identity  pcd;
+
+        for (BasisPrec prec : {BASIS_FLOAT, BASIS_BF16}) {
+            GMRES gmres;
+            gmres.SetMaxIter(1000);
+            gmres.SetRelTol(1e-10);
+            gmres.SetRestart(20);
+            gmres.SetBasisPrec(prec);
+            gmres.SetupPCD(pcd);
+            REQUIRE(gmres.Setup(A) == FaspRetCode::SUCCESS);
+            x.SetValues(m, 0.0);
+            REQUIRE(gmres.Solve(b, x) == FaspRetCode::SUCCESS);
+            A.Residual(b, x, r);
+            REQUIRE(r.Norm2() < 1e-8 * std::sqrt(m));
+
+            FGMRES fgmres;
+            fgmres.SetMaxIter(1000);
+            fgmres.SetRelTol(1e-10);
+            fgmres.SetRestart(20);
+            fgmres.SetBasisPrec(prec);
+            fgmres.SetupPCD(pcd);
+            REQUIRE(fgmres.Setup(A) == FaspRetCode::SUCCESS);
+            x.SetValues(m, 0.0);
+            REQUIRE(fgmres.Solve(b, x) == FaspRetCode::SUCCESS);
+            A.Residual(b, x, r);
+            REQUIRE(r.Norm2() < 1e-8 * std::sqrt(m));
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Add VFGMRES                          */
+/*  Chensong Zhang      Oct/19/2026      Add reduced-precision basis tests    */
+/*  Chensong Zhang      Oct/19/2026      Check VFGMRES restart adaptation     */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,134 @@
+/*! \file    UnitTestsLDLT.cxx
+ *  \brief   Unit tests for LDLT class
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#include <cmath>
+#include <vector>
+
+#include "../catch.hxx"
+#include "LDLT.hxx"
+#include "TestMatrices.hxx"
+
+TEST_CASE("LDLT")
+{
+    std::cout << "TEST LDLT sparse direct solver" << std::endl;
+
+    const USI m = 20, n = m * m;
+
+    VEC xstar(n), b(n), x(n, 0.0), r(n);
+    for (USI i = 0; i < n; i++) xstar[i] = std::cos(0.3 * i);
+
+    SECTION("SPD matrix, Cholesky mode")
+    {
+        const MAT mat = ConvDiff2D(m, 0.0);
+        mat.Apply(xstar, b);
+
+        LDLT solver;
+        solver.SetSPD(true);
+        solver.SetMaxSuperSize(8);
+        REQUIRE(solver.Setup(mat) == FaspRetCode::SUCCESS);
+        REQUIRE(solver.GetNumPerturbed() == 0);
+        REQUIRE(solver.Solve(b, x) == FaspRetCode::SUCCESS);
+        for (USI i = 0; i < n; i++) REQUIRE(std::abs(x[i] - xstar[i]) < 1e-10);
+    }
+
+    SECTION("Symmetric indefinite matrix")
+    {
+        const MAT mat = ConvDiff2D(m, 0.0, 2.3); // nonsingular, 2.0 is not
+        mat.Apply(xstar, b);
+
+        LDLT solver;
+        REQUIRE(solver.Setup(mat) == FaspRetCode::SUCCESS);
+        REQUIRE(solver.Solve(b, x) == FaspRetCode::SUCCESS);
+        mat.Residual(b, x, r);
+        REQUIRE(r.Norm2() < 1e-10 * b.Norm2());
+
+        // Cholesky mode has to reject the indefinite matrix
+        LDLT chol;
+        chol.SetSPD(true);
+        REQUIRE(chol.Setup(mat) == FaspRetCode::ERROR_DSOLVER_SETUP);
+    }
+
+    SECTION("Nested dissection gives a bushy tree of wide supernodes")
+    {
+        const USI m64 = 64;
+        const MAT mat = ConvDiff2D(m64, 0.0);
+
+        LDLT solver;
+        solver.SetSPD(true);
+        REQUIRE(solver.Setup(mat) == FaspRetCode::SUCCESS);
+        REQUIRE(solver.GetNumLeaves() > 1);
+        REQUIRE(solver.GetNumLevels() < solver.GetNumSuper() / 10);
+        REQUIRE(solver.GetNumSuper() < m64 * m64 / 2); // wider than one column
+        REQUIRE(solver.GetFactorNNZ() < 6 * mat.GetNNZ());
+
+        VEC bb(m64 * m64, 1.0), xx(m64 * m64, 0.0), rr(m64 * m64);
+        REQUIRE(solver.Solve(bb, xx) == FaspRetCode::SUCCESS);
+        mat.Residual(bb, xx, rr);
+        REQUIRE(rr.Norm2() < 1e-12 * bb.Norm2());
+    }
+
+    SECTION("Refinement after perturbed pivots reports failure")
+    {
+        // Laplacian with the corner unknown decoupled and zero: a zero pivot
+        std::vector<DBL> coef(STENCIL_5P2D * n, -1.0);
+        for (USI i = 0; i < n; i++) coef[2 * n + i] = 4.0;
+        coef[2 * n] = coef[3 * n] = coef[4 * n] = 0.0; // row 0
+        coef[n + 1] = coef[m] = 0.0;                   // column 0
+        StencilOp<STENCIL_5P2D> op(m, m, 1, coef);
+        MAT                     mat;
+        op.ToMAT(mat);
+
+        for (USI i = 0; i < n; i++) b[i] = (i == 0) ? 0.0 : std::sin(0.7 * i);
+
+        LDLT solver;
+        solver.SetRelTol(1e-10);
+        solver.SetAbsTol(0.0);
+        REQUIRE(solver.Setup(mat) == FaspRetCode::SUCCESS);
+        REQUIRE(solver.GetNumPerturbed() == 1);
+        REQUIRE(solver.Solve(b, x) == FaspRetCode::SUCCESS);
+        mat.Residual(b, x, r);
+        REQUIRE(r.Norm2() < 1e-10 * b.Norm2());
+
+        // A tolerance below roundoff cannot be reached
+        solver.SetRelTol(1e-30);
+        REQUIRE(solver.Solve(b, x) == FaspRetCode::ERROR_SOLVER_MAXIT);
+    }
+
+    SECTION("Large element growth without pivoting is an error")
+    {
+        // Zero diagonal: the first pivot is perturbed and the next one explodes
+        std::vector<DBL> values;
+        std::vector<USI> colInd, rowPtr(1, 0);
+        for (USI i = 0; i < n; i++) {
+            const DBL lower = 1.0 + 0.3 * std::cos(i);
+            const DBL upper = 1.0 + 0.3 * std::cos(i + 1.0);
+            if (i > 0) values.push_back(lower), colInd.push_back(i - 1);
+            values.push_back(0.0), colInd.push_back(i);
+            if (i + 1 < n) values.push_back(upper), colInd.push_back(i + 1);
+            rowPtr.push_back(colInd.size());
+        }
+        const MAT mat(n, n, colInd.size(), values, colInd, rowPtr);
+
+        LDLT solver;
+        REQUIRE(solver.Setup(mat) == FaspRetCode::ERROR_DSOLVER_SETUP);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Check failed refinement              */
+/*  Chensong Zhang      Oct/19/2026      Use shared test matrices             */
+/*  Chensong Zhang      Oct/19/2026      Check tree shape and element growth  */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,167 @@
+/*! \file    UnitTestsMG.cxx
+ *  \brief   Unit tests for multigrid with sparse matrices on all levels
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#include <cmath>
+#include <vector>
+
+#include "../catch.hxx"
+#include "DenseLU.hxx"
+#include "Iter.hxx"
+#include "MG.hxx"
+
+/// Tridiagonal matrix with diagonal d[i] and off-diagonals -e[i] in row i.
+static MAT Tridiag(const std::vector<DBL>& d, const std::vector<DBL>& e)
+{
+    const USI        n = d.size();
+    std::vector<DBL> values;
+    std::vector<USI> colInd, rowPtr(1, 0);
+    for (USI i = 0; i < n; i++) {
+        if (i > 0) values.push_back(-e[i]), colInd.push_back(i - 1);
+        values.push_back(d[i]), colInd.push_back(i);
+        if (i + 1 < n) values.push_back(-e[i]), colInd.push_back(i + 1);
+        rowPtr.push_back(colInd.size());
+    }
+    return MAT(n, n, values.size(), values, colInd, rowPtr);
+}
+
+/// Linear interpolation from (n - 1) / 2 to n points, or its transpose / 2.
+static MAT Interp(USI n, bool transpose)
+{
+    const USI        nc = (n - 1) / 2;
+    std::vector<DBL> values;
+    std::vector<USI> colInd, rowPtr(1, 0);
+    if (transpose) {
+        for (USI I = 0; I < nc; I++) {
+            values.insert(values.end(), {0.25, 0.5, 0.25});
+            colInd.insert(colInd.end(), {2 * I, 2 * I + 1, 2 * I + 2});
+            rowPtr.push_back(colInd.size());
+        }
+        return MAT(nc, n, values.size(), values, colInd, rowPtr);
+    }
+    for (USI i = 0; i < n; i++) {
+        if (i % 2 == 1) {
+            values.push_back(1.0), colInd.push_back(i / 2);
+        } else {
+            if (i > 0) values.push_back(0.5), colInd.push_back(i / 2 - 1);
+            if (i + 1 < n) values.push_back(0.5), colInd.push_back(i / 2);
+        }
+        rowPtr.push_back(colInd.size());
+    }
+    return MAT(n, nc, values.size(), values, colInd, rowPtr);
+}
+
+TEST_CASE("MG")
+{
+    std::cout << "TEST multigrid with sparse matrices" << std::endl;
+
+    const USI        n = 255, numLevels = 4;
+    std::vector<DBL> d(n, 2.0), e(n, 1.0);
+    MAT              A = Tridiag(d, e);
+
+    // Hierarchy with Galerkin coarse operators
+    std::vector<MAT>    R(numLevels), P(numLevels), Ac(numLevels);
+    std::vector<Jacobi> smoothers(numLevels, Jacobi(2.0 / 3.0));
+    DenseLU             directSol;
+    MG<MAT>             mg;
+    REQUIRE(mg.SetupALL(A, numLevels) == FaspRetCode::SUCCESS);
+    for (USI l = 0, size = n; l < numLevels; l++, size = (size - 1) / 2) {
+        const MAT& fine = (l == 0) ? A : Ac[l - 1];
+        R[l]            = Interp(size, true);
+        P[l]            = Interp(size, false);
+        MAT AP;
+        AP.Mult(fine, P[l]);
+        Ac[l].Mult(R[l], AP);
+        REQUIRE(smoothers[l].Setup(fine) == FaspRetCode::SUCCESS);
+        if (l + 1 == numLevels) REQUIRE(directSol.Setup(Ac[l]) == FaspRetCode::SUCCESS);
+        REQUIRE(mg.SetupLevel(l, &R[l], &P[l], &Ac[l], &smoothers[l], &smoothers[l],
+                              l + 1 == numLevels ? &directSol : nullptr) ==
+                FaspRetCode::SUCCESS);
+    }
+    mg.SetMaxIter(100);
+    mg.SetRelTol(1e-8);
+
+    VEC b(n, 1.0), x(n, 0.0);
+    mg.Solve(b, x);
+    const USI numIter = mg.GetIterations();
+    REQUIRE(numIter < 30);
+
+    SECTION("Values-only update keeps the hierarchy")
+    {
+        // Variable coefficients on the same pattern, mildly changed after scaling
+        for (USI i = 0; i < n; i++) {
+            e[i] = 10.0 * (1.0 + 0.05 * std::sin(0.1 * i));
+            d[i] = 2.0 * e[i];
+        }
+        MAT B = Tridiag(d, e);
+        REQUIRE(mg.UpdateValues(B) == FaspRetCode::SUCCESS);
+        REQUIRE_FALSE(mg.NeedsSetup());
+
+        // Coarse operators match the Galerkin product formed from scratch
+        MAT AP, RAP;
+        AP.Mult(B, P[0]);
+        RAP.Mult(R[0], AP);
+        VEC u(RAP.GetColSize()), v1, v2;
+        for (USI i = 0; i < u.GetSize(); i++) u[i] = std::cos(0.3 * i);
+        v1.SetValues(RAP.GetRowSize(), 0.0);
+        v2.SetValues(RAP.GetRowSize(), 0.0);
+        RAP.Apply(u, v1);
+        Ac[0].Apply(u, v2);
+        v1 -= v2;
+        REQUIRE(v1.NormInf() < 1e-12);
+
+        x.SetValues(n, 0.0);
+        mg.Solve(b, x);
+        REQUIRE(mg.GetIterations() <= numIter + 2);
+    }
+
+    SECTION("Large drift or a new pattern calls for a full setup")
+    {
+        for (USI i = 0; i < n; i += 2) e[i] = 0.1;
+        MAT B = Tridiag(d, e);
+        REQUIRE(mg.UpdateValues(B) == FaspRetCode::SUCCESS);
+        REQUIRE(mg.NeedsSetup());
+
+        MAT C = Tridiag(std::vector<DBL>(n - 2, 2.0), std::vector<DBL>(n - 2, 1.0));
+        REQUIRE(mg.UpdateValues(C) == FaspRetCode::ERROR_MAT_DATA);
+    }
+
+    SECTION("Same number of nonzeros on a new pattern is rejected untouched")
+    {
+        // Entry (0,1) of A moved to (0,2)
+        std::vector<DBL> values;
+        std::vector<USI> colInd, rowPtr(1, 0);
+        for (USI i = 0; i < n; i++) {
+            if (i > 0) values.push_back(-3.0), colInd.push_back(i - 1);
+            values.push_back(6.0), colInd.push_back(i);
+            if (i + 1 < n) values.push_back(-3.0), colInd.push_back(i == 0 ? 2 : i + 1);
+            rowPtr.push_back(colInd.size());
+        }
+        MAT C(n, n, values.size(), values, colInd, rowPtr);
+        REQUIRE(C.GetNNZ() == A.GetNNZ());
+
+        VEC u(Ac[0].GetColSize()), v1(Ac[0].GetRowSize()), v2(Ac[0].GetRowSize());
+        for (USI i = 0; i < u.GetSize(); i++) u[i] = std::cos(0.3 * i);
+        Ac[0].Apply(u, v1);
+        REQUIRE(mg.UpdateValues(C) == FaspRetCode::ERROR_MAT_DATA);
+        Ac[0].Apply(u, v2);
+        v1 -= v2;
+        REQUIRE(v1.NormInf() == 0.0);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Reject a new pattern with same nnz   */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,119 @@
+/*! \file    UnitTestsMINRES.cxx
+ *  \brief   Unit tests for the preconditioned MINRES method
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#include <cmath>
+#include <vector>
+
+#include "../catch.hxx"
+#include "CG.hxx"
+#include "Iter.hxx"
+#include "MINRES.hxx"
+
+/// Saddle-point matrix [L B^T; B 0] with the 1D Laplacian L of size n and
+/// constraints B picking every stride-th unknown; L alone if stride is 0.
+static MAT SaddlePoint(USI n, USI stride)
+{
+    const USI        m = (stride == 0) ? 0 : n / stride;
+    std::vector<DBL> values;
+    std::vector<USI> colInd, rowPtr(1, 0);
+    for (USI i = 0; i < n; i++) {
+        if (i > 0) values.push_back(-1.0), colInd.push_back(i - 1);
+        values.push_back(2.0), colInd.push_back(i);
+        if (i + 1 < n) values.push_back(-1.0), colInd.push_back(i + 1);
+        if (m > 0 && i % stride == 0 && i / stride < m)
+            values.push_back(1.0), colInd.push_back(n + i / stride);
+        rowPtr.push_back(colInd.size());
+    }
+    for (USI j = 0; j < m; j++) {
+        values.push_back(1.0), colInd.push_back(j * stride);
+        rowPtr.push_back(colInd.size());
+    }
+    return MAT(n + m, n + m, values.size(), values, colInd, rowPtr);
+}
+
+TEST_CASE("MINRES")
+{
+    std::cout << "TEST preconditioned MINRES" << std::endl;
+
+    SECTION("Symmetric indefinite saddle-point system")
+    {
+        MAT       A = SaddlePoint(200, 10);
+        const USI n = A.GetRowSize();
+        VEC       b(n, 1.0), x(n, 0.0), r(n);
+        Identity  pcd;
+
+        MINRES solver;
+        solver.SetMaxIter(1000);
+        solver.SetRelTol(1e-10);
+        solver.SetupPCD(pcd);
+        REQUIRE(solver.Setup(A) == FaspRetCode::SUCCESS);
+        REQUIRE(solver.Solve(b, x) == FaspRetCode::SUCCESS);
+
+        A.Residual(b, x, r);
+        REQUIRE(r.Norm2() < 1e-8 * b.Norm2());
+        REQUIRE(std::fabs(solver.GetNorm2() - r.Norm2()) < 1e-12);
+    }
+
+    SECTION("Jacobi preconditioner on a definite system, like CG")
+    {
+        MAT       A = SaddlePoint(200, 0);
+        const USI n = A.GetRowSize();
+        VEC       b(n, 1.0), x(n, 0.0), r(n);
+        Jacobi    pcd;
+        pcd.SetMaxIter(1);
+        pcd.SetMinIter(1);
+        REQUIRE(pcd.Setup(A) == FaspRetCode::SUCCESS);
+
+        MINRES solver;
+        solver.SetMaxIter(1000);
+        solver.SetRelTol(1e-10);
+        solver.SetupPCD(pcd);
+        REQUIRE(solver.Setup(A) == FaspRetCode::SUCCESS);
+        REQUIRE(solver.Solve(b, x) == FaspRetCode::SUCCESS);
+        A.Residual(b, x, r);
+        REQUIRE(r.Norm2() < 1e-7 * b.Norm2());
+
+        CG cg;
+        cg.SetMaxIter(1000);
+        cg.SetRelTol(1e-10);
+        cg.SetupPCD(pcd);
+        REQUIRE(cg.Setup(A) == FaspRetCode::SUCCESS);
+        x.SetValues(n, 0.0);
+        cg.Solve(b, x);
+        REQUIRE(solver.GetIterations() <= cg.GetIterations() + 2);
+    }
+
+    SECTION("Indefinite preconditioner is rejected")
+    {
+        MAT A = SaddlePoint(50, 0);
+        MAT B = A;
+        B.Scale(-1.0);
+        const USI n = A.GetRowSize();
+        VEC       b(n, 1.0), x(n, 0.0);
+        Jacobi    pcd;
+        pcd.SetMaxIter(1);
+        pcd.SetMinIter(1);
+        REQUIRE(pcd.Setup(B) == FaspRetCode::SUCCESS);
+
+        MINRES solver;
+        solver.SetupPCD(pcd);
+        REQUIRE(solver.Setup(A) == FaspRetCode::SUCCESS);
+        REQUIRE(solver.Solve(b, x) == FaspRetCode::ERROR_SOLVER_PCD_TYPE);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,109 @@
+/*! \file    UnitTestsMPIR.cxx
+ *  \brief   Unit tests for mixed-precision iterative refinement
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#include <cmath>
+#include <vector>
+
+#include "../catch.hxx"
+#include "FloatMAT.hxx"
+#include "Iter.hxx"
+#include "Krylov.hxx"
+#include "MPIR.hxx"
+#include "SymMAT.hxx"
+#include "TestMatrices.hxx"
+
+TEST_CASE("MPIR")
+{
+    std::cout << "TEST mixed-precision iterative refinement" << std::endl;
+
+    const USI N = 32, n = N * N;
+    VEC       b(n), x(n), y(n), r(n);
+    for (USI i = 0; i < n; i++) b[i] = 1.0 + std::sin(0.1 * i);
+
+    SECTION("FloatMAT is MAT up to single precision")
+    {
+        MAT      A = ConvDiff2D(N, 0.3, 4.1);
+        FloatMAT B(A);
+        REQUIRE(B.GetNNZ() == A.GetNNZ());
+        A.Apply(b, x);
+        B.Apply(b, y);
+        y -= x;
+        REQUIRE(y.Norm2() < 1e-7 * x.Norm2());
+        REQUIRE(y.Norm2() > 0.0);
+
+        B.Residual(b, b, r);
+        y.SetValues(n, 0.0);
+        y -= r;
+        y += b;
+        A.Apply(b, x);
+        y -= x;
+        REQUIRE(y.Norm2() < 1e-7 * x.Norm2());
+    }
+
+    SECTION("CG inside, double precision accuracy")
+    {
+        MAT      A = ConvDiff2D(N, 0.0, 4.1);
+        Identity pcd;
+        MPIR     solver;
+        solver.SetInnerSolver(SOLType::SOLVER_CG, 1e-4);
+        solver.SetMaxIter(1000);
+        solver.SetRelTol(1e-13);
+        solver.SetAbsTol(0.0);
+        solver.SetupPCD(pcd);
+        REQUIRE(solver.Setup(A) == FaspRetCode::SUCCESS);
+        x.SetValues(n, 0.0);
+        REQUIRE(solver.Solve(b, x) == FaspRetCode::SUCCESS);
+        A.Residual(b, x, r);
+        REQUIRE(r.Norm2() < 1e-13 * b.Norm2());
+        REQUIRE(solver.GetNumRefine() <= 5);
+    }
+
+    SECTION("GMRES inside, nonsymmetric")
+    {
+        MAT      A = ConvDiff2D(N, 0.5, 4.1);
+        Identity pcd;
+        MPIR     solver;
+        solver.SetMaxIter(1000);
+        solver.SetRelTol(1e-12);
+        solver.SetAbsTol(0.0);
+        solver.SetupPCD(pcd);
+        REQUIRE(solver.Setup(A) == FaspRetCode::SUCCESS);
+        x.SetValues(n, 0.0);
+        REQUIRE(solver.Solve(b, x) == FaspRetCode::SUCCESS);
+        A.Residual(b, x, r);
+        REQUIRE(r.Norm2() < 1e-12 * b.Norm2());
+        REQUIRE(std::fabs(solver.GetNorm2() - r.Norm2()) < 1e-14 * b.Norm2());
+    }
+
+    SECTION("MPIR is not a Krylov method of the factory")
+    {
+        REQUIRE(CreateKrylov(SOLType::SOLVER_MPIR) == nullptr);
+    }
+
+    SECTION("Only MAT can be copied to single precision")
+    {
+        MAT    A = ConvDiff2D(N, 0.0, 4.1);
+        SymMAT S(A);
+        MPIR   solver;
+        REQUIRE(solver.Setup(S) == FaspRetCode::ERROR_INPUT_PAR);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Build MPIR through KrylovSolver      */
+/*  Chensong Zhang      Oct/19/2026      Use shared test matrices             */
+/*  Chensong Zhang      Oct/19/2026      Keep MPIR out of the Krylov factory  */
+/*----------------------------------------------------------------------------*/
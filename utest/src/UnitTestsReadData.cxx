@@ -0,0 +1,101 @@
+/*! \file    UnitTestsReadData.cxx
+ *  \brief   Unit tests for reading data files
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#include <cstdio>
+#include <fstream>
+
+#include "../catch.hxx"
+#include "MATUtil.hxx"
+#include "ReadData.hxx"
+
+TEST_CASE("ReadData")
+{
+    std::cout << "TEST reading MTX files" << std::endl;
+
+    SECTION("Streaming reader agrees with the triplet reader")
+    {
+        { // unsorted rows, a missing diagonal in row 2
+            std::ofstream out("utest_gen.mtx");
+            out << "% general matrix\n4 4 7\n1 2 -1\n1 1 4\n3 3 4\n2 1 -1\n"
+                << "4 4 4\n3 4 -1\n4 3 -1\n";
+        }
+
+        USI              row, col, nnz;
+        std::vector<USI> rowInd, colInd;
+        std::vector<DBL> values;
+        MAT              A, B;
+        REQUIRE(ReadMTX("utest_gen.mtx", row, col, nnz, rowInd, colInd, values) ==
+                FaspRetCode::SUCCESS);
+        REQUIRE(MTXtoMAT(row, col, nnz, rowInd, colInd, values, A) ==
+                FaspRetCode::SUCCESS);
+        REQUIRE(ReadMTXtoMAT("utest_gen.mtx", B) == FaspRetCode::SUCCESS);
+
+        REQUIRE(B.GetNNZ() == A.GetNNZ());
+        for (USI i = 0; i < row; i++)
+            for (USI j = 0; j < col; j++) REQUIRE(B.GetValue(i, j) == A.GetValue(i, j));
+        std::remove("utest_gen.mtx");
+    }
+
+    SECTION("Symmetric storage and duplicate entries")
+    {
+        {
+            std::ofstream out("utest_sym.mtx");
+            out << "%%MatrixMarket matrix coordinate real symmetric\n"
+                << "3 3 4\n1 1 2.0\n2 1 -1\n3 2 -1\n2 1 -0.5\n";
+        }
+
+        MAT A;
+        REQUIRE(ReadMat("utest_sym.mtx", A) == FaspRetCode::SUCCESS);
+        REQUIRE(A.GetNNZ() == 7);
+        REQUIRE(A.GetValue(0, 1) == -1.5);
+        REQUIRE(A.GetValue(1, 0) == -1.5);
+        REQUIRE(A.GetValue(1, 2) == -1.0);
+        REQUIRE(A.GetValue(2, 2) == 0.0);
+        std::remove("utest_sym.mtx");
+    }
+
+    SECTION("More rows than columns and malformed entries")
+    {
+        { // duplicates in the first rows shift the rows without a diagonal
+            std::ofstream out("utest_tall.mtx");
+            out << "4 2 7\n1 1 1\n1 1 1\n2 2 3\n2 1 1\n2 1 1\n3 1 5\n4 2 6\n";
+        }
+
+        MAT A;
+        VEC d;
+        REQUIRE(ReadMTXtoMAT("utest_tall.mtx", A) == FaspRetCode::SUCCESS);
+        REQUIRE(A.GetNNZ() == 5);
+        REQUIRE(A.GetValue(0, 0) == 2.0);
+        REQUIRE(A.GetValue(1, 0) == 2.0);
+        REQUIRE(A.GetValue(3, 1) == 6.0);
+        A.GetDiag(d);
+        REQUIRE(d[0] == 2.0);
+        REQUIRE(d[1] == 3.0);
+        std::remove("utest_tall.mtx");
+
+        {
+            std::ofstream out("utest_bad.mtx");
+            out << "2 2 2\n1 1 1\n2 x 1\n";
+        }
+        REQUIRE(ReadMTXtoMAT("utest_bad.mtx", A) == FaspRetCode::ERROR_INPUT_FILE);
+        std::remove("utest_bad.mtx");
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Test tall and malformed MTX files    */
+/*----------------------------------------------------------------------------*/
+
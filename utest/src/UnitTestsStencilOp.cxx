@@ -0,0 +1,90 @@
+/*! \file    UnitTestsStencilOp.cxx
+ *  \brief   Unit tests for StencilOp class
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#include <cmath>
+#include <vector>
+
+#include "../catch.hxx"
+#include "StencilOp.hxx"
+
+/// Compare Apply, Residual, and GetDiag of a stencil with its assembled MAT.
+template <StencilShape S>
+static void CheckStencil(USI nx, USI ny, USI nz, bool variable)
+{
+    const USI        n = nx * ny * nz;
+    std::vector<DBL> coef(variable ? (USI)S * n : (USI)S);
+    for (USI k = 0; k < coef.size(); k++) coef[k] = std::cos(0.3 * k) - (k % S == S / 2) * S;
+
+    StencilOp<S> op(nx, ny, nz, coef);
+    MAT          mat;
+    op.ToMAT(mat);
+    REQUIRE(mat.GetRowSize() == n);
+
+    VEC x(n), b(n), y(n), z(n), d1, d2;
+    for (USI i = 0; i < n; i++) x[i] = std::sin(0.37 * i) + 0.5, b[i] = 1.0;
+
+    mat.Apply(x, y);
+    op.Apply(x, z);
+    for (USI i = 0; i < n; i++) REQUIRE(std::abs(y[i] - z[i]) < 1e-12);
+
+    mat.Residual(b, x, y);
+    op.Residual(b, x, z);
+    for (USI i = 0; i < n; i++) REQUIRE(std::abs(y[i] - z[i]) < 1e-12);
+
+    mat.GetDiag(d1);
+    op.GetDiag(d2);
+    for (USI i = 0; i < n; i++) REQUIRE(d1[i] == d2[i]);
+}
+
+TEST_CASE("StencilOp")
+{
+    std::cout << "TEST StencilOp matrix-free stencils" << std::endl;
+
+    SECTION("Stencil points")
+    {
+        INT dx, dy, dz;
+        StencilOp<STENCIL_27P3D>::GetPoint(13, dx, dy, dz);
+        REQUIRE((dx == 0 && dy == 0 && dz == 0));
+        StencilOp<STENCIL_5P2D>::GetPoint(1, dx, dy, dz);
+        REQUIRE((dx == -1 && dy == 0 && dz == 0));
+        REQUIRE_THROWS(StencilOp<STENCIL_5P2D>(4, 4, 2, std::vector<DBL>(5)));
+        REQUIRE_THROWS(StencilOp<STENCIL_7P3D>(4, 4, 2, std::vector<DBL>(6)));
+    }
+
+    SECTION("2D stencils")
+    {
+        for (bool variable : {false, true}) {
+            CheckStencil<STENCIL_5P2D>(13, 7, 1, variable);
+            CheckStencil<STENCIL_9P2D>(13, 7, 1, variable);
+            CheckStencil<STENCIL_9P2D>(1, 5, 1, variable);
+            CheckStencil<STENCIL_5P2D>(2, 2, 1, variable);
+        }
+    }
+
+    SECTION("3D stencils")
+    {
+        for (bool variable : {false, true}) {
+            CheckStencil<STENCIL_7P3D>(9, 6, 5, variable);
+            CheckStencil<STENCIL_19P3D>(9, 6, 5, variable);
+            CheckStencil<STENCIL_27P3D>(9, 6, 5, variable);
+            CheckStencil<STENCIL_27P3D>(3, 1, 4, variable);
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/*  Brief Change History of This File                                         */
+/*----------------------------------------------------------------------------*/
+/*  Author              Date             Actions                              */
+/*----------------------------------------------------------------------------*/
+/*  Chensong Zhang      Oct/19/2026      Create file                          */
+/*  Chensong Zhang      Oct/19/2026      Same type in both conditional arms   */
+/*----------------------------------------------------------------------------*/
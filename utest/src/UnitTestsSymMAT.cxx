@@ -0,0 +1,66 @@
+/*! \file    UnitTestsSymMAT.cxx
+ *  \brief   Unit tests for SymMAT class
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#include <cmath>
+#include <vector>
+
+#include "../catch.hxx"
+#include "SymMAT.hxx"
+
+/// 9-point symmetric matrix on an m x m grid with varying coefficients.
+static MAT Stencil2D(USI m)
+{
+    std::vector<DBL> values;
+    std::vector<USI> colInd, rowPtr(1, 0);
+    for (INT j = 0; j < (INT)m; j++) {
+        for (INT i = 0; i < (INT)m; i++) {
+            const INT k = j * m + i;
+            for (INT dj = -1; dj <= 1; dj++) {
+                for (INT di = -1; di <= 1; di++) {
+                    if (i + di < 0 || i + di >= (INT)m || j + dj < 0 || j + dj >= (INT)m)
+                        continue;
+                    const INT l = k + dj * m + di;
+                    const DBL a = (l == k) ? 8.0 : -1.0 / (1.0 + std::min(k, l) % 5);
+                    values.push_back(a), colInd.push_back(l);
+                }
+            }
+            rowPtr.push_back(colInd.size());
+        }
+    }
+    return MAT(m * m, m * m, colInd.size(), values, colInd, rowPtr);
+}
+
+TEST_CASE("SymMAT")
+{
+    std::cout << "TEST SymMAT upper triangular storage" << std::endl;
+
+    const USI m = 40, n = m * m;
+    const MAT mat = Stencil2D(m);
+
+    VEC x(n), b(n), y(n), z(n);
+    for (USI i = 0; i < n; i++) x[i] = std::sin(0.2 * i), b[i] = 1.0;
+    mat.Apply(x, y);
+
+    MAT lower, upper;
+    mat.GetLowerTri(lower);
+    mat.GetUpperTri(upper);
+
+    for (const MAT* part : std::vector<const MAT*>{&mat, &lower, &upper}) {
+        SymMAT smat(*part);
+        REQUIRE(smat.GetNNZ() == (mat.GetNNZ() + n) / 2);
+
+        smat.Apply(x, z);
+        for (USI i = 0; i < n; i++) REQUIRE(std::abs(y[i] - z[i]) < 1e-12);
+
+        smat.Residual(b, x, z);
+        for (USI i = 0; i < n; i++) REQUIRE(std::abs(b[i] - y[i] - z[i]) < 1e-12);
+    }
+}
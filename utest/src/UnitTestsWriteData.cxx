@@ -0,0 +1,75 @@
+/*! \file    UnitTestsWriteData.cxx
+ *  \brief   Unit tests for writing data files
+ *  \author  Chensong Zhang
+ *  \date    Oct/19/2026
+ *
+ *-----------------------------------------------------------------------------------
+ *  Copyright (C) 2021--present by the FASP++ team. All rights reserved.
+ *  Released under the terms of the GNU Lesser General Public License 3.0 or later.
+ *-----------------------------------------------------------------------------------
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "../catch.hxx"
+#include "ReadData.hxx"
+#include "WriteData.hxx"
+
+/// A nonsymmetric tridiagonal matrix with values that are not short decimals.
+static MAT TriDiag(USI n)
+{
+    std::vector<DBL> values;
+    std::vector<USI> colInd, rowPtr(1, 0);
+    for (USI i = 0; i < n; i++) {
+        if (i > 0) values.push_back(-1.0 / 3.0), colInd.push_back(i - 1);
+        values.push_back(std::sqrt(2.0 + i)), colInd.push_back(i);
+        if (i + 1 < n) values.push_back(-std::exp(-1.0 * i)), colInd.push_back(i + 1);
+        rowPtr.push_back(colInd.size());
+    }
+    return MAT(n, n, colInd.size(), values, colInd, rowPtr);
+}
+
+/// Check that two matrices are exactly the same.
+static void CheckSame(const MAT& A, const MAT& B)
+{
+    REQUIRE(A.GetRowSize() == B.GetRowSize());
+    REQUIRE(A.GetNNZ() == B.GetNNZ());
+    for (USI i = 0; i < A.GetRowSize(); i++)
+        for (USI j = (i > 0 ? i - 1 : 0); j <= i + 1 && j < A.GetColSize(); j++)
+            REQUIRE(A.GetValue(i, j) == B.GetValue(i, j));
+}
+
+TEST_CASE("WriteData")
+{
+    std::cout << "TEST writing data files" << std::endl;
+
+    const USI n   = 2000;
+    const MAT mat = TriDiag(n);
+
+    for (bool compress : {false, true}) {
+        SECTION(compress ? "Compressed files" : "Text files")
+        {
+            MAT A, B;
+            REQUIRE(WriteCSR("utest_out.csr", mat, compress) == FaspRetCode::SUCCESS);
+            REQUIRE(ReadMat("utest_out.csr", A) == FaspRetCode::SUCCESS);
+            CheckSame(mat, A);
+
+            REQUIRE(WriteMTX("utest_out.mtx", mat, compress) == FaspRetCode::SUCCESS);
+            REQUIRE(ReadMat("utest_out.mtx", B) == FaspRetCode::SUCCESS);
+            CheckSame(mat, B);
+
+            VEC x(n), y;
+            for (USI i = 0; i < n; i++) x[i] = std::cos(0.7 * i) / 7.0;
+            REQUIRE(WriteVEC("utest_out.vec", x, compress) == FaspRetCode::SUCCESS);
+            REQUIRE(ReadVEC("utest_out.vec", y) == FaspRetCode::SUCCESS);
+            REQUIRE(y.GetSize() == n);
+            for (USI i = 0; i < n; i++) REQUIRE(y[i] == x[i]);
+
+            std::remove("utest_out.csr");
+            std::remove("utest_out.mtx");
+            std::remove("utest_out.vec");
+        }
+    }
+}